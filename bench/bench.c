@@ -0,0 +1,792 @@
+/*
+    Throughput of neat_tostr.h next to the C library: every neat_*2str and
+    neat_parse_* function, to_chars, array_to_string, print_array and print
+    with mixed args, over a few distributions of values:
+
+        small      integers in [0, 1000) (or [0, 100) for 8 bit types), prices with 2 decimals
+        full       the whole range of the type (random bits for float and double)
+        random     doubles in +-[0.001, 1e6) with a full mantissa
+        timestamp  unix seconds (32 bit types), milliseconds (64 bit), seconds with microseconds (float types)
+
+    Build and run from the repo root:
+
+        cc -O2 -std=gnu11 -I. bench/bench.c -o tostr_bench -lm
+        ./tostr_bench [-csv | -json] [-n count] [-filter text]
+
+    -n is the number of values per distribution (65536 by default), -filter
+    only runs the rows whose function name contains text. Each row is timed
+    on the same n values a few times and the fastest pass is kept. Rows
+    give ns and allocations per value (an element for the array rows, a
+    line for print) and MB/s of text written or read. Add
+    -DNEAT_TOSTR_THREADS -pthread to also time array_to_string on all cores.
+
+    Allocations are counted by wrapping malloc, calloc and realloc in this
+    file, so they're the library's (the C library's own aren't seen).
+
+    To compare with another library's double formatter, define
+    BENCH_REF_DTOA as a function of (double, char *buf) that returns the
+    length, and BENCH_REF_INCLUDE as its header, e.g. for ryu:
+
+        cc -O2 -std=gnu11 -I. -Iryu bench/bench.c -o tostr_bench -lm -lryu \
+           -DBENCH_REF_INCLUDE='"ryu/ryu.h"' -DBENCH_REF_DTOA=d2s_buffered_n
+*/
+
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+#include <stdlib.h>
+#include <float.h>
+#include <stdbool.h>
+#include <inttypes.h>
+#include <time.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#if defined(__SSE2__)
+    #include <emmintrin.h>
+#endif
+#ifdef NEAT_TOSTR_THREADS
+    #include <pthread.h>
+#endif
+#ifdef BENCH_REF_INCLUDE
+    #include BENCH_REF_INCLUDE
+#endif
+
+static size_t bench_allocs;
+
+static void *bench_malloc(size_t size)
+{
+    bench_allocs++;
+    return malloc(size);
+}
+
+static void *bench_calloc(size_t n, size_t size)
+{
+    bench_allocs++;
+    return calloc(n, size);
+}
+
+static void *bench_realloc(void *ptr, size_t size)
+{
+    bench_allocs++;
+    return realloc(ptr, size);
+}
+
+#define malloc(size) bench_malloc(size)
+#define calloc(n, size) bench_calloc(n, size)
+#define realloc(ptr, size) bench_realloc(ptr, size)
+
+#define NEAT_TOSTR_IMPLEMENTATION
+#include "neat_tostr.h"
+
+#define BENCH_DEFAULT_N 65536
+
+// the longest a value's text is in any distribution
+#define BENCH_MAX_CHARS 32
+
+typedef enum bench_format { BENCH_TABLE, BENCH_CSV, BENCH_JSON } bench_format;
+
+static bench_format bench_out_format = BENCH_TABLE;
+static const char *bench_filter;
+static bool bench_first_row = true;
+static volatile uint64_t bench_sink; // keeps the results alive
+static volatile double bench_fsink;
+
+static size_t bench_n;
+static unsigned char *bench_vals; // the values of the current type and distribution
+static unsigned char *bench_parsed; // where parse_array puts them back
+static char *bench_text; // the values as text, each one NUL terminated
+static char *bench_csv; // the same text with ',' instead of the NULs
+static size_t bench_text_len;
+static size_t *bench_offs; // of every value in bench_text
+static size_t *bench_lens;
+static FILE *bench_devnull;
+
+static double bench_now(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+static uint64_t bench_state = 0x9E3779B97F4A7C15ull;
+
+// xorshift64*, the same values every run
+static uint64_t bench_rand(void)
+{
+    bench_state ^= bench_state >> 12;
+    bench_state ^= bench_state << 25;
+    bench_state ^= bench_state >> 27;
+    return bench_state * 0x2545F4914F6CDD1Dull;
+}
+
+static double bench_rand_unit(void)
+{
+    return (bench_rand() >> 11) * 0x1p-53;
+}
+
+static int64_t bench_int(const char *dist, size_t size)
+{
+    if(strcmp(dist, "small") == 0) return bench_rand() % (size == 1 ? 100 : 1000);
+    if(strcmp(dist, "timestamp") == 0)
+    {
+        // 2017 to 2027
+        int64_t secs = 1500000000 + (int64_t) (bench_rand() % 300000000);
+        return size == 8 ? secs * 1000 + (int64_t) (bench_rand() % 1000) : secs;
+    }
+    return (int64_t) bench_rand();
+}
+
+static double bench_real(const char *dist, size_t size)
+{
+    if(strcmp(dist, "small") == 0) return (double) (bench_rand() % 100000) / 100;
+    if(strcmp(dist, "timestamp") == 0) return 1500000000 + (double) (bench_rand() % 300000000000000ull) / 1e6;
+    if(strcmp(dist, "random") == 0)
+    {
+        double v = (1 + bench_rand_unit()) * 0.001;
+        for(uint64_t e = bench_rand() % 9 ; e > 0 ; e--) v *= 10;
+        return bench_rand() & 1 ? -v : v;
+    }
+
+    // any finite value of the type
+    if(size == sizeof(float))
+    {
+        float f;
+        do
+        {
+            uint32_t bits = (uint32_t) bench_rand();
+            memcpy(&f, &bits, sizeof(f));
+        } while(f != f || f - f != 0);
+        return f;
+    }
+    double v;
+    do
+    {
+        uint64_t bits = bench_rand();
+        memcpy(&v, &bits, sizeof(v));
+    } while(v != v || v - v != 0);
+    return v;
+}
+
+static bool bench_skip(const char *name)
+{
+    return bench_filter && !strstr(name, bench_filter);
+}
+
+static void bench_report(const char *name, const char *type, const char *dist, size_t ops, size_t bytes, double secs, size_t allocs)
+{
+    double ns = secs * 1e9 / (double) ops;
+    double mbs = (double) bytes / secs / 1e6;
+    double per_op = (double) allocs / (double) ops;
+
+    switch(bench_out_format)
+    {
+        case BENCH_TABLE:
+            if(bench_first_row)
+                printf("%-28s %-10s %-10s %10s %10s %10s\n", "function", "type", "dist", "ns/op", "MB/s", "allocs/op");
+            printf("%-28s %-10s %-10s %10.2f %10.1f %10.3g\n", name, type, dist, ns, mbs, per_op);
+            break;
+        case BENCH_CSV:
+            if(bench_first_row)
+                printf("function,type,dist,ns_per_op,mb_per_s,allocs_per_op\n");
+            printf("%s,%s,%s,%.3f,%.2f,%g\n", name, type, dist, ns, mbs, per_op);
+            break;
+        case BENCH_JSON:
+            printf("%s\n  {\"function\": \"%s\", \"type\": \"%s\", \"dist\": \"%s\", \"ns_per_op\": %.3f, \"mb_per_s\": %.2f, \"allocs_per_op\": %g}",
+                   bench_first_row ? "[" : ",", name, type, dist, ns, mbs, per_op);
+            break;
+    }
+    bench_first_row = false;
+    fflush(stdout);
+}
+
+/*
+    Times the body, which loops over the values and adds the bytes it
+    wrote or read to b, and reports the fastest pass. It runs at least 3
+    passes and until 0.05 seconds have gone by, at most 50.
+*/
+#define BENCH(name, type, dist, ...) do { \
+    if(bench_skip(name)) break; \
+    double bench_best = 1e30, bench_total = 0; \
+    size_t bench_bytes = 0, bench_pass_allocs = 0; \
+    for(int bench_pass = 0 ; bench_pass < 50 && (bench_pass < 3 || bench_total < 0.05) ; bench_pass++) \
+    { \
+        size_t b = 0; \
+        size_t bench_allocs0 = bench_allocs; \
+        double bench_t0 = bench_now(); \
+        __VA_ARGS__ \
+        double bench_t = bench_now() - bench_t0; \
+        bench_total += bench_t; \
+        if(bench_t < bench_best) bench_best = bench_t; \
+        bench_bytes = b; \
+        bench_pass_allocs = bench_allocs - bench_allocs0; \
+    } \
+    bench_report(name, type, dist, bench_n, bench_bytes, bench_best, bench_pass_allocs); \
+} while(0)
+
+// lays out the text of the values, formatted by fmt_value, in bench_text and bench_csv
+static void bench_make_text(size_t (*fmt_value)(char *buf, size_t i))
+{
+    size_t pos = 0;
+    for(size_t i = 0 ; i < bench_n ; i++)
+    {
+        bench_offs[i] = pos;
+        bench_lens[i] = fmt_value(bench_text + pos, i);
+        pos += bench_lens[i];
+        bench_text[pos++] = '\0';
+    }
+    bench_text_len = pos;
+    memcpy(bench_csv, bench_text, pos);
+    for(size_t i = 0 ; i < bench_n ; i++)
+        bench_csv[bench_offs[i] + bench_lens[i]] = ',';
+}
+
+// integers
+
+#define BENCH_INT_FUNCS(T, PRI, SCN, STRTO) \
+static size_t bench_fmt_##T(char *buf, size_t i) \
+{ \
+    return (size_t) sprintf(buf, "%" PRI, ((T *) bench_vals)[i]); \
+} \
+\
+static void bench_fill_##T(const char *dist) \
+{ \
+    for(size_t i = 0 ; i < bench_n ; i++) \
+        ((T *) bench_vals)[i] = (T) bench_int(dist, sizeof(T)); \
+    bench_make_text(bench_fmt_##T); \
+} \
+\
+static void bench_##T(const char *dist) \
+{ \
+    T *v = (T *) bench_vals; \
+    size_t n = bench_n; \
+    char buf[BENCH_MAX_CHARS]; \
+    int err; \
+    bench_fill_##T(dist); \
+    \
+    BENCH("neat_" #T "2str", #T, dist, \
+        for(size_t i = 0 ; i < n ; i++) \
+        { \
+            char *s = neat_##T##2str(&v[i]); \
+            b += strlen(s); \
+            free(s); \
+        } \
+    ); \
+    BENCH("neat_" #T "2chars", #T, dist, \
+        for(size_t i = 0 ; i < n ; i++) \
+        { \
+            b += neat_##T##2chars(buf, sizeof(buf), &v[i]); \
+            bench_sink += (unsigned char) buf[0]; \
+        } \
+    ); \
+    BENCH("snprintf", #T, dist, \
+        for(size_t i = 0 ; i < n ; i++) \
+        { \
+            b += (size_t) snprintf(buf, sizeof(buf), "%" PRI, v[i]); \
+            bench_sink += (unsigned char) buf[0]; \
+        } \
+    ); \
+    BENCH("neat_parse_" #T, #T, dist, \
+        for(size_t i = 0 ; i < n ; i++) \
+        { \
+            bench_sink += (uint64_t) neat_parse_##T(bench_text + bench_offs[i], &err); \
+            b += bench_lens[i]; \
+        } \
+    ); \
+    BENCH("neat_parse_n_" #T, #T, dist, \
+        for(size_t i = 0 ; i < n ; i++) \
+        { \
+            bench_sink += (uint64_t) neat_parse_n_##T(bench_text + bench_offs[i], bench_lens[i], &err); \
+            b += bench_lens[i]; \
+        } \
+    ); \
+    BENCH(#STRTO, #T, dist, \
+        for(size_t i = 0 ; i < n ; i++) \
+        { \
+            bench_sink += (uint64_t) (T) STRTO(bench_text + bench_offs[i], NULL, 10); \
+            b += bench_lens[i]; \
+        } \
+    ); \
+    BENCH("sscanf", #T, dist, \
+        for(size_t i = 0 ; i < n ; i++) \
+        { \
+            T x = 0; \
+            sscanf(bench_text + bench_offs[i], "%" SCN, &x); \
+            bench_sink += (uint64_t) x; \
+            b += bench_lens[i]; \
+        } \
+    ); \
+    BENCH("neat_parse_array_" #T, #T, dist, \
+        neat_parse_array_result r = neat_parse_array_##T(bench_csv, bench_text_len - 1, ',', (T *) bench_parsed, n); \
+        bench_sink += r.count; \
+        b += bench_text_len; \
+    ); \
+}
+
+BENCH_INT_FUNCS(int8_t,   PRId8,  SCNd8,  strtol)
+BENCH_INT_FUNCS(int16_t,  PRId16, SCNd16, strtol)
+BENCH_INT_FUNCS(int32_t,  PRId32, SCNd32, strtol)
+BENCH_INT_FUNCS(int64_t,  PRId64, SCNd64, strtoll)
+BENCH_INT_FUNCS(uint8_t,  PRIu8,  SCNu8,  strtoul)
+BENCH_INT_FUNCS(uint16_t, PRIu16, SCNu16, strtoul)
+BENCH_INT_FUNCS(uint32_t, PRIu32, SCNu32, strtoul)
+BENCH_INT_FUNCS(uint64_t, PRIu64, SCNu64, strtoull)
+
+// the parsers behind parse, on the 64 bit values' text
+static void bench_parse_i64_u64(const char *dist)
+{
+    size_t n = bench_n;
+    int err;
+
+    bench_fill_int64_t(dist);
+    BENCH("neat_parse_i64", "int64_t", dist,
+        for(size_t i = 0 ; i < n ; i++)
+        {
+            bench_sink += (uint64_t) neat_parse_i64(bench_text + bench_offs[i], NULL, INT64_MIN, INT64_MAX, &err);
+            b += bench_lens[i];
+        }
+    );
+
+    bench_fill_uint64_t(dist);
+    BENCH("neat_parse_u64", "uint64_t", dist,
+        for(size_t i = 0 ; i < n ; i++)
+        {
+            bench_sink += neat_parse_u64(bench_text + bench_offs[i], NULL, UINT64_MAX, &err);
+            b += bench_lens[i];
+        }
+    );
+}
+
+// floats, their text is in the shortest round-trip form, like most producers write
+
+#define BENCH_FLOAT_FUNCS(T, PRI, SCN, STRTO, PARSE_LOW) \
+static size_t bench_fmt_##T(char *buf, size_t i) \
+{ \
+    return neat_##T##2chars(buf, BENCH_MAX_CHARS, &((T *) bench_vals)[i]); \
+} \
+\
+static void bench_##T(const char *dist) \
+{ \
+    T *v = (T *) bench_vals; \
+    size_t n = bench_n; \
+    char buf[BENCH_MAX_CHARS]; \
+    int err; \
+    for(size_t i = 0 ; i < n ; i++) \
+        v[i] = (T) bench_real(dist, sizeof(T)); \
+    bench_make_text(bench_fmt_##T); \
+    \
+    BENCH("neat_" #T "2str", #T, dist, \
+        for(size_t i = 0 ; i < n ; i++) \
+        { \
+            char *s = neat_##T##2str(&v[i]); \
+            b += strlen(s); \
+            free(s); \
+        } \
+    ); \
+    BENCH("neat_" #T "2chars", #T, dist, \
+        for(size_t i = 0 ; i < n ; i++) \
+        { \
+            b += neat_##T##2chars(buf, sizeof(buf), &v[i]); \
+            bench_sink += (unsigned char) buf[0]; \
+        } \
+    ); \
+    BENCH("snprintf " PRI, #T, dist, \
+        for(size_t i = 0 ; i < n ; i++) \
+        { \
+            b += (size_t) snprintf(buf, sizeof(buf), PRI, v[i]); \
+            bench_sink += (unsigned char) buf[0]; \
+        } \
+    ); \
+    BENCH("snprintf %g", #T, dist, \
+        for(size_t i = 0 ; i < n ; i++) \
+        { \
+            b += (size_t) snprintf(buf, sizeof(buf), "%g", v[i]); \
+            bench_sink += (unsigned char) buf[0]; \
+        } \
+    ); \
+    BENCH("neat_parse_" #T, #T, dist, \
+        for(size_t i = 0 ; i < n ; i++) \
+        { \
+            bench_fsink += neat_parse_##T(bench_text + bench_offs[i], &err); \
+            b += bench_lens[i]; \
+        } \
+    ); \
+    BENCH("neat_parse_n_" #T, #T, dist, \
+        for(size_t i = 0 ; i < n ; i++) \
+        { \
+            bench_fsink += neat_parse_n_##T(bench_text + bench_offs[i], bench_lens[i], &err); \
+            b += bench_lens[i]; \
+        } \
+    ); \
+    BENCH(#PARSE_LOW, #T, dist, \
+        for(size_t i = 0 ; i < n ; i++) \
+        { \
+            bench_fsink += PARSE_LOW(bench_text + bench_offs[i], NULL, &err); \
+            b += bench_lens[i]; \
+        } \
+    ); \
+    BENCH(#STRTO, #T, dist, \
+        for(size_t i = 0 ; i < n ; i++) \
+        { \
+            bench_fsink += STRTO(bench_text + bench_offs[i], NULL); \
+            b += bench_lens[i]; \
+        } \
+    ); \
+    BENCH("sscanf", #T, dist, \
+        for(size_t i = 0 ; i < n ; i++) \
+        { \
+            T x = 0; \
+            sscanf(bench_text + bench_offs[i], SCN, &x); \
+            bench_fsink += x; \
+            b += bench_lens[i]; \
+        } \
+    ); \
+    BENCH("neat_parse_array_" #T, #T, dist, \
+        neat_parse_array_result r = neat_parse_array_##T(bench_csv, bench_text_len - 1, ',', (T *) bench_parsed, n); \
+        bench_sink += r.count; \
+        b += bench_text_len; \
+    ); \
+}
+
+BENCH_FLOAT_FUNCS(float,  "%.9g",  "%f",  strtof, neat_parse_f32)
+BENCH_FLOAT_FUNCS(double, "%.17g", "%lf", strtod, neat_parse_f64)
+
+#ifdef BENCH_REF_DTOA
+static void bench_ref(const char *dist)
+{
+    double *v = (double *) bench_vals;
+    size_t n = bench_n;
+    char buf[BENCH_MAX_CHARS];
+
+    for(size_t i = 0 ; i < n ; i++)
+        v[i] = bench_real(dist, sizeof(double));
+    BENCH(#BENCH_REF_DTOA, "double", dist,
+        for(size_t i = 0 ; i < n ; i++)
+        {
+            b += (size_t) BENCH_REF_DTOA(v[i], buf);
+            bench_sink += (unsigned char) buf[0];
+        }
+    );
+}
+#endif
+
+// char, bool and strings
+
+static void bench_misc(void)
+{
+    char *c = (char *) bench_vals;
+    bool *t = (bool *) bench_vals;
+    char **s = (char **) bench_parsed;
+    size_t n = bench_n;
+    char buf[BENCH_MAX_CHARS];
+    int err;
+
+    for(size_t i = 0 ; i < n ; i++)
+        c[i] = (char) ('a' + bench_rand() % 26);
+    BENCH("neat_char2str", "char", "letters",
+        for(size_t i = 0 ; i < n ; i++)
+        {
+            char *str = neat_char2str(&c[i]);
+            b += 1;
+            free(str);
+        }
+    );
+    BENCH("neat_char2chars", "char", "letters",
+        for(size_t i = 0 ; i < n ; i++)
+        {
+            b += neat_char2chars(buf, sizeof(buf), &c[i]);
+            bench_sink += (unsigned char) buf[0];
+        }
+    );
+    BENCH("neat_parse_char", "char", "letters",
+        for(size_t i = 0 ; i < n ; i++)
+        {
+            char str[2] = { c[i], '\0' };
+            bench_sink += (uint64_t) neat_parse_char(str, &err);
+            b += 1;
+        }
+    );
+
+    for(size_t i = 0 ; i < n ; i++)
+        t[i] = bench_rand() & 1;
+    BENCH("neat_bool2str", "bool", "mixed",
+        for(size_t i = 0 ; i < n ; i++)
+        {
+            char *str = neat_bool2str(&t[i]);
+            b += strlen(str);
+            free(str);
+        }
+    );
+    BENCH("neat_bool2chars", "bool", "mixed",
+        for(size_t i = 0 ; i < n ; i++)
+        {
+            b += neat_bool2chars(buf, sizeof(buf), &t[i]);
+            bench_sink += (unsigned char) buf[0];
+        }
+    );
+    BENCH("neat_parse_bool", "bool", "mixed",
+        for(size_t i = 0 ; i < n ; i++)
+        {
+            char *str = t[i] ? "true" : "false";
+            bench_sink += neat_parse_bool(str, &err);
+            b += 5 - t[i];
+        }
+    );
+
+    // words of 3 to 12 letters
+    size_t pos = 0;
+    for(size_t i = 0 ; i < n ; i++)
+    {
+        bench_offs[i] = pos;
+        bench_lens[i] = 3 + bench_rand() % 10;
+        for(size_t j = 0 ; j < bench_lens[i] ; j++)
+            bench_text[pos++] = (char) ('a' + bench_rand() % 26);
+        bench_text[pos++] = '\0';
+        s[i] = bench_text + bench_offs[i];
+    }
+    BENCH("neat_str2str", "char*", "words",
+        for(size_t i = 0 ; i < n ; i++)
+        {
+            char *str = neat_str2str(s[i]);
+            b += bench_lens[i];
+            free(str);
+        }
+    );
+    BENCH("neat_str2chars", "char*", "words",
+        for(size_t i = 0 ; i < n ; i++)
+        {
+            b += neat_str2chars(buf, sizeof(buf), s[i]);
+            bench_sink += (unsigned char) buf[0];
+        }
+    );
+    BENCH("neat_parse_str", "char*", "words",
+        for(size_t i = 0 ; i < n ; i++)
+        {
+            // returns the string itself, nothing to free
+            bench_sink += (uint64_t) (uintptr_t) neat_parse_str(s[i], &err);
+            b += bench_lens[i];
+        }
+    );
+    BENCH("strdup", "char*", "words",
+        for(size_t i = 0 ; i < n ; i++)
+        {
+            char *str = strdup(s[i]);
+            b += bench_lens[i];
+            free(str);
+        }
+    );
+}
+
+// whole arrays and print
+
+// appends every value with snprintf, like a hand written array_to_string
+static char *bench_snprintf_array(const char *fmt_first, const char *fmt_rest, const void *arr, bool is_double, size_t *len)
+{
+    size_t cap = bench_n * BENCH_MAX_CHARS + 3;
+    char *ret = (malloc)(cap);
+    size_t pos = (size_t) sprintf(ret, "{");
+    for(size_t i = 0 ; i < bench_n ; i++)
+    {
+        const char *fmt = i == 0 ? fmt_first : fmt_rest;
+        if(is_double) pos += (size_t) snprintf(ret + pos, cap - pos, fmt, ((const double *) arr)[i]);
+        else          pos += (size_t) snprintf(ret + pos, cap - pos, fmt, ((const int32_t *) arr)[i]);
+    }
+    pos += (size_t) sprintf(ret + pos, "}");
+    *len = pos;
+    return ret;
+}
+
+static void bench_arrays(void)
+{
+    int32_t *ints = (int32_t *) bench_vals;
+    double *doubles = (double *) bench_parsed;
+    size_t n = bench_n;
+    size_t cap = n * BENCH_MAX_CHARS + 3;
+    char *buf = (malloc)(cap);
+
+    for(size_t i = 0 ; i < n ; i++)
+    {
+        ints[i] = (int32_t) bench_int("full", 4);
+        doubles[i] = bench_real("random", sizeof(double));
+    }
+
+    BENCH("array_to_string", "int32_t", "full",
+        char *str = array_to_string(ints, n);
+        b += strlen(str);
+        free(str);
+    );
+    BENCH("array_to_chars", "int32_t", "full",
+        b += array_to_chars(buf, cap, ints, n);
+    );
+    BENCH("snprintf loop", "int32_t", "full",
+        size_t len;
+        char *str = bench_snprintf_array("%" PRId32, ", %" PRId32, ints, false, &len);
+        b += len;
+        (free)(str);
+    );
+    BENCH("array_to_string", "double", "random",
+        char *str = array_to_string(doubles, n);
+        b += strlen(str);
+        free(str);
+    );
+    BENCH("array_to_string %.3f", "double", "random",
+        neat_array_fmt fmt = NEAT_ARRAY_FMT_DEFAULT;
+        fmt.precision = 3;
+        char *str = array_to_string(doubles, n, fmt);
+        b += strlen(str);
+        free(str);
+    );
+    BENCH("snprintf loop %.17g", "double", "random",
+        size_t len;
+        char *str = bench_snprintf_array("%.17g", ", %.17g", doubles, true, &len);
+        b += len;
+        (free)(str);
+    );
+    BENCH("snprintf loop %.3f", "double", "random",
+        size_t len;
+        char *str = bench_snprintf_array("%.3f", ", %.3f", doubles, true, &len);
+        b += len;
+        (free)(str);
+    );
+
+#ifdef NEAT_TOSTR_THREADS
+    long cores = sysconf(_SC_NPROCESSORS_ONLN);
+    BENCH("array_to_string threads", "double", "random",
+        neat_array_fmt fmt = NEAT_ARRAY_FMT_DEFAULT;
+        fmt.nthreads = cores > 1 ? (int) cores : 1;
+        char *str = array_to_string(doubles, n, fmt);
+        b += strlen(str);
+        free(str);
+    );
+#endif
+
+    // the output goes to /dev/null, so it's formatting and stdio that's timed
+    size_t ints_len = array_to_chars(NULL, 0, ints, n);
+    size_t doubles_len = array_to_chars(NULL, 0, doubles, n);
+    BENCH("fprint_array", "int32_t", "full",
+        fprint_array(bench_devnull, ints, n);
+        b += ints_len;
+    );
+    BENCH("fprintf loop", "int32_t", "full",
+        for(size_t i = 0 ; i < n ; i++)
+            b += (size_t) fprintf(bench_devnull, i == 0 ? "{%" PRId32 : ", %" PRId32, ints[i]);
+    );
+    BENCH("fprint_array", "double", "random",
+        fprint_array(bench_devnull, doubles, n);
+        b += doubles_len;
+    );
+    BENCH("fprintf loop", "double", "random",
+        for(size_t i = 0 ; i < n ; i++)
+            b += (size_t) fprintf(bench_devnull, i == 0 ? "{%.17g" : ", %.17g", doubles[i]);
+    );
+
+    // a log line per value, with a string, integers, a double and a bool
+    char *names[4] = { "alice", "bob", "carol", "dave" };
+    size_t neat_line_bytes = 0, printf_line_bytes = 0;
+    for(size_t i = 0 ; i < n ; i++)
+    {
+        char price[BENCH_MAX_CHARS];
+        neat_double2chars(price, sizeof(price), &doubles[i]);
+        const char *ok = ints[i] & 1 ? "true" : "false";
+        int64_t ts = 1700000000000 + (int64_t) i;
+        neat_line_bytes += (size_t) snprintf(NULL, 0, "ts=%" PRId64 " id=%" PRId32 " user=%s price=%s ok=%s\n",
+                                             ts, ints[i], names[i & 3], price, ok);
+        printf_line_bytes += (size_t) snprintf(NULL, 0, "ts=%" PRId64 " id=%" PRId32 " user=%s price=%.17g ok=%s\n",
+                                               ts, ints[i], names[i & 3], doubles[i], ok);
+    }
+    BENCH("fprintln mixed", "mixed", "log",
+        for(size_t i = 0 ; i < n ; i++)
+        {
+            int64_t ts = 1700000000000 + (int64_t) i;
+            bool ok = ints[i] & 1;
+            fprintln(bench_devnull, "ts=", ts, " id=", ints[i], " user=", names[i & 3], " price=", doubles[i], " ok=", ok);
+        }
+        b += neat_line_bytes;
+    );
+    BENCH("fprintf mixed", "mixed", "log",
+        for(size_t i = 0 ; i < n ; i++)
+        {
+            int64_t ts = 1700000000000 + (int64_t) i;
+            bool ok = ints[i] & 1;
+            fprintf(bench_devnull, "ts=%" PRId64 " id=%" PRId32 " user=%s price=%.17g ok=%s\n",
+                    ts, ints[i], names[i & 3], doubles[i], ok ? "true" : "false");
+        }
+        b += printf_line_bytes;
+    );
+
+    (free)(buf);
+}
+
+int main(int argc, char **argv)
+{
+    bench_n = BENCH_DEFAULT_N;
+    for(int i = 1 ; i < argc ; i++)
+    {
+        if(strcmp(argv[i], "-csv") == 0) bench_out_format = BENCH_CSV;
+        else if(strcmp(argv[i], "-json") == 0) bench_out_format = BENCH_JSON;
+        else if(strcmp(argv[i], "-n") == 0 && i + 1 < argc) bench_n = strtoull(argv[++i], NULL, 10);
+        else if(strcmp(argv[i], "-filter") == 0 && i + 1 < argc) bench_filter = argv[++i];
+        else
+        {
+            fprintf(stderr, "usage: %s [-csv | -json] [-n count] [-filter text]\n", argv[0]);
+            return 1;
+        }
+    }
+    if(bench_n == 0) bench_n = 1;
+
+    bench_vals = (malloc)(bench_n * sizeof(uint64_t));
+    bench_parsed = (malloc)(bench_n * sizeof(uint64_t));
+    bench_text = (malloc)(bench_n * BENCH_MAX_CHARS);
+    bench_csv = (malloc)(bench_n * BENCH_MAX_CHARS);
+    bench_offs = (malloc)(bench_n * sizeof(size_t));
+    bench_lens = (malloc)(bench_n * sizeof(size_t));
+    bench_devnull = fopen("/dev/null", "w");
+    if(!bench_vals || !bench_parsed || !bench_text || !bench_csv || !bench_offs || !bench_lens || !bench_devnull)
+    {
+        fprintf(stderr, "out of memory\n");
+        return 1;
+    }
+
+    const char *int_dists[] = { "small", "full", "timestamp" };
+    for(size_t d = 0 ; d < 3 ; d++)
+    {
+        // timestamps don't fit in 8 and 16 bits
+        if(d < 2)
+        {
+            bench_int8_t(int_dists[d]);
+            bench_int16_t(int_dists[d]);
+            bench_uint8_t(int_dists[d]);
+            bench_uint16_t(int_dists[d]);
+        }
+        bench_int32_t(int_dists[d]);
+        bench_int64_t(int_dists[d]);
+        bench_uint32_t(int_dists[d]);
+        bench_uint64_t(int_dists[d]);
+        bench_parse_i64_u64(int_dists[d]);
+    }
+
+    const char *float_dists[] = { "small", "random", "full", "timestamp" };
+    for(size_t d = 0 ; d < 4 ; d++)
+    {
+        bench_float(float_dists[d]);
+        bench_double(float_dists[d]);
+#ifdef BENCH_REF_DTOA
+        bench_ref(float_dists[d]);
+#endif
+    }
+
+    bench_misc();
+    bench_arrays();
+
+    if(bench_out_format == BENCH_JSON) printf(bench_first_row ? "[]\n" : "\n]\n");
+
+    fclose(bench_devnull);
+    (free)(bench_vals);
+    (free)(bench_parsed);
+    (free)(bench_text);
+    (free)(bench_csv);
+    (free)(bench_offs);
+    (free)(bench_lens);
+    return 0;
+}
@@ -0,0 +1,52 @@
+#!/bin/sh
+# Compile-time cost of print: generates a TU with many println calls of 1 to 20 args
+# and reports its preprocessed size and how long it takes to compile.
+#
+#   sh bench/compile_time.sh [calls] [compiler]
+#
+# Run it before and after a change to print's macros to compare. Defaults are 200 calls and cc.
+
+set -e
+
+calls=${1:-200}
+cc=${2:-cc}
+root=$(cd "$(dirname "$0")/.." && pwd)
+tmp=$(mktemp -d)
+trap 'rm -rf "$tmp"' EXIT
+
+# the same pseudo-random mix of arg types every run
+awk -v calls="$calls" 'BEGIN {
+    split("a b (char*)s u x t c l", args, " ")
+    print "#include \"neat_tostr.h\""
+    print "void f(int a, double b, const char *s, uint64_t u, float x, bool t, char c, int64_t l);"
+    print "void f(int a, double b, const char *s, uint64_t u, float x, bool t, char c, int64_t l)"
+    print "{"
+    seed = 1
+    for(i = 0 ; i < calls ; i++)
+    {
+        seed = (seed * 1103515245 + 12345) % 2147483648
+        n = 1 + seed % 20
+        line = "    println("
+        for(j = 0 ; j < n ; j++)
+        {
+            seed = (seed * 1103515245 + 12345) % 2147483648
+            line = line (j ? ", " : "") args[1 + int(seed / 65536) % 8]
+        }
+        print line ");"
+    }
+    print "}"
+}' > "$tmp/bench.c"
+
+now() { date +%s.%N; }
+
+bytes=$($cc -std=gnu11 -I"$root" -E "$tmp/bench.c" | wc -c)
+echo "calls:        $calls"
+echo "preprocessed: $bytes bytes"
+
+for opt in -O0 -O2
+do
+    start=$(now)
+    $cc -std=gnu11 $opt -I"$root" -c "$tmp/bench.c" -o "$tmp/bench.o"
+    end=$(now)
+    echo "compile $opt:  $(echo "$start $end" | awk '{ printf "%.2f", $2 - $1 }') s"
+done
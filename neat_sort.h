@@ -39,6 +39,32 @@
         
         You can also define SORTABLE_TYPES2 and SORTABLE_TYPES3.
         
+        Struct types that are ordered field by field don't need a
+        hand-written compare function:
+            
+            #define SORTABLE_TYPES ADD_SORTABLE_FIELDS(Order)
+            #include "neat_sort.h"
+            
+            typedef struct Order { int32_t prio; uint64_t ts; } Order;
+            DEFINE_SORTABLE_FIELDS(Order, (prio, DESC), (ts, ASC))
+            
+        DEFINE_SORTABLE_FIELDS has to come after the struct is
+        complete, and before it's sorted. The type must be a single
+        identifier (typedef it), the fields must be of the numeric
+        types, bool or char, and there can be up to 16 of them.
+        It generates (as static inline functions):
+            
+            int neat_Order_fields_cmp(const Order *a, const Order *b);
+              The lexicographic compare function.
+              
+            void neat_Order_key(const Order *v, uint8_t *out);
+              Writes neat_Order_key_size bytes to out. Comparing two
+              of these keys with memcmp gives the same order as
+              neat_Order_fields_cmp.
+              
+        Such types can also be radix sorted on their key, which
+        doesn't call any compare function (see SORT_BY_KEY).
+        
         From here on out I'll refer to a sortable type by S.
         
         Functions (actually macros):
@@ -81,10 +107,208 @@
                   of length n.
                   Returns a pointer to it if found, NULL otherwise.
                   
+            ISEARCH:
+                S *ISEARCH(S[], S k);
+                  Like BSEARCH, but does interpolation search. Only for
+                  the numeric types. On uniformly distributed data it
+                  needs a handful of probes instead of log2(n); if the
+                  probes don't narrow the range enough (skewed data)
+                  it falls back to binary search.
+                  
+            ISEARCH_PTR:
+                S *ISEARCH_PTR(S*, size_t n, S k);
+                  
+            GALLOP_SEARCH:
+                S *GALLOP_SEARCH(S[], S k, size_t *hint);
+                  Does exponential search for k starting at index *hint,
+                  so it costs O(log d) where d is the distance between
+                  *hint and k. *hint is updated to the index of the
+                  first element >= k, which makes it cheap to look up
+                  sorted keys one after another:
+                      size_t cur = 0;
+                      for(...) p = GALLOP_SEARCH_PTR(arr, n, next_key, &cur);
+                  Returns a pointer to k if found, NULL otherwise.
+                  
+            GALLOP_SEARCH_PTR:
+                S *GALLOP_SEARCH_PTR(S*, size_t n, S k, size_t *hint);
+                  
+            SORT_BY_KEY:
+                void SORT_BY_KEY(S[], S);
+                  Radix sorts the local array on the key generated by
+                  DEFINE_SORTABLE_FIELDS(S, ...). The sort is stable.
+                  
+            SORT_BY_KEY_PTR:
+                void SORT_BY_KEY_PTR(S*, size_t n, S);
+                  
             GET_CMP:
                 int(*)(S*,S*) GET_CMP(S);
                   Returns the compare function associated with the
                   type.
+        
+        String tables:
+            
+            A sorted char* array can be packed into a neat_strtab.
+            Keys are front-coded (each key only stores the bytes it
+            doesn't share with the key before it) in blocks, and the
+            first key of every block is stored whole so the table can
+            be binary searched through its restart points.
+            
+            neat_strtab_build:
+                neat_strtab neat_strtab_build(char **sorted, size_t n, size_t block_size);
+                  Builds a table from n strings sorted by strcmp.
+                  block_size is the number of keys per restart point,
+                  pass 0 for the default (NEAT_STRTAB_DEFAULT_BLOCK).
+                  The input strings aren't referenced afterwards.
+                  
+            neat_strtab_free:
+                void neat_strtab_free(neat_strtab *t);
+                  
+            neat_strtab_find:
+                size_t neat_strtab_find(const neat_strtab *t, const char *key);
+                  Returns the index of key in the table,
+                  NEAT_STRTAB_NPOS if not found.
+                  
+            neat_strtab_lower_bound:
+                size_t neat_strtab_lower_bound(const neat_strtab *t, const char *key);
+                  Returns the index of the first key >= key,
+                  t->count if there is none.
+                  
+            neat_strtab_get:
+                size_t neat_strtab_get(const neat_strtab *t, size_t i, char *buf, size_t cap);
+                  Writes the i-th key into buf (truncated to cap - 1
+                  chars, always NUL terminated) and returns its full
+                  length. t->max_len + 1 is always enough.
+                  
+            neat_strtab_iter_at / neat_strtab_prefix:
+                neat_strtab_iter neat_strtab_iter_at(const neat_strtab *t, size_t i);
+                neat_strtab_iter neat_strtab_prefix(const neat_strtab *t, const char *prefix);
+                  Make an iterator starting at index i, or over all keys
+                  starting with prefix. Use it like so:
+                  
+                    neat_strtab_iter it = neat_strtab_prefix(&t, "ab");
+                    while(neat_strtab_next(&it))
+                        use(it.index, it.str, it.len);
+                    neat_strtab_iter_free(&it);
+        
+        Heaps (priority queues):
+            
+            neat_heap(S) is a growable heap of S ordered by the
+            compare function of S. The top is the smallest element,
+            or the largest one for a descending heap.
+            
+                neat_heap(int) h = {0};                    // binary min-heap
+                neat_heap(int) h4 = HEAP_INIT(4, false);   // 4-ary min-heap
+                neat_heap(int) hd = HEAP_INIT(2, true);    // binary max-heap
+            
+            4-ary heaps are shallower and keep all children of a node
+            next to each other, which is friendlier to the cache when
+            the heap is large.
+            To pass a heap around, typedef it first:
+                typedef neat_heap(job) job_heap;
+            
+            HEAP_PUSH:
+                void HEAP_PUSH(neat_heap(S) h, S v);
+                  
+            HEAP_POP:
+                S HEAP_POP(neat_heap(S) h);
+                  Removes the top element and returns it.
+                  The heap must not be empty.
+                  
+            HEAP_PEEK:
+                S HEAP_PEEK(neat_heap(S) h);
+                  Returns the top element without removing it.
+                  
+            HEAP_LEN:
+                size_t HEAP_LEN(neat_heap(S) h);
+                  
+            HEAP_FROM_ARRAY:
+                void HEAP_FROM_ARRAY(neat_heap(S) h, S *arr, size_t n);
+                  Replaces the contents of h with arr in O(n).
+                  
+            HEAP_FREE:
+                void HEAP_FREE(neat_heap(S) h);
+            
+            Index-tracked heaps:
+                Elements pushed with an id (any number, preferably
+                small and dense, e.g. a vertex index) can be found
+                and re-prioritized later.
+                
+                HEAP_PUSH_ID:
+                    void HEAP_PUSH_ID(neat_heap(S) h, size_t id, S v);
+                      If id is already in the heap its element is
+                      replaced with v (like HEAP_UPDATE), an id is
+                      never in the heap twice.
+                    
+                HEAP_TOP_ID:
+                    size_t HEAP_TOP_ID(neat_heap(S) h);
+                      Returns the id of the top element,
+                      NEAT_HEAP_NO_ID if it was pushed without one.
+                    
+                HEAP_CONTAINS:
+                    bool HEAP_CONTAINS(neat_heap(S) h, size_t id);
+                    
+                HEAP_GET:
+                    S HEAP_GET(neat_heap(S) h, size_t id);
+                    
+                HEAP_DECREASE_KEY:
+                    void HEAP_DECREASE_KEY(neat_heap(S) h, size_t id, S v);
+                      Replaces the element with v, which must not
+                      come after it in the heap's order.
+                      
+                HEAP_UPDATE:
+                    void HEAP_UPDATE(neat_heap(S) h, size_t id, S v);
+                      Replaces the element with v, in any direction.
+                
+                HEAP_GET, HEAP_DECREASE_KEY and HEAP_UPDATE don't
+                check id, it must be in the heap (see HEAP_CONTAINS).
+                Popping an element or replacing the contents with
+                HEAP_FROM_ARRAY removes its id.
+        
+        Flat maps:
+            
+            neat_flatmap(K, V) maps a sortable K to any V. Keys and
+            values live in two separate sorted arrays (m.keys and
+            m.vals, of length m.len), so a lookup only touches keys.
+            To pass a map around, typedef it first:
+                typedef neat_flatmap(uint64_t, double) price_map;
+            
+            FLATMAP_BUILD:
+                void FLATMAP_BUILD(neat_flatmap(K, V) m, K *keys, V *vals, size_t n);
+                  Replaces the contents of m with the n pairs,
+                  sorted by key. If a key is repeated the last
+                  pair wins.
+                  
+            FLATMAP_FIND:
+                V *FLATMAP_FIND(neat_flatmap(K, V) m, K k);
+                  Returns a pointer to the value of k, NULL if
+                  k isn't in the map.
+                  
+            FLATMAP_LOWER_BOUND / FLATMAP_UPPER_BOUND:
+                size_t FLATMAP_LOWER_BOUND(neat_flatmap(K, V) m, K k);
+                  Index of the first key >= k (> k for upper bound),
+                  m.len if there's none. The keys in [lo, hi) are
+                  from FLATMAP_LOWER_BOUND(m, lo) up to
+                  FLATMAP_LOWER_BOUND(m, hi).
+                  
+            FLATMAP_INSERT:
+                void FLATMAP_INSERT(neat_flatmap(K, V) m, K k, V v);
+                  Inserts or overwrites one pair, O(n). For many
+                  pairs prefer FLATMAP_BUILD or FLATMAP_MERGE.
+                  
+            FLATMAP_MERGE:
+                void FLATMAP_MERGE(neat_flatmap(K, V) dst, neat_flatmap(K, V) a, neat_flatmap(K, V) b);
+                  Merges a and b into dst in O(a.len + b.len).
+                  On equal keys the value of b wins. dst may be
+                  a or b.
+                  
+            FLATMAP_FREE:
+                void FLATMAP_FREE(neat_flatmap(K, V) m);
+            
+            GET_LOWER_BOUND:
+                size_t(*)(const void*, size_t, const void*, size_t, cmp_func, bool) GET_LOWER_BOUND(S);
+                  Returns the branchless binary search used by the
+                  flat map for S. The numeric types have their own
+                  that don't go through the compare function.
 */
 
 #ifndef NEAT_SORT_H
@@ -93,9 +317,12 @@
 #include <stdlib.h>
 #include <string.h>
 #include <stdint.h>
+#include <stdbool.h>
 
 #define ADD_SORTABLE(type, cmp_function) type: cmp_function
 
+#define ADD_SORTABLE_FIELDS(type) ADD_SORTABLE(type, neat_##type##_fields_cmp)
+
 #define DEFAULT_SORTABLE_TYPES \
 ADD_SORTABLE(uint8_t,  neat_uint8_t_cmp), \
 ADD_SORTABLE(uint16_t, neat_uint16_t_cmp), \
@@ -168,6 +395,8 @@ NEAT_USER_SORTABLE_TYPES
 
 typedef int (*cmp_func)(const void*, const void*);
 
+typedef size_t (*neat_lower_bound_func)(const void *base, size_t n, const void *key, size_t elm_size, cmp_func cmp, bool upper);
+
 #define NEAT_ARRLEN(arr) (sizeof(arr) / sizeof(*arr))
 
 #define GET_CMP(type) ((cmp_func) _Generic((typeof(type)){0}, ALL_SORTABLE_TYPES))
@@ -201,9 +430,380 @@ REVERSE_ARRAY_PTR(arr, n); \
 
 #define SEARCH(arr, key) SEARCH_PTR(arr, NEAT_ARRLEN(arr), key)
 
+#define ISEARCH_PTR(arr, n, key) \
+_Generic(*(arr), \
+    uint8_t:  neat_uint8_t_isearch, \
+    uint16_t: neat_uint16_t_isearch, \
+    uint32_t: neat_uint32_t_isearch, \
+    uint64_t: neat_uint64_t_isearch, \
+    int8_t:   neat_int8_t_isearch, \
+    int16_t:  neat_int16_t_isearch, \
+    int32_t:  neat_int32_t_isearch, \
+    int64_t:  neat_int64_t_isearch, \
+    float:    neat_float_isearch, \
+    double:   neat_double_isearch \
+)(arr, n, key)
+
+#define ISEARCH(arr, key) ISEARCH_PTR(arr, NEAT_ARRLEN(arr), key)
+
+#define GALLOP_SEARCH_PTR(arr, n, key, hint) \
+(typeof(*arr)*) neat_gallop_search(&(typeof(*arr)[]){key}[0], arr, n, sizeof(*arr), GET_CMP(*arr), GET_LOWER_BOUND(*arr), hint)
+
+#define GALLOP_SEARCH(arr, key, hint) GALLOP_SEARCH_PTR(arr, NEAT_ARRLEN(arr), key, hint)
+
+#define NEAT_STRTAB_DEFAULT_BLOCK 16
+#define NEAT_STRTAB_NPOS ((size_t)-1)
+
+typedef struct neat_strtab
+{
+    uint8_t *blob;      // front-coded keys: varint(shared) varint(unshared) bytes
+    size_t blob_len;
+    size_t *restarts;   // offset in blob of the first key of every block
+    size_t nblocks;
+    size_t count;       // number of keys
+    size_t block_size;  // keys per block
+    size_t max_len;     // length of the longest key
+} neat_strtab;
+
+typedef struct neat_strtab_iter
+{
+    const neat_strtab *t;
+    const uint8_t *pos; // next entry to decode
+    size_t next;        // index of the next entry
+    size_t index;       // index of the current key
+    char *str;          // the current key, NUL terminated
+    size_t len;
+    const char *prefix; // stop at the first key without this prefix (may be NULL)
+    size_t prefix_len;
+} neat_strtab_iter;
+
+#define NEAT_HEAP_NO_ID ((size_t)-1)
+
+typedef struct neat_heap_state
+{
+    size_t len;
+    size_t cap;
+    unsigned arity;     // 0 means 2
+    bool desc;
+    size_t *ids;        // ids[slot], only allocated once an id is pushed
+    size_t *pos;        // pos[id] = slot + 1, 0 if id isn't in the heap
+    size_t npos;
+} neat_heap_state;
+
+#define neat_heap(type) struct { type *items; neat_heap_state st; }
+
+#define HEAP_INIT(arity_, desc_) { .st = { .arity = (arity_), .desc = (desc_) } }
+
+#define HEAP_LEN(h) ((h).st.len)
+
+#define HEAP_PEEK(h) ((h).items[0])
+
+#define HEAP_PUSH_ID(h, id, value) do { \
+neat_heap_reserve((void**) &(h).items, &(h).st, sizeof(*(h).items), (h).st.len + 1); \
+(h).items[(h).st.len] = (value); \
+neat_heap_push_f((h).items, &(h).st, sizeof(*(h).items), GET_CMP(*(h).items), id); \
+} while(0)
+
+#define HEAP_PUSH(h, value) HEAP_PUSH_ID(h, NEAT_HEAP_NO_ID, value)
+
+#define HEAP_POP(h) \
+(neat_heap_pop_f((h).items, &(h).st, sizeof(*(h).items), GET_CMP(*(h).items)), (h).items[(h).st.len])
+
+#define HEAP_FROM_ARRAY(h, arr, n) do { \
+size_t neat_n = (n); \
+neat_heap_reserve((void**) &(h).items, &(h).st, sizeof(*(h).items), neat_n); \
+for(size_t neat_iter = 0 ; neat_iter < neat_n ; neat_iter++) (h).items[neat_iter] = (arr)[neat_iter]; \
+(h).st.len = neat_n; \
+neat_heapify_f((h).items, &(h).st, sizeof(*(h).items), GET_CMP(*(h).items)); \
+} while(0)
+
+#define HEAP_TOP_ID(h) ((h).st.ids ? (h).st.ids[0] : NEAT_HEAP_NO_ID)
+
+#define HEAP_CONTAINS(h, id) ((size_t)(id) < (h).st.npos && (h).st.pos[id] != 0)
+
+#define HEAP_GET(h, id) ((h).items[(h).st.pos[id] - 1])
+
+#define HEAP_DECREASE_KEY(h, id, value) do { \
+size_t neat_slot = (h).st.pos[id] - 1; \
+(h).items[neat_slot] = (value); \
+neat_heap_sift_up((h).items, &(h).st, neat_slot, sizeof(*(h).items), GET_CMP(*(h).items)); \
+} while(0)
+
+#define HEAP_UPDATE(h, id, value) do { \
+size_t neat_slot = (h).st.pos[id] - 1; \
+(h).items[neat_slot] = (value); \
+neat_heap_fix_f((h).items, &(h).st, neat_slot, sizeof(*(h).items), GET_CMP(*(h).items)); \
+} while(0)
+
+#define HEAP_FREE(h) do { \
+free((h).items); \
+free((h).st.ids); \
+free((h).st.pos); \
+(h).items = NULL; \
+(h).st = (neat_heap_state){ .arity = (h).st.arity, .desc = (h).st.desc }; \
+} while(0)
+
+#define neat_flatmap(key_type, val_type) struct { key_type *keys; val_type *vals; size_t len; size_t cap; }
+
+#define GET_LOWER_BOUND(type) \
+_Generic((typeof(type)){0}, \
+    uint8_t:  neat_uint8_t_lower_bound, \
+    uint16_t: neat_uint16_t_lower_bound, \
+    uint32_t: neat_uint32_t_lower_bound, \
+    uint64_t: neat_uint64_t_lower_bound, \
+    int8_t:   neat_int8_t_lower_bound, \
+    int16_t:  neat_int16_t_lower_bound, \
+    int32_t:  neat_int32_t_lower_bound, \
+    int64_t:  neat_int64_t_lower_bound, \
+    float:    neat_float_lower_bound, \
+    double:   neat_double_lower_bound, \
+    default:  neat_lower_bound \
+)
+
+#define neat_flatmap_bound(m, key, upper) \
+GET_LOWER_BOUND(*(m).keys)((m).keys, (m).len, &(typeof(*(m).keys)[]){key}[0], sizeof(*(m).keys), GET_CMP(*(m).keys), upper)
+
+#define FLATMAP_LOWER_BOUND(m, key) neat_flatmap_bound(m, key, false)
+
+#define FLATMAP_UPPER_BOUND(m, key) neat_flatmap_bound(m, key, true)
+
+#define FLATMAP_FIND(m, key) \
+(typeof((m).vals)) neat_flatmap_find_f((m).keys, (m).vals, (m).len, &(typeof(*(m).keys)[]){key}[0], \
+sizeof(*(m).keys), sizeof(*(m).vals), GET_CMP(*(m).keys), GET_LOWER_BOUND(*(m).keys))
+
+#define FLATMAP_BUILD(m, keys_, vals_, n) do { \
+typeof(*(m).keys) *neat_keys = (keys_); \
+typeof(*(m).vals) *neat_vals = (vals_); \
+neat_flatmap_build_f((void**) &(m).keys, (void**) &(m).vals, &(m).len, &(m).cap, neat_keys, neat_vals, (n), \
+sizeof(*(m).keys), sizeof(*(m).vals), GET_CMP(*(m).keys)); \
+} while(0)
+
+#define FLATMAP_INSERT(m, key, val) do { \
+size_t neat_i = neat_flatmap_insert_f((void**) &(m).keys, (void**) &(m).vals, &(m).len, &(m).cap, \
+&(typeof(*(m).keys)[]){key}[0], sizeof(*(m).keys), sizeof(*(m).vals), GET_CMP(*(m).keys), GET_LOWER_BOUND(*(m).keys)); \
+(m).vals[neat_i] = (val); \
+} while(0)
+
+#define FLATMAP_MERGE(dst, a, b) \
+neat_flatmap_merge_f((void**) &(dst).keys, (void**) &(dst).vals, &(dst).len, &(dst).cap, \
+(a).keys, (a).vals, (a).len, (b).keys, (b).vals, (b).len, \
+sizeof(*(dst).keys), sizeof(*(dst).vals), GET_CMP(*(dst).keys))
+
+#define FLATMAP_FREE(m) do { \
+free((m).keys); \
+free((m).vals); \
+(m).keys = NULL; \
+(m).vals = NULL; \
+(m).len = (m).cap = 0; \
+} while(0)
+
+typedef void (*neat_key_func)(const void *elm, uint8_t *out);
+
+#define SORT_BY_KEY_PTR(arr, n, type) \
+neat_sort_by_key(arr, n, sizeof(*arr), neat_##type##_key_size, (neat_key_func) neat_##type##_key)
+
+#define SORT_BY_KEY(arr, type) SORT_BY_KEY_PTR(arr, NEAT_ARRLEN(arr), type)
+
+#define NEAT_FIELD_DIR_ASC 1
+#define NEAT_FIELD_DIR_DESC -1
+
+#define NEAT_FIELDS_NARG(...) \
+NEAT_FIELDS_ARG_N(__VA_ARGS__, 16, 15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0)
+#define NEAT_FIELDS_ARG_N(_1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, _16, N, ...) N
+
+#define NEAT_FIELDS_CAT(a, b) NEAT_FIELDS_CAT_(a, b)
+#define NEAT_FIELDS_CAT_(a, b) a ## b
+#define NEAT_FIELDS_UNPAREN(...) __VA_ARGS__
+#define NEAT_FIELDS_APPLY(m, ...) m(__VA_ARGS__)
+
+// calls m(type, field, dir) for every (field, dir)
+#define NEAT_FOR_EACH_FIELD(m, type, ...) \
+NEAT_FIELDS_CAT(NEAT_FOR_EACH_FIELD_, NEAT_FIELDS_NARG(__VA_ARGS__))(m, type, __VA_ARGS__)
+
+#define NEAT_FOR_EACH_FIELD_1(m, t, f)       NEAT_FIELDS_APPLY(m, t, NEAT_FIELDS_UNPAREN f)
+#define NEAT_FOR_EACH_FIELD_2(m, t, f, ...)  NEAT_FIELDS_APPLY(m, t, NEAT_FIELDS_UNPAREN f) NEAT_FOR_EACH_FIELD_1(m, t, __VA_ARGS__)
+#define NEAT_FOR_EACH_FIELD_3(m, t, f, ...)  NEAT_FIELDS_APPLY(m, t, NEAT_FIELDS_UNPAREN f) NEAT_FOR_EACH_FIELD_2(m, t, __VA_ARGS__)
+#define NEAT_FOR_EACH_FIELD_4(m, t, f, ...)  NEAT_FIELDS_APPLY(m, t, NEAT_FIELDS_UNPAREN f) NEAT_FOR_EACH_FIELD_3(m, t, __VA_ARGS__)
+#define NEAT_FOR_EACH_FIELD_5(m, t, f, ...)  NEAT_FIELDS_APPLY(m, t, NEAT_FIELDS_UNPAREN f) NEAT_FOR_EACH_FIELD_4(m, t, __VA_ARGS__)
+#define NEAT_FOR_EACH_FIELD_6(m, t, f, ...)  NEAT_FIELDS_APPLY(m, t, NEAT_FIELDS_UNPAREN f) NEAT_FOR_EACH_FIELD_5(m, t, __VA_ARGS__)
+#define NEAT_FOR_EACH_FIELD_7(m, t, f, ...)  NEAT_FIELDS_APPLY(m, t, NEAT_FIELDS_UNPAREN f) NEAT_FOR_EACH_FIELD_6(m, t, __VA_ARGS__)
+#define NEAT_FOR_EACH_FIELD_8(m, t, f, ...)  NEAT_FIELDS_APPLY(m, t, NEAT_FIELDS_UNPAREN f) NEAT_FOR_EACH_FIELD_7(m, t, __VA_ARGS__)
+#define NEAT_FOR_EACH_FIELD_9(m, t, f, ...)  NEAT_FIELDS_APPLY(m, t, NEAT_FIELDS_UNPAREN f) NEAT_FOR_EACH_FIELD_8(m, t, __VA_ARGS__)
+#define NEAT_FOR_EACH_FIELD_10(m, t, f, ...) NEAT_FIELDS_APPLY(m, t, NEAT_FIELDS_UNPAREN f) NEAT_FOR_EACH_FIELD_9(m, t, __VA_ARGS__)
+#define NEAT_FOR_EACH_FIELD_11(m, t, f, ...) NEAT_FIELDS_APPLY(m, t, NEAT_FIELDS_UNPAREN f) NEAT_FOR_EACH_FIELD_10(m, t, __VA_ARGS__)
+#define NEAT_FOR_EACH_FIELD_12(m, t, f, ...) NEAT_FIELDS_APPLY(m, t, NEAT_FIELDS_UNPAREN f) NEAT_FOR_EACH_FIELD_11(m, t, __VA_ARGS__)
+#define NEAT_FOR_EACH_FIELD_13(m, t, f, ...) NEAT_FIELDS_APPLY(m, t, NEAT_FIELDS_UNPAREN f) NEAT_FOR_EACH_FIELD_12(m, t, __VA_ARGS__)
+#define NEAT_FOR_EACH_FIELD_14(m, t, f, ...) NEAT_FIELDS_APPLY(m, t, NEAT_FIELDS_UNPAREN f) NEAT_FOR_EACH_FIELD_13(m, t, __VA_ARGS__)
+#define NEAT_FOR_EACH_FIELD_15(m, t, f, ...) NEAT_FIELDS_APPLY(m, t, NEAT_FIELDS_UNPAREN f) NEAT_FOR_EACH_FIELD_14(m, t, __VA_ARGS__)
+#define NEAT_FOR_EACH_FIELD_16(m, t, f, ...) NEAT_FIELDS_APPLY(m, t, NEAT_FIELDS_UNPAREN f) NEAT_FOR_EACH_FIELD_15(m, t, __VA_ARGS__)
+
+#define NEAT_FIELD_SIZE(type, field, dir) + sizeof(((type *) 0)->field)
+
+// evaluates every field (no early return), so the chain compiles to conditional moves
+#define NEAT_FIELD_CMP(type, field, dir) \
+r = r ? r : NEAT_FIELD_DIR_##dir * ((a->field > b->field) - (a->field < b->field));
+
+#define NEAT_FIELD_KEY(type, field, dir) \
+out = _Generic(v->field, \
+    bool:     neat_key_u8, \
+    char:     neat_key_char, \
+    uint8_t:  neat_key_u8, \
+    uint16_t: neat_key_u16, \
+    uint32_t: neat_key_u32, \
+    uint64_t: neat_key_u64, \
+    int8_t:   neat_key_i8, \
+    int16_t:  neat_key_i16, \
+    int32_t:  neat_key_i32, \
+    int64_t:  neat_key_i64, \
+    float:    neat_key_float, \
+    double:   neat_key_double \
+)(out, v->field, NEAT_FIELD_DIR_##dir == -1);
+
+#define DEFINE_SORTABLE_FIELDS(type, ...) \
+enum { neat_##type##_key_size = 0 NEAT_FOR_EACH_FIELD(NEAT_FIELD_SIZE, type, __VA_ARGS__) }; \
+static inline int neat_##type##_fields_cmp(const type *a, const type *b) \
+{ \
+    int r = 0; \
+    NEAT_FOR_EACH_FIELD(NEAT_FIELD_CMP, type, __VA_ARGS__) \
+    return r; \
+} \
+static inline void neat_##type##_key(const type *v, uint8_t *out) \
+{ \
+    NEAT_FOR_EACH_FIELD(NEAT_FIELD_KEY, type, __VA_ARGS__) \
+    (void) out; \
+}
+
+// normalized keys: big endian, sign bit flipped, inverted for descending fields.
+static inline uint8_t *neat_key_u64(uint8_t *out, uint64_t v, bool desc)
+{
+    if(desc) v = ~v;
+    for(int i = 7 ; i >= 0 ; i--) *out++ = (uint8_t) (v >> (i * 8));
+    return out;
+}
+
+static inline uint8_t *neat_key_u32(uint8_t *out, uint32_t v, bool desc)
+{
+    if(desc) v = ~v;
+    for(int i = 3 ; i >= 0 ; i--) *out++ = (uint8_t) (v >> (i * 8));
+    return out;
+}
+
+static inline uint8_t *neat_key_u16(uint8_t *out, uint16_t v, bool desc)
+{
+    if(desc) v = (uint16_t) ~v;
+    *out++ = (uint8_t) (v >> 8);
+    *out++ = (uint8_t) v;
+    return out;
+}
+
+static inline uint8_t *neat_key_u8(uint8_t *out, uint8_t v, bool desc)
+{
+    *out++ = desc ? (uint8_t) ~v : v;
+    return out;
+}
+
+static inline uint8_t *neat_key_i64(uint8_t *out, int64_t v, bool desc) { return neat_key_u64(out, (uint64_t) v ^ ((uint64_t) 1 << 63), desc); }
+static inline uint8_t *neat_key_i32(uint8_t *out, int32_t v, bool desc) { return neat_key_u32(out, (uint32_t) v ^ ((uint32_t) 1 << 31), desc); }
+static inline uint8_t *neat_key_i16(uint8_t *out, int16_t v, bool desc) { return neat_key_u16(out, (uint16_t) ((uint16_t) v ^ 0x8000), desc); }
+static inline uint8_t *neat_key_i8(uint8_t *out, int8_t v, bool desc)   { return neat_key_u8(out, (uint8_t) ((uint8_t) v ^ 0x80), desc); }
+
+static inline uint8_t *neat_key_char(uint8_t *out, char v, bool desc)
+{
+    return (char) -1 < 0 ? neat_key_i8(out, (int8_t) v, desc) : neat_key_u8(out, (uint8_t) v, desc);
+}
+
+static inline uint8_t *neat_key_double(uint8_t *out, double v, bool desc)
+{
+    uint64_t bits;
+    if(v == 0) v = 0; // -0.0 == 0.0
+    memcpy(&bits, &v, sizeof(bits));
+    bits = bits >> 63 ? ~bits : bits | ((uint64_t) 1 << 63);
+    return neat_key_u64(out, bits, desc);
+}
+
+static inline uint8_t *neat_key_float(uint8_t *out, float v, bool desc)
+{
+    uint32_t bits;
+    if(v == 0) v = 0;
+    memcpy(&bits, &v, sizeof(bits));
+    bits = bits >> 31 ? ~bits : bits | ((uint32_t) 1 << 31);
+    return neat_key_u32(out, bits, desc);
+}
+
 #define declare_number_cmp_func(type) int neat_##type##_cmp (const type *a, const type *b)
 #define define_number_cmp_func(type) declare_number_cmp_func(type) { return (*a > *b) - (*b > *a); }
 
+#define NEAT_ISEARCH_MAX_MISSES 2
+
+#define declare_number_isearch(type) type *neat_##type##_isearch(const type *arr, size_t n, type key)
+
+/*
+    Interpolation search, keeping key within [arr[lo], arr[hi]].
+    An interpolated probe only moves one end of the range, so it's
+    followed by a guard probe about sqrt(range) away on the other
+    side, which usually brackets key. A round that doesn't at least
+    halve the range counts as a miss (skewed data), after
+    NEAT_ISEARCH_MAX_MISSES of them the rest is binary searched.
+*/
+#define define_number_isearch(type) declare_number_isearch(type) \
+{ \
+    if(n == 0 || key < arr[0] || key > arr[n - 1]) return NULL; \
+    size_t lo = 0, hi = n - 1; \
+    int misses = 0; \
+    while(hi - lo > 16 && misses < NEAT_ISEARCH_MAX_MISSES) \
+    { \
+        size_t range = hi - lo; \
+        double frac = ((double) key - (double) arr[lo]) / ((double) arr[hi] - (double) arr[lo]); \
+        if(!(frac >= 0.0 && frac <= 1.0)) break; /* infinities, NaN, arr[lo] == arr[hi] */ \
+        size_t pos = lo + (size_t) (frac * (double) range); \
+        size_t guard = (size_t) 1 << (neat_log2(range) / 2); \
+        if(pos > hi) pos = hi; \
+        if(arr[pos] == key) return (type *) &arr[pos]; \
+        if(arr[pos] < key) \
+        { \
+            lo = pos + 1; \
+            if(hi - lo > guard && arr[lo + guard] >= key) hi = lo + guard; \
+            else if(hi - lo > guard) lo += guard + 1; \
+        } \
+        else \
+        { \
+            hi = pos - 1; \
+            if(hi - lo > guard && arr[hi - guard] <= key) lo = hi - guard; \
+            else if(hi - lo > guard) hi -= guard + 1; \
+        } \
+        if(lo > hi || key < arr[lo] || key > arr[hi]) return NULL; \
+        misses += (hi - lo) > range / 2; \
+    } \
+    size_t i = lo + neat_##type##_lower_bound(arr + lo, hi - lo + 1, &key, sizeof(type), NULL, false); \
+    return arr[i] == key ? (type *) &arr[i] : NULL; \
+}
+
+static inline int neat_log2(size_t n)
+{
+    int r = 0;
+    while(n >>= 1) r++;
+    return r;
+}
+
+#define declare_number_lower_bound(type) \
+size_t neat_##type##_lower_bound(const void *base, size_t n, const void *key, size_t elm_size, cmp_func cmp, bool upper)
+
+// branchless: the loop only picks which half to keep, the compiler turns it into a cmov.
+#define define_number_lower_bound(type) declare_number_lower_bound(type) \
+{ \
+    (void) elm_size; (void) cmp; \
+    if(n == 0) return 0; \
+    const type *arr = base, *p = base; \
+    type k = *(const type *) key; \
+    if(upper) \
+    { \
+        while(n > 1) { size_t half = n / 2; p = p[half] <= k ? p + half : p; n -= half; } \
+        return (size_t) (p - arr) + (*p <= k); \
+    } \
+    while(n > 1) { size_t half = n / 2; p = p[half] < k ? p + half : p; n -= half; } \
+    return (size_t) (p - arr) + (*p < k); \
+}
+
 #endif // NEAT_SORT_H
 
 #ifdef NEAT_SORT_IMPLEMENTATION
@@ -223,6 +823,42 @@ int neat_str_cmp(const char **s1, const char **s2)
     return strcmp(*s1, *s2);
 }
 
+define_number_lower_bound(int8_t)
+define_number_lower_bound(uint8_t)
+define_number_lower_bound(int16_t)
+define_number_lower_bound(uint16_t)
+define_number_lower_bound(int32_t)
+define_number_lower_bound(uint32_t)
+define_number_lower_bound(int64_t)
+define_number_lower_bound(uint64_t)
+define_number_lower_bound(float)
+define_number_lower_bound(double)
+
+define_number_isearch(int8_t)
+define_number_isearch(uint8_t)
+define_number_isearch(int16_t)
+define_number_isearch(uint16_t)
+define_number_isearch(int32_t)
+define_number_isearch(uint32_t)
+define_number_isearch(int64_t)
+define_number_isearch(uint64_t)
+define_number_isearch(float)
+define_number_isearch(double)
+
+size_t neat_lower_bound(const void *base, size_t n, const void *key, size_t elm_size, cmp_func cmp, bool upper)
+{
+    if(n == 0) return 0;
+    const uint8_t *arr = base, *p = base;
+    int limit = upper ? 0 : -1; // keep going right while cmp(elm, key) <= limit
+    while(n > 1)
+    {
+        size_t half = n / 2;
+        p = cmp(p + half * elm_size, key) <= limit ? p + half * elm_size : p;
+        n -= half;
+    }
+    return (size_t) (p - arr) / elm_size + (cmp(p, key) <= limit);
+}
+
 void *neat_search(const void *key, const void *base, size_t nmemb, size_t elm_size, cmp_func cmp)
 {
     const uint8_t *arr = (const uint8_t *) base;
@@ -234,6 +870,730 @@ void *neat_search(const void *key, const void *base, size_t nmemb, size_t elm_si
     return NULL;
 }
 
+static uint8_t *neat_strtab_put_varint(uint8_t *p, size_t v)
+{
+    while(v >= 0x80)
+    {
+        *p++ = (uint8_t) (v | 0x80);
+        v >>= 7;
+    }
+    *p++ = (uint8_t) v;
+    return p;
+}
+
+static const uint8_t *neat_strtab_get_varint(const uint8_t *p, size_t *v)
+{
+    size_t ret = 0;
+    int shift = 0;
+    while(*p & 0x80)
+    {
+        ret |= (size_t) (*p++ & 0x7f) << shift;
+        shift += 7;
+    }
+    *v = ret | ((size_t) *p++ << shift);
+    return p;
+}
+
+neat_strtab neat_strtab_build(char **sorted, size_t n, size_t block_size)
+{
+    neat_strtab t = { 0 };
+    t.block_size = block_size == 0 ? NEAT_STRTAB_DEFAULT_BLOCK : block_size;
+    t.count = n;
+    t.nblocks = (n + t.block_size - 1) / t.block_size;
+    t.restarts = malloc((t.nblocks ? t.nblocks : 1) * sizeof(size_t));
+    
+    // size the blob up front so building it is a single pass with no reallocs
+    size_t cap = 0;
+    for(size_t i = 0 ; i < n ; i++)
+    {
+        size_t len = strlen(sorted[i]);
+        if(len > t.max_len) t.max_len = len;
+        cap += len + 2 * 10;
+    }
+    t.blob = malloc(cap ? cap : 1);
+    
+    uint8_t *p = t.blob;
+    const char *prev = "";
+    size_t prev_len = 0;
+    for(size_t i = 0 ; i < n ; i++)
+    {
+        const char *cur = sorted[i];
+        size_t len = strlen(cur);
+        size_t shared = 0;
+        if(i % t.block_size == 0)
+        {
+            t.restarts[i / t.block_size] = (size_t) (p - t.blob);
+        }
+        else
+        {
+            size_t max = len < prev_len ? len : prev_len;
+            while(shared < max && cur[shared] == prev[shared]) shared++;
+        }
+        p = neat_strtab_put_varint(p, shared);
+        p = neat_strtab_put_varint(p, len - shared);
+        memcpy(p, cur + shared, len - shared);
+        p += len - shared;
+        prev = cur;
+        prev_len = len;
+    }
+    t.blob_len = (size_t) (p - t.blob);
+    
+    uint8_t *shrunk = realloc(t.blob, t.blob_len ? t.blob_len : 1);
+    if(shrunk) t.blob = shrunk;
+    
+    return t;
+}
+
+void neat_strtab_free(neat_strtab *t)
+{
+    free(t->blob);
+    free(t->restarts);
+    *t = (neat_strtab){ 0 };
+}
+
+// compares the whole first key of a block with key, strcmp style.
+static int neat_strtab_cmp_restart(const neat_strtab *t, size_t block, const char *key, size_t key_len)
+{
+    size_t shared, len;
+    const uint8_t *p = t->blob + t->restarts[block];
+    p = neat_strtab_get_varint(p, &shared);
+    p = neat_strtab_get_varint(p, &len);
+    
+    int c = memcmp(p, key, len < key_len ? len : key_len);
+    if(c != 0) return c;
+    return (len > key_len) - (len < key_len);
+}
+
+/*
+    Finds the lower bound of key without materializing any key.
+    While scanning a block, m is the length of the common prefix
+    between key and the last decoded key (which is < key). An entry
+    sharing more than m bytes with its predecessor is still < key,
+    one sharing less is > key, and only when it shares exactly m
+    do its suffix bytes need to be looked at.
+*/
+static size_t neat_strtab_seek(const neat_strtab *t, const char *key, int *exact)
+{
+    size_t key_len = strlen(key);
+    *exact = 0;
+    
+    if(t->count == 0)
+    {
+        return 0;
+    }
+    
+    int c = neat_strtab_cmp_restart(t, 0, key, key_len);
+    if(c >= 0)
+    {
+        *exact = c == 0;
+        return 0;
+    }
+    
+    // last block whose first key is < key, duplicates of key may span several blocks
+    size_t lo = 0, hi = t->nblocks;
+    while(hi - lo > 1)
+    {
+        size_t mid = lo + (hi - lo) / 2;
+        if(neat_strtab_cmp_restart(t, mid, key, key_len) < 0)
+            lo = mid;
+        else
+            hi = mid;
+    }
+    
+    size_t idx = lo * t->block_size;
+    size_t end = idx + t->block_size < t->count ? idx + t->block_size : t->count;
+    const uint8_t *p = t->blob + t->restarts[lo];
+    size_t m = 0;
+    
+    for( ; idx < end ; idx++)
+    {
+        size_t shared, unshared;
+        p = neat_strtab_get_varint(p, &shared);
+        p = neat_strtab_get_varint(p, &unshared);
+        
+        if(shared < m)
+        {
+            return idx;
+        }
+        if(shared == m)
+        {
+            size_t j = 0;
+            while(j < unshared && m + j < key_len && p[j] == (uint8_t) key[m + j]) j++;
+            
+            if(j == unshared)
+            {
+                if(m + j == key_len)
+                {
+                    *exact = 1;
+                    return idx;
+                }
+            }
+            else if(m + j == key_len || p[j] > (uint8_t) key[m + j])
+            {
+                return idx;
+            }
+            m += j;
+        }
+        p += unshared;
+    }
+    
+    // every key of the block is < key, the answer is the first key of the next one
+    if(idx < t->count)
+    {
+        *exact = neat_strtab_cmp_restart(t, lo + 1, key, key_len) == 0;
+    }
+    return idx;
+}
+
+size_t neat_strtab_lower_bound(const neat_strtab *t, const char *key)
+{
+    int exact;
+    return neat_strtab_seek(t, key, &exact);
+}
+
+size_t neat_strtab_find(const neat_strtab *t, const char *key)
+{
+    int exact;
+    size_t idx = neat_strtab_seek(t, key, &exact);
+    return exact ? idx : NEAT_STRTAB_NPOS;
+}
+
+size_t neat_strtab_get(const neat_strtab *t, size_t i, char *buf, size_t cap)
+{
+    size_t block = i / t->block_size;
+    const uint8_t *p = t->blob + t->restarts[block];
+    size_t len = 0;
+    
+    for(size_t idx = block * t->block_size ; idx <= i ; idx++)
+    {
+        size_t shared, unshared;
+        p = neat_strtab_get_varint(p, &shared);
+        p = neat_strtab_get_varint(p, &unshared);
+        
+        // bytes past cap - 1 are never needed again, the prefix only shrinks or is rewritten
+        if(shared + unshared > 0 && shared < cap)
+        {
+            size_t copy = shared + unshared < cap ? unshared : cap - 1 - shared;
+            memcpy(buf + shared, p, copy);
+        }
+        len = shared + unshared;
+        p += unshared;
+    }
+    
+    if(cap > 0) buf[len < cap ? len : cap - 1] = '\0';
+    return len;
+}
+
+neat_strtab_iter neat_strtab_iter_at(const neat_strtab *t, size_t i)
+{
+    neat_strtab_iter it = { 0 };
+    it.t = t;
+    it.str = malloc(t->max_len + 1);
+    it.str[0] = '\0';
+    it.next = i;
+    
+    if(i < t->count)
+    {
+        // decode up to (but not including) the i-th key so its shared prefix is in str
+        size_t block = i / t->block_size;
+        it.pos = t->blob + t->restarts[block];
+        for(size_t idx = block * t->block_size ; idx < i ; idx++)
+        {
+            size_t shared, unshared;
+            it.pos = neat_strtab_get_varint(it.pos, &shared);
+            it.pos = neat_strtab_get_varint(it.pos, &unshared);
+            memcpy(it.str + shared, it.pos, unshared);
+            it.len = shared + unshared;
+            it.pos += unshared;
+        }
+    }
+    
+    return it;
+}
+
+neat_strtab_iter neat_strtab_prefix(const neat_strtab *t, const char *prefix)
+{
+    neat_strtab_iter it = neat_strtab_iter_at(t, neat_strtab_lower_bound(t, prefix));
+    it.prefix = prefix;
+    it.prefix_len = strlen(prefix);
+    return it;
+}
+
+bool neat_strtab_next(neat_strtab_iter *it)
+{
+    if(it->next >= it->t->count) return false;
+    
+    size_t shared, unshared;
+    it->pos = neat_strtab_get_varint(it->pos, &shared);
+    it->pos = neat_strtab_get_varint(it->pos, &unshared);
+    memcpy(it->str + shared, it->pos, unshared);
+    it->pos += unshared;
+    it->len = shared + unshared;
+    it->str[it->len] = '\0';
+    
+    if(it->prefix && (it->len < it->prefix_len || memcmp(it->str, it->prefix, it->prefix_len) != 0))
+    {
+        it->next = it->t->count;
+        return false;
+    }
+    
+    it->index = it->next++;
+    return true;
+}
+
+void neat_strtab_iter_free(neat_strtab_iter *it)
+{
+    free(it->str);
+    it->str = NULL;
+}
+
+void neat_heap_reserve(void **items, neat_heap_state *st, size_t elm_size, size_t n)
+{
+    if(n <= st->cap) return;
+    
+    size_t new_cap = st->cap < 8 ? 16 : st->cap * 2;
+    if(new_cap < n) new_cap = n;
+    *items = realloc(*items, new_cap * elm_size);
+    if(st->ids) st->ids = realloc(st->ids, new_cap * sizeof(size_t));
+    st->cap = new_cap;
+}
+
+static inline int neat_heap_before(const neat_heap_state *st, cmp_func cmp, const void *a, const void *b)
+{
+    return st->desc ? cmp(b, a) < 0 : cmp(a, b) < 0;
+}
+
+// moves the id of slot src to slot dst, items are moved by the caller
+static inline void neat_heap_move_id(neat_heap_state *st, size_t dst, size_t src_id)
+{
+    if(!st->ids) return;
+    st->ids[dst] = src_id;
+    if(src_id != NEAT_HEAP_NO_ID) st->pos[src_id] = dst + 1;
+}
+
+/*
+    sifting moves a "hole" instead of swapping, the element being
+    sifted is kept aside and only written once at its final slot.
+*/
+void neat_heap_sift_up(void *items, neat_heap_state *st, size_t i, size_t elm_size, cmp_func cmp)
+{
+    uint8_t *base = items;
+    size_t arity = st->arity ? st->arity : 2;
+    uint8_t small[64];
+    uint8_t *tmp = elm_size <= sizeof(small) ? small : malloc(elm_size);
+    size_t id = st->ids ? st->ids[i] : NEAT_HEAP_NO_ID;
+    
+    memcpy(tmp, base + i * elm_size, elm_size);
+    while(i > 0)
+    {
+        size_t parent = (i - 1) / arity;
+        if(!neat_heap_before(st, cmp, tmp, base + parent * elm_size)) break;
+        memcpy(base + i * elm_size, base + parent * elm_size, elm_size);
+        if(st->ids) neat_heap_move_id(st, i, st->ids[parent]);
+        i = parent;
+    }
+    memcpy(base + i * elm_size, tmp, elm_size);
+    neat_heap_move_id(st, i, id);
+    
+    if(tmp != small) free(tmp);
+}
+
+// returns the final slot of the sifted element
+static size_t neat_heap_sift_down_(void *items, neat_heap_state *st, size_t i, size_t elm_size, cmp_func cmp)
+{
+    uint8_t *base = items;
+    size_t arity = st->arity ? st->arity : 2;
+    size_t len = st->len;
+    uint8_t small[64];
+    uint8_t *tmp = elm_size <= sizeof(small) ? small : malloc(elm_size);
+    size_t id = st->ids ? st->ids[i] : NEAT_HEAP_NO_ID;
+    
+    memcpy(tmp, base + i * elm_size, elm_size);
+    for(;;)
+    {
+        size_t first = i * arity + 1;
+        if(first >= len) break;
+        size_t last = first + arity < len ? first + arity : len;
+        
+        size_t best = first;
+        for(size_t c = first + 1 ; c < last ; c++)
+        {
+            if(neat_heap_before(st, cmp, base + c * elm_size, base + best * elm_size)) best = c;
+        }
+        if(!neat_heap_before(st, cmp, base + best * elm_size, tmp)) break;
+        
+        memcpy(base + i * elm_size, base + best * elm_size, elm_size);
+        if(st->ids) neat_heap_move_id(st, i, st->ids[best]);
+        i = best;
+    }
+    memcpy(base + i * elm_size, tmp, elm_size);
+    neat_heap_move_id(st, i, id);
+    
+    if(tmp != small) free(tmp);
+    return i;
+}
+
+void neat_heap_sift_down(void *items, neat_heap_state *st, size_t i, size_t elm_size, cmp_func cmp)
+{
+    neat_heap_sift_down_(items, st, i, elm_size, cmp);
+}
+
+void neat_heap_fix_f(void *items, neat_heap_state *st, size_t i, size_t elm_size, cmp_func cmp)
+{
+    if(neat_heap_sift_down_(items, st, i, elm_size, cmp) == i)
+    {
+        neat_heap_sift_up(items, st, i, elm_size, cmp);
+    }
+}
+
+// the new element is at items[len]. an id that's already in the heap replaces its element instead.
+void neat_heap_push_f(void *items, neat_heap_state *st, size_t elm_size, cmp_func cmp, size_t id)
+{
+    if(id != NEAT_HEAP_NO_ID && id < st->npos && st->pos[id] != 0)
+    {
+        uint8_t *base = items;
+        size_t slot = st->pos[id] - 1;
+        memcpy(base + slot * elm_size, base + st->len * elm_size, elm_size);
+        neat_heap_fix_f(items, st, slot, elm_size, cmp);
+        return;
+    }
+    
+    size_t i = st->len++;
+    
+    if(id != NEAT_HEAP_NO_ID)
+    {
+        if(!st->ids)
+        {
+            st->ids = malloc(st->cap * sizeof(size_t));
+            for(size_t j = 0 ; j < i ; j++) st->ids[j] = NEAT_HEAP_NO_ID;
+        }
+        if(id >= st->npos)
+        {
+            size_t new_npos = st->npos * 2 > id + 1 ? st->npos * 2 : id + 1;
+            st->pos = realloc(st->pos, new_npos * sizeof(size_t));
+            memset(st->pos + st->npos, 0, (new_npos - st->npos) * sizeof(size_t));
+            st->npos = new_npos;
+        }
+    }
+    if(st->ids) st->ids[i] = id;
+    
+    neat_heap_sift_up(items, st, i, elm_size, cmp);
+}
+
+// moves the top element to items[len - 1] and shrinks the heap by one.
+void neat_heap_pop_f(void *items, neat_heap_state *st, size_t elm_size, cmp_func cmp)
+{
+    uint8_t *base = items;
+    size_t last = --st->len;
+    size_t top_id = st->ids ? st->ids[0] : NEAT_HEAP_NO_ID;
+    
+    if(last > 0)
+    {
+        uint8_t small[64];
+        uint8_t *tmp = elm_size <= sizeof(small) ? small : malloc(elm_size);
+        memcpy(tmp, base, elm_size);
+        memcpy(base, base + last * elm_size, elm_size);
+        memcpy(base + last * elm_size, tmp, elm_size);
+        if(tmp != small) free(tmp);
+        
+        if(st->ids) st->ids[0] = st->ids[last];
+        neat_heap_sift_down_(items, st, 0, elm_size, cmp);
+    }
+    
+    if(st->ids)
+    {
+        st->ids[last] = top_id;
+        if(top_id != NEAT_HEAP_NO_ID) st->pos[top_id] = 0;
+    }
+}
+
+void neat_heapify_f(void *items, neat_heap_state *st, size_t elm_size, cmp_func cmp)
+{
+    size_t arity = st->arity ? st->arity : 2;
+    
+    // tracking doesn't survive having the contents replaced
+    if(st->ids)
+    {
+        for(size_t i = 0 ; i < st->len ; i++) st->ids[i] = NEAT_HEAP_NO_ID;
+        if(st->pos) memset(st->pos, 0, st->npos * sizeof(size_t));
+    }
+    
+    if(st->len < 2) return;
+    
+    for(size_t i = (st->len - 2) / arity + 1 ; i-- > 0 ; )
+    {
+        neat_heap_sift_down_(items, st, i, elm_size, cmp);
+    }
+}
+
+/*
+    LSD radix sort on normalized keys. Every record is the key of an
+    element followed by its index, the elements themselves are only
+    moved once at the end. Byte positions where all keys agree are
+    skipped.
+*/
+#define NEAT_SORT_DONE ((size_t)-1)
+
+void neat_sort_by_key(void *arr, size_t n, size_t elm_size, size_t key_size, neat_key_func key)
+{
+    if(n < 2) return;
+    
+    size_t rec_size = key_size + sizeof(size_t);
+    uint8_t *recs = malloc(n * rec_size);
+    uint8_t *tmp = malloc(n * rec_size);
+    uint8_t *base = arr;
+    
+    for(size_t i = 0 ; i < n ; i++)
+    {
+        key(base + i * elm_size, recs + i * rec_size);
+        memcpy(recs + i * rec_size + key_size, &i, sizeof(size_t));
+    }
+    
+    for(size_t b = key_size ; b-- > 0 ; )
+    {
+        size_t count[256] = { 0 };
+        for(size_t i = 0 ; i < n ; i++) count[recs[i * rec_size + b]]++;
+        if(count[recs[b]] == n) continue;
+        
+        size_t sum = 0;
+        for(int c = 0 ; c < 256 ; c++)
+        {
+            size_t cnt = count[c];
+            count[c] = sum;
+            sum += cnt;
+        }
+        for(size_t i = 0 ; i < n ; i++)
+        {
+            uint8_t *r = recs + i * rec_size;
+            memcpy(tmp + count[r[b]]++ * rec_size, r, rec_size);
+        }
+        uint8_t *swap = recs;
+        recs = tmp;
+        tmp = swap;
+    }
+    
+    uint8_t *sorted = n * elm_size <= n * rec_size ? tmp : realloc(tmp, n * elm_size);
+    if(!sorted)
+    {
+        // no room for a copy, follow the permutation's cycles swapping in place
+        for(size_t i = 0 ; i < n ; i++)
+        {
+            size_t j = i, src;
+            memcpy(&src, recs + j * rec_size + key_size, sizeof(size_t));
+            if(src == NEAT_SORT_DONE) continue;
+            for(;;)
+            {
+                size_t done = NEAT_SORT_DONE;
+                memcpy(recs + j * rec_size + key_size, &done, sizeof(size_t));
+                if(src == i) break;
+                for(size_t b = 0 ; b < elm_size ; b++)
+                {
+                    uint8_t t = base[j * elm_size + b];
+                    base[j * elm_size + b] = base[src * elm_size + b];
+                    base[src * elm_size + b] = t;
+                }
+                j = src;
+                memcpy(&src, recs + j * rec_size + key_size, sizeof(size_t));
+            }
+        }
+        free(tmp);
+        free(recs);
+        return;
+    }
+    
+    for(size_t i = 0 ; i < n ; i++)
+    {
+        size_t src;
+        memcpy(&src, recs + i * rec_size + key_size, sizeof(size_t));
+        memcpy(sorted + i * elm_size, base + src * elm_size, elm_size);
+    }
+    memcpy(base, sorted, n * elm_size);
+    
+    free(sorted);
+    free(recs);
+}
+
+void *neat_gallop_search(const void *key, const void *base, size_t n, size_t elm_size, cmp_func cmp,
+                         neat_lower_bound_func lower_bound, size_t *hint)
+{
+    const uint8_t *arr = base;
+    if(n == 0)
+    {
+        *hint = 0;
+        return NULL;
+    }
+    
+    size_t h = *hint < n ? *hint : n - 1;
+    size_t lo, hi; // the first element >= key is in [lo, hi]
+    if(cmp(arr + h * elm_size, key) < 0)
+    {
+        size_t step = 1;
+        lo = h + 1;
+        while(h + step < n && cmp(arr + (h + step) * elm_size, key) < 0)
+        {
+            lo = h + step + 1;
+            step *= 2;
+        }
+        hi = h + step < n ? h + step : n;
+    }
+    else
+    {
+        size_t step = 1;
+        hi = h;
+        while(step <= h && cmp(arr + (h - step) * elm_size, key) >= 0)
+        {
+            hi = h - step;
+            step *= 2;
+        }
+        lo = step <= h ? h - step + 1 : 0;
+    }
+    
+    size_t i = lo + lower_bound(arr + lo * elm_size, hi - lo, key, elm_size, cmp, false);
+    *hint = i;
+    if(i < n && cmp(arr + i * elm_size, key) == 0) return (void *) (arr + i * elm_size);
+    return NULL;
+}
+
+void *neat_flatmap_find_f(const void *keys, const void *vals, size_t len, const void *key,
+                          size_t key_size, size_t val_size, cmp_func cmp, neat_lower_bound_func lower_bound)
+{
+    size_t i = lower_bound(keys, len, key, key_size, cmp, false);
+    if(i == len || cmp((const uint8_t *) keys + i * key_size, key) != 0) return NULL;
+    return (uint8_t *) vals + i * val_size;
+}
+
+// stable bottom-up merge sort of the indices 0..n-1 by their keys
+static size_t *neat_sort_indices(const void *keys, size_t n, size_t key_size, cmp_func cmp)
+{
+    const uint8_t *k = keys;
+    size_t *idx = malloc((n ? n : 1) * sizeof(size_t));
+    size_t *tmp = malloc((n ? n : 1) * sizeof(size_t));
+    for(size_t i = 0 ; i < n ; i++) idx[i] = i;
+    
+    for(size_t width = 1 ; width < n ; width *= 2)
+    {
+        for(size_t lo = 0 ; lo < n ; lo += 2 * width)
+        {
+            size_t mid = lo + width < n ? lo + width : n;
+            size_t hi = lo + 2 * width < n ? lo + 2 * width : n;
+            size_t i = lo, j = mid, o = lo;
+            while(i < mid && j < hi)
+            {
+                if(cmp(k + idx[j] * key_size, k + idx[i] * key_size) < 0)
+                    tmp[o++] = idx[j++];
+                else
+                    tmp[o++] = idx[i++];
+            }
+            while(i < mid) tmp[o++] = idx[i++];
+            while(j < hi) tmp[o++] = idx[j++];
+        }
+        size_t *swap = idx;
+        idx = tmp;
+        tmp = swap;
+    }
+    
+    free(tmp);
+    return idx;
+}
+
+void neat_flatmap_build_f(void **keys, void **vals, size_t *len, size_t *cap,
+                          const void *src_keys, const void *src_vals, size_t n,
+                          size_t key_size, size_t val_size, cmp_func cmp)
+{
+    size_t *order = neat_sort_indices(src_keys, n, key_size, cmp);
+    uint8_t *k = malloc((n ? n : 1) * key_size);
+    uint8_t *v = malloc((n ? n : 1) * val_size);
+    const uint8_t *sk = src_keys, *sv = src_vals;
+    
+    size_t out = 0;
+    for(size_t i = 0 ; i < n ; i++)
+    {
+        const uint8_t *key = sk + order[i] * key_size;
+        // the sort is stable, so a repeated key overwrites the value of the earlier one
+        if(out == 0 || cmp(k + (out - 1) * key_size, key) != 0)
+        {
+            memcpy(k + out * key_size, key, key_size);
+            out++;
+        }
+        memcpy(v + (out - 1) * val_size, sv + order[i] * val_size, val_size);
+    }
+    free(order);
+    
+    if(out < n)
+    {
+        uint8_t *shrunk;
+        if((shrunk = realloc(k, (out ? out : 1) * key_size))) k = shrunk;
+        if((shrunk = realloc(v, (out ? out : 1) * val_size))) v = shrunk;
+    }
+    
+    free(*keys);
+    free(*vals);
+    *keys = k;
+    *vals = v;
+    *len = out;
+    *cap = out;
+}
+
+// returns the slot of key, making room for it (and copying it in) if it's new
+size_t neat_flatmap_insert_f(void **keys, void **vals, size_t *len, size_t *cap, const void *key,
+                             size_t key_size, size_t val_size, cmp_func cmp, neat_lower_bound_func lower_bound)
+{
+    size_t i = lower_bound(*keys, *len, key, key_size, cmp, false);
+    if(i < *len && cmp((uint8_t *) *keys + i * key_size, key) == 0) return i;
+    
+    if(*len == *cap)
+    {
+        *cap = *cap < 8 ? 16 : *cap * 2;
+        *keys = realloc(*keys, *cap * key_size);
+        *vals = realloc(*vals, *cap * val_size);
+    }
+    uint8_t *k = *keys, *v = *vals;
+    memmove(k + (i + 1) * key_size, k + i * key_size, (*len - i) * key_size);
+    memmove(v + (i + 1) * val_size, v + i * val_size, (*len - i) * val_size);
+    memcpy(k + i * key_size, key, key_size);
+    (*len)++;
+    return i;
+}
+
+void neat_flatmap_merge_f(void **keys, void **vals, size_t *len, size_t *cap,
+                          const void *a_keys, const void *a_vals, size_t a_len,
+                          const void *b_keys, const void *b_vals, size_t b_len,
+                          size_t key_size, size_t val_size, cmp_func cmp)
+{
+    size_t n = a_len + b_len;
+    uint8_t *k = malloc((n ? n : 1) * key_size);
+    uint8_t *v = malloc((n ? n : 1) * val_size);
+    const uint8_t *ak = a_keys, *av = a_vals, *bk = b_keys, *bv = b_vals;
+    
+    size_t i = 0, j = 0, out = 0;
+    while(i < a_len || j < b_len)
+    {
+        int c = i == a_len ? 1 : j == b_len ? -1 : cmp(ak + i * key_size, bk + j * key_size);
+        if(c < 0)
+        {
+            memcpy(k + out * key_size, ak + i * key_size, key_size);
+            memcpy(v + out * val_size, av + i * val_size, val_size);
+            i++;
+        }
+        else
+        {
+            memcpy(k + out * key_size, bk + j * key_size, key_size);
+            memcpy(v + out * val_size, bv + j * val_size, val_size);
+            j++;
+            i += c == 0;
+        }
+        out++;
+    }
+    
+    // dst may be a or b, so it's only released once the merge is done
+    free(*keys);
+    free(*vals);
+    *keys = k;
+    *vals = v;
+    *len = out;
+    *cap = n;
+}
+
 #else // NEAT_SORT_IMPLEMENTATION
 
 declare_number_cmp_func(int8_t);
@@ -248,6 +1608,64 @@ declare_number_cmp_func(float);
 declare_number_cmp_func(double);
 int neat_str_cmp(const char **s1, const char **s2);
 
+declare_number_lower_bound(int8_t);
+declare_number_lower_bound(uint8_t);
+declare_number_lower_bound(int16_t);
+declare_number_lower_bound(uint16_t);
+declare_number_lower_bound(int32_t);
+declare_number_lower_bound(uint32_t);
+declare_number_lower_bound(int64_t);
+declare_number_lower_bound(uint64_t);
+declare_number_lower_bound(float);
+declare_number_lower_bound(double);
+size_t neat_lower_bound(const void *base, size_t n, const void *key, size_t elm_size, cmp_func cmp, bool upper);
+
+declare_number_isearch(int8_t);
+declare_number_isearch(uint8_t);
+declare_number_isearch(int16_t);
+declare_number_isearch(uint16_t);
+declare_number_isearch(int32_t);
+declare_number_isearch(uint32_t);
+declare_number_isearch(int64_t);
+declare_number_isearch(uint64_t);
+declare_number_isearch(float);
+declare_number_isearch(double);
+
+void *neat_gallop_search(const void *key, const void *base, size_t n, size_t elm_size, cmp_func cmp,
+                         neat_lower_bound_func lower_bound, size_t *hint);
+
+void neat_sort_by_key(void *arr, size_t n, size_t elm_size, size_t key_size, neat_key_func key);
+
 void *neat_search(const void *key, const void *base, size_t nmemb, size_t elm_size, cmp_func cmp);
 
+neat_strtab neat_strtab_build(char **sorted, size_t n, size_t block_size);
+void neat_strtab_free(neat_strtab *t);
+size_t neat_strtab_find(const neat_strtab *t, const char *key);
+size_t neat_strtab_lower_bound(const neat_strtab *t, const char *key);
+size_t neat_strtab_get(const neat_strtab *t, size_t i, char *buf, size_t cap);
+neat_strtab_iter neat_strtab_iter_at(const neat_strtab *t, size_t i);
+neat_strtab_iter neat_strtab_prefix(const neat_strtab *t, const char *prefix);
+bool neat_strtab_next(neat_strtab_iter *it);
+void neat_strtab_iter_free(neat_strtab_iter *it);
+
+void neat_heap_reserve(void **items, neat_heap_state *st, size_t elm_size, size_t n);
+void neat_heap_sift_up(void *items, neat_heap_state *st, size_t i, size_t elm_size, cmp_func cmp);
+void neat_heap_sift_down(void *items, neat_heap_state *st, size_t i, size_t elm_size, cmp_func cmp);
+void neat_heap_fix_f(void *items, neat_heap_state *st, size_t i, size_t elm_size, cmp_func cmp);
+void neat_heap_push_f(void *items, neat_heap_state *st, size_t elm_size, cmp_func cmp, size_t id);
+void neat_heap_pop_f(void *items, neat_heap_state *st, size_t elm_size, cmp_func cmp);
+void neat_heapify_f(void *items, neat_heap_state *st, size_t elm_size, cmp_func cmp);
+
+void *neat_flatmap_find_f(const void *keys, const void *vals, size_t len, const void *key,
+                          size_t key_size, size_t val_size, cmp_func cmp, neat_lower_bound_func lower_bound);
+void neat_flatmap_build_f(void **keys, void **vals, size_t *len, size_t *cap,
+                          const void *src_keys, const void *src_vals, size_t n,
+                          size_t key_size, size_t val_size, cmp_func cmp);
+size_t neat_flatmap_insert_f(void **keys, void **vals, size_t *len, size_t *cap, const void *key,
+                             size_t key_size, size_t val_size, cmp_func cmp, neat_lower_bound_func lower_bound);
+void neat_flatmap_merge_f(void **keys, void **vals, size_t *len, size_t *cap,
+                          const void *a_keys, const void *a_vals, size_t a_len,
+                          const void *b_keys, const void *b_vals, size_t b_len,
+                          size_t key_size, size_t val_size, cmp_func cmp);
+
 #endif // NEAT_SORT_IMPLEMENTATION
\ No newline at end of file
@@ -22,6 +22,23 @@
             
         And it should return a 'malloc'ed string.
         
+        Stringable types can also be added with a function that
+        writes into a buffer instead, so converting them never
+        allocates:
+            
+            #define STRINGABLE_TYPES ADD_STRINGABLE_BUF(T, T2chars)
+            #include "neat_tostr.h"
+            
+        T2chars must be a function with this prototype:
+            
+            size_t T2chars(char *buf, size_t cap, T*);
+            
+        It should work like snprintf: write at most cap chars
+        (including the NUL terminator) and return the length of
+        the full string.
+        ADD_STRINGABLE and ADD_STRINGABLE_BUF can be mixed in the
+        same list.
+        
         Extending with additonal parsable types:
             
             #define PARSABLE_TYPES ADD_PARSABLE(T, parseT)
@@ -46,6 +63,29 @@
             
             #include "neat_tostr.h"
             
+        Parsable types can also be added for parse_n:
+            
+            #define PARSABLE_N_TYPES ADD_PARSABLE_N(T, parseT_n)
+            
+        with parseT_n never reading past str + len:
+            
+            T parseT_n(const char *str, size_t len, int *err);
+            
+        Extending with additional serializable types:
+            
+            #define SERIALIZABLE_TYPES ADD_SERIALIZABLE(T, T2bytes, bytes2T)
+            #include "neat_tostr.h"
+            
+        with these prototypes:
+            
+            size_t T2bytes(unsigned char *buf, size_t cap, T*);
+            size_t bytes2T(const unsigned char *buf, size_t len, T*);
+            
+        T2bytes returns the size of the encoding, and only writes
+        it if it fits in cap. bytes2T never reads past buf + len,
+        and returns how many bytes it read, 0 if they're not a
+        valid T.
+        
         make sure to only put commas *between* the ADD_ calls.
         
         You can also define STRINGABLE_TYPES2 and STRINGABLE_TYPES3.
@@ -59,10 +99,57 @@
                 char* to_string(S s);
                   Returns a 'malloc'ed string representation of s.
                  
+            to_string_ref:
+                neat_strref to_string_ref(S s);
+                  Like to_string, but bool, char, char* and integers
+                  in [NEAT_SMALL_INT_MIN, NEAT_SMALL_INT_MAX] borrow
+                  a static string instead of allocating. Check
+                  .owned, or just pass it to neat_strref_free.
+                 
+            to_chars:
+                size_t to_chars(char *buf, size_t cap, S s);
+                  Writes the string representation of s into buf,
+                  snprintf style: at most cap chars are written,
+                  buf is NUL terminated if cap > 0, and the length
+                  of the full string is returned (so the output was
+                  truncated if it's >= cap).
+                  Doesn't allocate, unless S was added with
+                  ADD_STRINGABLE.
+                  
+            to_chars_hex:
+                size_t to_chars_hex(char *buf, size_t cap, S s);
+                  Like to_chars, but writes an integer in lowercase
+                  hex, without a prefix. Negative numbers are written
+                  in two's complement of their type's width.
+                  
             array_to_string:
                 char* array_to_string(S* s, int n);
+                char* array_to_string(S* s, int n, neat_array_fmt fmt);
                   Returns a 'malloc'ed string from the array s 
-                  of size n.
+                  of size n. With NEAT_TOSTR_THREADS defined
+                  (needs pthreads), fmt.nthreads threads format
+                  big arrays, for the same output. print_array
+                  does the same.
+                  
+            array_to_string_json:
+                char* array_to_string_json(S* s, int n);
+                  Same as array_to_string with NEAT_ARRAY_FMT_JSON:
+                  "[" and "]" around, "," between, and char* and
+                  char elements quoted like print_quoted. Any fmt
+                  with .quote set does this.
+                  
+            array_to_chars:
+                size_t array_to_chars(char *buf, size_t cap, S* s, size_t n);
+                size_t array_to_chars(char *buf, size_t cap, S* s, size_t n, neat_array_fmt fmt);
+                  Writes the array s of a number type into buf,
+                  snprintf style like to_chars. Whole arrays go
+                  through batch kernels (SSE2 digit extraction when
+                  available). fmt sets .open, .sep and .close
+                  (NEAT_ARRAY_FMT_DEFAULT is "{", ", ", "}") and
+                  .precision: digits after the point for float and
+                  double, rounded like printf's "%.*f", up to
+                  NEAT_FIXED_MAX_PRECISION, or -1 for the shortest
+                  round-trip form.
                 
             print:
                 void print(...);
@@ -72,7 +159,9 @@
             fprint:
                 void fprint(FILE* f, ...);
                   Prints to f the string representation of all the
-                  arguments.
+                  arguments. They're formatted into one stack
+                  buffer, sized at compile time when all of them
+                  are numbers, bool or char, and written at once.
                 
             println:
                 void println(...);
@@ -84,10 +173,22 @@
                   Prints to f the string representation of all
                   the args, with '\n' afterwards.
                   
+            print_quoted, fprint_quoted, println_quoted, fprintln_quoted:
+                void print_quoted(...);
+                  Like print, but char* and char args are written
+                  in double quotes and escaped like JSON strings
+                  (\" \\ \n \t etc, \u00XX for other control
+                  chars). The string is scanned 16 bytes at a
+                  time for chars to escape (SSE2 when available),
+                  and the runs between them are copied at once.
+                  
             print_array:
                 void print_array(S* s, int n);
+                void print_array(S* s, int n, neat_array_fmt fmt);
                   Prints to stdout the string representation of the
-                  array s with length n.
+                  array s with length n. Arrays of numbers use the
+                  batch kernels of array_to_chars. All the array
+                  printing functions take an optional fmt.
                   
             fprint_array:
                 void fprint_array(FILE* f, S* s, int n);
@@ -104,6 +205,19 @@
                   Prints to f the string representation of the
                   array s with length n, with '\n' after it.
                   
+            wprint, wprintln, wprint_array, wprintln_array:
+                void wprint(neat_writer *w, ...);
+                  Like the print functions, but format into the
+                  writer w. All the print functions above use a
+                  writer on the stack and flush it once per call.
+                  A writer is made with:
+                    neat_writer neat_writer_file(FILE *f, char *buf, size_t cap);
+                    neat_writer neat_writer_fd(int fd, char *buf, size_t cap);
+                  and written out when buf is full, or by
+                  neat_writer_flush(neat_writer *w). Any cap
+                  works, 64 and up lets numbers be formatted
+                  straight into buf.
+                  
             parse:
                 S parse(S, char *str);
                   Parses S from str and returns it.
@@ -111,17 +225,156 @@
                 S parse(S, char *str, int *err);
                   Parses S from str and returns it.
                   Puts error code into err.
+                  The built-in types use NEAT_PARSE_OK (0),
+                  NEAT_PARSE_INVALID, NEAT_PARSE_EMPTY, and
+                  NEAT_PARSE_RANGE (integer didn't fit, the
+                  closest value is returned).
+                  
+            parse_n:
+                S parse_n(S, const char *str, size_t len);
+                S parse_n(S, const char *str, size_t len, int *err);
+                  Like parse, but str doesn't have to be NUL
+                  terminated: nothing past str + len is read,
+                  and nothing is allocated. For char* use
+                  parse_array, or keep the pointer and length.
+                  
+            parse_array:
+                neat_parse_array_result parse_array(S, const char *buf, size_t len, char delim, S *out, size_t cap);
+                  Parses up to cap values from buf (not NUL
+                  terminated), separated by delim or newlines,
+                  into out. Whitespace around a value and blank
+                  lines are skipped. An empty field is only allowed
+                  at the end of a line (so a trailing delim is
+                  fine, "1,,2" is NEAT_PARSE_EMPTY), and when delim
+                  is ' ' or '\t' a run of them is one separator.
+                  Returns .count (values written), .err (the
+                  first error), and .pos (the offset of the bad
+                  field, or where parsing stopped, so a full out
+                  can be continued from buf + pos). Only for the
+                  built-in types. For char*, buf must be a string,
+                  which is split in place (the separators become
+                  '\0').
+                  
+            parse_file:
+                neat_parse_array_result parse_file(S, const char *path, char delim, S **out);
+                neat_parse_array_result parse_file(S, const char *path, char delim, S **out, int nthreads);
+                  Maps the file at path and parses it like
+                  parse_array into a 'malloc'ed array put in *out.
+                  .pos is an offset in the file. NEAT_PARSE_IO is
+                  returned if the file can't be read. With
+                  NEAT_TOSTR_THREADS defined (needs pthreads),
+                  big files are split at line breaks between
+                  nthreads threads.
+                  
+            neat_cursor_next:
+                S neat_cursor_next(neat_cursor *c, S);
+                S neat_cursor_next(neat_cursor *c, S, int *err);
+                  Parses the next value of c and skips the
+                  separator after it (delim or a newline). A
+                  cursor is made with:
+                    neat_cursor neat_cursor_buf(const char *buf, size_t len, char delim);
+                    neat_cursor neat_cursor_file(FILE *f, char *buf, size_t cap, char delim);
+                    neat_cursor neat_cursor_fd(int fd, char *buf, size_t cap, char delim);
+                  the last two read the input into buf in chunks,
+                  a field that doesn't fit in cap with the
+                  separator after it is skipped and gives
+                  NEAT_PARSE_INVALID (and an empty string from
+                  neat_cursor_next_str). Fields are separated
+                  like in parse_array. Whitespace and blank lines
+                  before a value are skipped, and
+                  neat_cursor_eof(&c) tells if there's more. After
+                  an error the rest of the field is skipped, and
+                  c.err keeps the first error. Works for bool and
+                  the number types, for text fields use:
+                    const char *neat_cursor_next_str(neat_cursor *c, size_t *len);
+                  which points into buf until the next call.
+                  
+            to_bytes:
+                size_t to_bytes(void *buf, size_t cap, S s);
+                  Writes s in a compact binary form into buf, if
+                  it fits in cap, and returns its size. Integers
+                  are varints (zigzagged if signed), floats their
+                  little endian IEEE-754 bits, bool and char one
+                  byte, char* a varint length then the chars.
+                  
+            from_bytes:
+                size_t from_bytes(const void *buf, size_t len, S *out);
+                  Reads what to_bytes wrote back into out, and
+                  returns how many bytes that took. 0 if buf is
+                  truncated or the value doesn't fit in S. A char*
+                  is 'malloc'ed.
+                  
+            array_to_bytes / array_from_bytes:
+                size_t array_to_bytes(void *buf, size_t cap, S *s, size_t n);
+                size_t array_from_bytes(const void *buf, size_t len, S *out, size_t n);
+                  The same, for the n elements of an array, one
+                  after the other (n isn't written). Arrays of
+                  char, and float and double on little endian
+                  machines, are a single memcpy.
+                  
+            neat_parse_i64 / neat_parse_u64:
+                int64_t neat_parse_i64(const char *str, char **end, int64_t min, int64_t max, int *err);
+                uint64_t neat_parse_u64(const char *str, char **end, uint64_t max, int *err);
+                  The integer parsers behind parse, checked against
+                  [min, max]. If end isn't NULL it's set past the
+                  parsed number, so the same buffer can be scanned
+                  further.
+                  
+            neat_parse_f32 / neat_parse_f64:
+                float neat_parse_f32(const char *str, char **end, int *err);
+                double neat_parse_f64(const char *str, char **end, int *err);
+                  The float parsers behind parse. Correctly rounded
+                  and locale independent, accept inf/infinity/nan.
+                  Overflow to inf sets NEAT_PARSE_RANGE.
                   
             get_tostr:
                 char*(*)(S*) get_tostr(S);
                   Returns the to_string function associated
-                  with S.
+                  with S. If S was added with ADD_STRINGABLE_BUF,
+                  returns a neat_strfn holding its to_chars
+                  function instead.
                 
             get_parse:
                 S(*)(char*,int*) get_parse(S);
                   Returns the parse function associated
                   with S.
                   
+            get_serfn:
+                neat_serfn get_serfn(S);
+                  Returns the to_bytes and from_bytes functions
+                  associated with S.
+                  
+        Async output (define NEAT_TOSTR_ASYNC before including, needs pthreads):
+            
+            int neat_async_start(FILE *f, size_t ring_size, neat_async_policy policy);
+            int neat_async_start_fd(int fd, size_t ring_size, neat_async_policy policy);
+              From now on, everything printed to f (or fd) by any
+              thread is pushed into a per-thread lock-free ring of
+              ring_size bytes, and written out by a background thread.
+              ring_size is rounded up to a power of two, at least
+              4096 (pass 0 for that). Returns -1 if it's already
+              started (stop it first, a new start can change the
+              target, size and policy) or the thread can't be made.
+              When a ring is full, NEAT_ASYNC_DROP drops the output
+              and NEAT_ASYNC_BLOCK waits for room.
+              
+            void neat_async_flush(void);
+              Returns once everything printed before the call is
+              written out.
+              
+            void neat_async_stop(void);
+              Flushes and stops the background thread, printing
+              is synchronous again.
+              
+            uint64_t neat_async_dropped(void);
+              How many bytes were dropped so far.
+              
+        float and double are converted to the shortest string that
+        parses back to the same value (plain notation for decimal
+        exponents in [-4, 16), scientific otherwise). To get the
+        "%g" style output instead, define NEAT_TOSTR_FLOAT_G before
+        including with NEAT_TOSTR_IMPLEMENTATION.
+        
         If you want the API to be prefixed,
         then define NEAT_TOSTR_PREFIX before including.
         All the functions (macros) will be prefixed with 'neat_'
@@ -141,9 +394,21 @@
 #define NEAT_ADD_STRINGABLE(type, tostr) \
 type: tostr
 
+#define NEAT_ADD_STRINGABLE_BUF(type, tochars_func) \
+type: (neat_strfn){ .tochars = (neat_tochars_func) tochars_func }
+
 #define NEAT_ADD_PARSABLE(type, parse) \
 type: parse
 
+#define NEAT_ADD_PARSABLE_N(type, parse) \
+type: parse
+
+#define NEAT_ADD_SERIALIZABLE(type, to_bytes_func, from_bytes_func) \
+NEAT_SERIALIZABLE_ENTRY(type, to_bytes_func, from_bytes_func, false)
+
+#define NEAT_SERIALIZABLE_ENTRY(type, to_bytes_func, from_bytes_func, is_raw) \
+type: (neat_serfn){ .tobytes = (neat_tobytes_func) to_bytes_func, .frombytes = (neat_frombytes_func) from_bytes_func, .raw = is_raw }
+
 
 #if defined(STRINGABLE_TYPES) && defined(STRINGABLE_TYPES2) && defined(STRINGABLE_TYPES3)
 
@@ -252,6 +517,30 @@ type: parse
 
 #endif // User's PARSABLE_TYPES
 
+#ifdef PARSABLE_N_TYPES
+
+    #define NEAT_USER_PARSABLE_N_TYPES \
+    , \
+    PARSABLE_N_TYPES
+
+#else
+
+    #define NEAT_USER_PARSABLE_N_TYPES
+
+#endif // User's PARSABLE_N_TYPES
+
+#ifdef SERIALIZABLE_TYPES
+
+    #define NEAT_USER_SERIALIZABLE_TYPES \
+    , \
+    SERIALIZABLE_TYPES
+
+#else
+
+    #define NEAT_USER_SERIALIZABLE_TYPES
+
+#endif // User's SERIALIZABLE_TYPES
+
 #define NEAT_DEFAULT_STRINGABLE_TYPES \
 NEAT_ADD_STRINGABLE(char,      neat_char2str), \
 NEAT_ADD_STRINGABLE(bool,      neat_bool2str), \
@@ -266,6 +555,21 @@ NEAT_ADD_STRINGABLE(uint64_t,  neat_uint64_t2str), \
 NEAT_ADD_STRINGABLE(float,     neat_float2str), \
 NEAT_ADD_STRINGABLE(double,    neat_double2str)
 
+#define NEAT_DEFAULT_TOCHARS_TYPES \
+NEAT_ADD_STRINGABLE_BUF(char,      neat_char2chars), \
+NEAT_ADD_STRINGABLE_BUF(char*,     neat_str2chars_dummy), \
+NEAT_ADD_STRINGABLE_BUF(bool,      neat_bool2chars), \
+NEAT_ADD_STRINGABLE_BUF(int8_t,    neat_int8_t2chars), \
+NEAT_ADD_STRINGABLE_BUF(int16_t,   neat_int16_t2chars), \
+NEAT_ADD_STRINGABLE_BUF(int32_t,   neat_int32_t2chars), \
+NEAT_ADD_STRINGABLE_BUF(int64_t,   neat_int64_t2chars), \
+NEAT_ADD_STRINGABLE_BUF(uint8_t,   neat_uint8_t2chars), \
+NEAT_ADD_STRINGABLE_BUF(uint16_t,  neat_uint16_t2chars), \
+NEAT_ADD_STRINGABLE_BUF(uint32_t,  neat_uint32_t2chars), \
+NEAT_ADD_STRINGABLE_BUF(uint64_t,  neat_uint64_t2chars), \
+NEAT_ADD_STRINGABLE_BUF(float,     neat_float2chars), \
+NEAT_ADD_STRINGABLE_BUF(double,    neat_double2chars)
+
 #define NEAT_DEFAULT_PARSABLE_TYPES \
 NEAT_ADD_PARSABLE(char,      neat_parse_char), \
 NEAT_ADD_PARSABLE(char*,     neat_parse_str), \
@@ -281,6 +585,20 @@ NEAT_ADD_PARSABLE(uint64_t,  neat_parse_uint64_t), \
 NEAT_ADD_PARSABLE(float,     neat_parse_float), \
 NEAT_ADD_PARSABLE(double,    neat_parse_double)
 
+#define NEAT_DEFAULT_PARSABLE_N_TYPES \
+NEAT_ADD_PARSABLE_N(char,      neat_parse_n_char), \
+NEAT_ADD_PARSABLE_N(bool,      neat_parse_n_bool), \
+NEAT_ADD_PARSABLE_N(int8_t,    neat_parse_n_int8_t), \
+NEAT_ADD_PARSABLE_N(int16_t,   neat_parse_n_int16_t), \
+NEAT_ADD_PARSABLE_N(int32_t,   neat_parse_n_int32_t), \
+NEAT_ADD_PARSABLE_N(int64_t,   neat_parse_n_int64_t), \
+NEAT_ADD_PARSABLE_N(uint8_t,   neat_parse_n_uint8_t), \
+NEAT_ADD_PARSABLE_N(uint16_t,  neat_parse_n_uint16_t), \
+NEAT_ADD_PARSABLE_N(uint32_t,  neat_parse_n_uint32_t), \
+NEAT_ADD_PARSABLE_N(uint64_t,  neat_parse_n_uint64_t), \
+NEAT_ADD_PARSABLE_N(float,     neat_parse_n_float), \
+NEAT_ADD_PARSABLE_N(double,    neat_parse_n_double)
+
 #define NEAT_ALL_STRINGABLE_TYPES \
 NEAT_DEFAULT_STRINGABLE_TYPES \
 NEAT_USER_STRINGABLE_TYPES
@@ -289,6 +607,36 @@ NEAT_USER_STRINGABLE_TYPES
 NEAT_DEFAULT_PARSABLE_TYPES \
 NEAT_USER_PARSABLE_TYPES
 
+#define NEAT_ALL_PARSABLE_N_TYPES \
+NEAT_DEFAULT_PARSABLE_N_TYPES \
+NEAT_USER_PARSABLE_N_TYPES
+
+// the floats are stored as their IEEE-754 bits in little endian, so on little endian machines it's their own bytes.
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+    #define NEAT_LITTLE_ENDIAN false
+#else
+    #define NEAT_LITTLE_ENDIAN true
+#endif
+
+#define NEAT_DEFAULT_SERIALIZABLE_TYPES \
+NEAT_SERIALIZABLE_ENTRY(char,     neat_char2bytes,     neat_bytes2char,     true), \
+NEAT_SERIALIZABLE_ENTRY(char*,    neat_str2bytes_dummy, neat_bytes2str,     false), \
+NEAT_SERIALIZABLE_ENTRY(bool,     neat_bool2bytes,     neat_bytes2bool,     false), \
+NEAT_SERIALIZABLE_ENTRY(int8_t,   neat_int8_t2bytes,   neat_bytes2int8_t,   false), \
+NEAT_SERIALIZABLE_ENTRY(int16_t,  neat_int16_t2bytes,  neat_bytes2int16_t,  false), \
+NEAT_SERIALIZABLE_ENTRY(int32_t,  neat_int32_t2bytes,  neat_bytes2int32_t,  false), \
+NEAT_SERIALIZABLE_ENTRY(int64_t,  neat_int64_t2bytes,  neat_bytes2int64_t,  false), \
+NEAT_SERIALIZABLE_ENTRY(uint8_t,  neat_uint8_t2bytes,  neat_bytes2uint8_t,  false), \
+NEAT_SERIALIZABLE_ENTRY(uint16_t, neat_uint16_t2bytes, neat_bytes2uint16_t, false), \
+NEAT_SERIALIZABLE_ENTRY(uint32_t, neat_uint32_t2bytes, neat_bytes2uint32_t, false), \
+NEAT_SERIALIZABLE_ENTRY(uint64_t, neat_uint64_t2bytes, neat_bytes2uint64_t, false), \
+NEAT_SERIALIZABLE_ENTRY(float,    neat_float2bytes,    neat_bytes2float,    NEAT_LITTLE_ENDIAN), \
+NEAT_SERIALIZABLE_ENTRY(double,   neat_double2bytes,   neat_bytes2double,   NEAT_LITTLE_ENDIAN)
+
+#define NEAT_ALL_SERIALIZABLE_TYPES \
+NEAT_DEFAULT_SERIALIZABLE_TYPES \
+NEAT_USER_SERIALIZABLE_TYPES
+
 #ifndef _MSC_VER
     #define NEAT_TOSTR_SILENCE_W_BEGIN \
 _Pragma("GCC diagnostic push") \
@@ -328,6 +676,20 @@ _Generic( (typeof(type)){0} , \
     char*: (neat_str2str_dummy) \
 )
 
+// the buffer writing function of the default types, or whatever the user registered.
+#define neat_get_tochars_raw(type) \
+_Generic( (typeof(type)){0} , \
+    NEAT_DEFAULT_TOCHARS_TYPES, \
+    default: neat_get_tostr(type) \
+)
+
+// ADD_STRINGABLE_BUF entries are already a neat_strfn, ADD_STRINGABLE ones are wrapped into one.
+#define neat_get_strfn(type) \
+_Generic(neat_get_tochars_raw(type), \
+    neat_strfn: _Generic(neat_get_tochars_raw(type), neat_strfn: neat_get_tochars_raw(type), default: (neat_strfn){0}), \
+    default: (neat_strfn){ .tostr = (neat_tostr_func) _Generic(neat_get_tochars_raw(type), neat_strfn: NULL, default: neat_get_tochars_raw(type)) } \
+)
+
 #define neat_get_parse(type) \
 _Generic( (typeof(type)){0} , \
     NEAT_ALL_PARSABLE_TYPES \
@@ -341,35 +703,137 @@ _Generic(obj, \
                char*: neat_str2str, \
                default: ((char*(*)(typeof(obj)))NULL) \
             )(obj), \
-    default: neat_get_tostr(obj)( &( (struct { typeof(obj) T; }){obj}.T ) ) \
+    default: neat_strfn_to_string( neat_get_strfn(obj), &( (struct { typeof(obj) T; }){obj}.T ) ) \
+) \
+NEAT_TOSTR_SILENCE_W_END \
+NEAT_TOSTR_PRAGMA_EXP_END
+
+#define neat_to_chars(buf, cap, obj) \
+NEAT_TOSTR_PRAGMA_EXP_BEGIN \
+NEAT_TOSTR_SILENCE_W_BEGIN \
+_Generic(obj, \
+    char*: _Generic(obj, \
+               char*: neat_str2chars, \
+               default: ((size_t(*)(char*, size_t, typeof(obj)))NULL) \
+            )(buf, cap, obj), \
+    default: neat_strfn_to_chars(buf, cap, neat_get_strfn(obj), &( (struct { typeof(obj) T; }){obj}.T )) \
+) \
+NEAT_TOSTR_SILENCE_W_END \
+NEAT_TOSTR_PRAGMA_EXP_END
+
+// the bits of the integer, so negative numbers come out in two's complement of their own width.
+#define neat_to_chars_hex(buf, cap, obj) \
+neat_hex2chars(buf, cap, _Generic(obj, \
+    int8_t:  (uint64_t) (uint8_t)  (obj), \
+    int16_t: (uint64_t) (uint16_t) (obj), \
+    int32_t: (uint64_t) (uint32_t) (obj), \
+    default: (uint64_t) (obj) \
+))
+
+// bool, char, and small integers come from static tables, char* is borrowed, anything else is a 'malloc'ed string.
+#define neat_to_string_ref(obj) \
+NEAT_TOSTR_PRAGMA_EXP_BEGIN \
+NEAT_TOSTR_SILENCE_W_BEGIN \
+_Generic(obj, \
+    char*:    neat_str2ref(_Generic(obj, char*: obj, default: NULL)), \
+    char:     neat_char2ref(_Generic(obj, char: obj, default: 0)), \
+    bool:     neat_bool2ref(_Generic(obj, bool: obj, default: false)), \
+    int8_t:   neat_int2ref(_Generic(obj, int8_t:   obj, default: (int8_t)0 )), \
+    int16_t:  neat_int2ref(_Generic(obj, int16_t:  obj, default: (int16_t)0 )), \
+    int32_t:  neat_int2ref(_Generic(obj, int32_t:  obj, default: (int32_t)0 )), \
+    int64_t:  neat_int2ref(_Generic(obj, int64_t:  obj, default: (int64_t)0 )), \
+    uint8_t:  neat_uint2ref(_Generic(obj, uint8_t:  obj, default: (uint8_t)0 )), \
+    uint16_t: neat_uint2ref(_Generic(obj, uint16_t: obj, default: (uint16_t)0 )), \
+    uint32_t: neat_uint2ref(_Generic(obj, uint32_t: obj, default: (uint32_t)0 )), \
+    uint64_t: neat_uint2ref(_Generic(obj, uint64_t: obj, default: (uint64_t)0 )), \
+    default:  neat_strref_own(neat_strfn_to_string( neat_get_strfn(obj), &( (struct { typeof(obj) T; }){obj}.T ) )) \
 ) \
 NEAT_TOSTR_SILENCE_W_END \
 NEAT_TOSTR_PRAGMA_EXP_END
 
-#define neat_array_to_string(arr, n) \
-neat_array_to_string_f(arr, n, sizeof(*arr), (char*(*)(void*)) neat_get_tostr(*arr))
+// upper bound on the length of obj's string for the built-in types, unknown for the others
+#define neat_max_chars_or(obj, unknown) \
+_Generic(obj, \
+    char:     1, \
+    bool:     5, \
+    int8_t:   4, \
+    int16_t:  6, \
+    int32_t:  11, \
+    int64_t:  20, \
+    uint8_t:  3, \
+    uint16_t: 5, \
+    uint32_t: 10, \
+    uint64_t: 20, \
+    float:    NEAT_FLOAT_MAX_CHARS, \
+    double:   NEAT_FLOAT_MAX_CHARS, \
+    default:  unknown \
+)
+
+#define neat_max_chars(obj) neat_max_chars_or(obj, 0)
+
+#define neat_array_to_string(arr, n, ...) \
+NEAT_TOSTR_PRAGMA_EXP_BEGIN \
+NEAT_TOSTR_SILENCE_W_BEGIN \
+neat_array_to_string_fmt_f(arr, n, sizeof(*(arr)), NEAT_PRINT_KIND(*(arr)), neat_print_strfn(*(arr)), neat_max_chars(*(arr)), NEAT_ARRAY_FMT_ARG(__VA_ARGS__)); \
+NEAT_TOSTR_SILENCE_W_END \
+NEAT_TOSTR_PRAGMA_EXP_END
+
+#define neat_array_to_string_json(arr, n) neat_array_to_string(arr, n, NEAT_ARRAY_FMT_JSON)
+
+// the fmt argument of the array functions, NEAT_ARRAY_FMT_DEFAULT if it's not given
+#define NEAT_ARRAY_FMT_ARG(...) \
+(neat_array_fmt[2]){ NEAT_ARRAY_FMT_DEFAULT , ##__VA_ARGS__ }[ !neat_is_empty(d,__VA_ARGS__) ]
+
+// the number types, the ones with batch kernels
+#define NEAT_ARRAY_KIND(obj) \
+_Generic(obj, \
+    int8_t:   NEAT_PRINT_I8, \
+    int16_t:  NEAT_PRINT_I16, \
+    int32_t:  NEAT_PRINT_I32, \
+    int64_t:  NEAT_PRINT_I64, \
+    uint8_t:  NEAT_PRINT_U8, \
+    uint16_t: NEAT_PRINT_U16, \
+    uint32_t: NEAT_PRINT_U32, \
+    uint64_t: NEAT_PRINT_U64, \
+    float:    NEAT_PRINT_FLOAT, \
+    double:   NEAT_PRINT_DOUBLE \
+)
+
+#define neat_array_to_chars(buf, cap, arr, n, ...) \
+neat_array_to_chars_f(buf, cap, arr, n, NEAT_ARRAY_KIND(*(arr)), NEAT_ARRAY_FMT_ARG(__VA_ARGS__))
+
+#define neat_wprint_array(w, arr, n, ...) \
+do { \
+    NEAT_TOSTR_SILENCE_W_BEGIN \
+    neat_wprint_array_f(w, arr, n, sizeof(*(arr)), NEAT_PRINT_KIND(*(arr)), neat_print_strfn(*(arr)), NEAT_ARRAY_FMT_ARG(__VA_ARGS__)) \
+    NEAT_TOSTR_SILENCE_W_END \
+} while(0)
+
+#define neat_wprintln_array(w, arr, n, ...) \
+do { \
+    neat_wprint_array(w, arr, n , ##__VA_ARGS__); \
+    neat_writer_put_char(w, '\n'); \
+} while(0)
 
-#define neat_fprint_array(file, arr, n) \
+#define neat_fprint_array(file, arr, n, ...) \
 do { \
-    int n_ = n; \
-    fprint(file, "{"); \
-    for(int i = 0 ; i < n_ - 1; i++) \
-    { \
-        fprint(file, arr[i], ", "); \
-    } \
-    if(n_ != 0) fprint(file, arr[n_ - 1]); \
-    fprint(file, "}"); \
+    char neat_wbuf[NEAT_WRITER_BUF_SIZE]; \
+    neat_writer neat_w = neat_writer_file(file, neat_wbuf, sizeof(neat_wbuf)); \
+    neat_wprint_array(&neat_w, arr, n , ##__VA_ARGS__); \
+    neat_writer_flush(&neat_w); \
 } while(0)
 
-#define neat_print_array(arr, n) neat_fprint_array(stdout, arr, n)
+#define neat_print_array(arr, n, ...) neat_fprint_array(stdout, arr, n , ##__VA_ARGS__)
 
-#define neat_fprintln_array(file, arr, n) \
+#define neat_fprintln_array(file, arr, n, ...) \
 do { \
-    neat_fprint_array(file, arr, n); \
-    fputc('\n', file); \
+    char neat_wbuf[NEAT_WRITER_BUF_SIZE]; \
+    neat_writer neat_w = neat_writer_file(file, neat_wbuf, sizeof(neat_wbuf)); \
+    neat_wprintln_array(&neat_w, arr, n , ##__VA_ARGS__); \
+    neat_writer_flush(&neat_w); \
 } while(0)
 
-#define neat_println_array(arr, n) neat_fprintln_array(stdout, arr, n)
+#define neat_println_array(arr, n, ...) neat_fprintln_array(stdout, arr, n , ##__VA_ARGS__)
 
 #define NEAT_NARG(...) \
 NEAT_NARG_(__VA_ARGS__,NEAT_100SEQ())
@@ -404,606 +868,876 @@ _91,_92,_93,_94,_95,_96,_97,_98,_99, N,...) N
 #define NEAT_CAT(a, ...) NEAT_PRIMITIVE_CAT(a, __VA_ARGS__)
 #define NEAT_PRIMITIVE_CAT(a, ...) a ## __VA_ARGS__
 
-#define neat_fprint(file, ...) NEAT_CAT(neat_fprint, NEAT_NARG(__VA_ARGS__))(file, __VA_ARGS__)
+// NEAT_MAP(m, a, b, c) is m(a) m(b) m(c). Every NEAT_MAPn lists its args directly, so nothing is re-expanded.
+#define NEAT_MAP(m, ...) NEAT_CAT(NEAT_MAP, NEAT_NARG(__VA_ARGS__))(m, __VA_ARGS__)
 
-#define neat_print(...) neat_fprint(stdout, __VA_ARGS__)
+#define NEAT_MAP1(m, o1) \
+m(o1)
 
-#define neat_fprintln(file, ...) do { \
-neat_fprint(file, __VA_ARGS__); \
-fputc('\n', file); \
-} while(0)
+#define NEAT_MAP2(m, o1, o2) \
+m(o1) m(o2)
 
-#define neat_println(...) neat_fprintln(stdout, __VA_ARGS__)
+#define NEAT_MAP3(m, o1, o2, o3) \
+m(o1) m(o2) m(o3)
 
-// TODO add float and double for list of statically allocated strings.
-#define neat_fprint1(file, o1) do { \
-char *neat_str = \
-    _Generic(o1, \
-        char*:    o1, \
-        char:     NULL, \
-        bool:     NULL, \
-        int8_t:   NULL, \
-        int16_t:  NULL, \
-        int32_t:  NULL, \
-        int64_t:  NULL, \
-        uint8_t:  NULL, \
-        uint16_t: NULL, \
-        uint32_t: NULL, \
-        uint64_t: NULL, \
-        float:    NULL, \
-        double:   NULL, \
-        default: neat_to_string(o1)); \
-_Generic(o1, \
-    char*:    fprintf(file, "%s", neat_str), \
-    default:  fprintf(file, "%s", neat_str), \
-    bool:     fprintf(file, "%s",       _Generic(o1, bool:     o1, default: false) ? "true" : "false"), \
-    int8_t:   fprintf(file, "%" PRId8,  _Generic(o1, int8_t:   o1, default: (int8_t)0 )), \
-    int16_t:  fprintf(file, "%" PRId16, _Generic(o1, int16_t:  o1, default: (int16_t)0 )), \
-    int32_t:  fprintf(file, "%" PRId32, _Generic(o1, int32_t:  o1, default: (int32_t)0 )), \
-    int64_t:  fprintf(file, "%" PRId64, _Generic(o1, int64_t:  o1, default: (int64_t)0 )), \
-    uint8_t:  fprintf(file, "%" PRIu8,  _Generic(o1, uint8_t:  o1, default: (uint8_t)0 )), \
-    uint16_t: fprintf(file, "%" PRIu16, _Generic(o1, uint16_t: o1, default: (uint8_t)0 )), \
-    uint32_t: fprintf(file, "%" PRIu32, _Generic(o1, uint32_t: o1, default: (uint32_t)0 )), \
-    uint64_t: fprintf(file, "%" PRIu64, _Generic(o1, uint64_t: o1, default: (uint64_t)0 )), \
-    float:    fprintf(file, "%g" ,      _Generic(o1, float:    o1, default: 0.0f )), \
-    double:   fprintf(file, "%lg",      _Generic(o1, double:   o1, default: 0.0 )) \
-); \
-\
-_Generic(o1, \
-    char*:    neat_dummy(), \
-    bool:     neat_dummy(), \
-    int8_t:   neat_dummy(), \
-    int16_t:  neat_dummy(), \
-    int32_t:  neat_dummy(), \
-    int64_t:  neat_dummy(), \
-    uint8_t:  neat_dummy(), \
-    uint16_t: neat_dummy(), \
-    uint32_t: neat_dummy(), \
-    uint64_t: neat_dummy(), \
-    default: free(neat_str) \
-); \
-} while(0)
-// make sure all standard types call dummy not free.
+#define NEAT_MAP4(m, o1, o2, o3, o4) \
+m(o1) m(o2) m(o3) m(o4)
 
-#define neat_fprint2(file, o1, o2) do { \
-neat_fprint1(file, o1); \
-neat_fprint1(file, o2); \
-} while(0)
+#define NEAT_MAP5(m, o1, o2, o3, o4, o5) \
+m(o1) m(o2) m(o3) m(o4) m(o5)
 
-#define neat_fprint3(file, o1, o2, o3) do { \
-neat_fprint2(file, o1, o2); \
-neat_fprint1(file, o3); \
-} while(0)
+#define NEAT_MAP6(m, o1, o2, o3, o4, o5, o6) \
+m(o1) m(o2) m(o3) m(o4) m(o5) m(o6)
 
-#define neat_fprint4(file, o1, o2, o3, o4) do { \
-neat_fprint3(file, o1, o2, o3); \
-neat_fprint1(file, o4); \
-} while(0)
+#define NEAT_MAP7(m, o1, o2, o3, o4, o5, o6, o7) \
+m(o1) m(o2) m(o3) m(o4) m(o5) m(o6) m(o7)
 
-#define neat_fprint5(file, o1, o2, o3, o4, o5) do { \
-neat_fprint4(file, o1, o2, o3, o4); \
-neat_fprint1(file, o5); \
-} while(0)
+#define NEAT_MAP8(m, o1, o2, o3, o4, o5, o6, o7, o8) \
+m(o1) m(o2) m(o3) m(o4) m(o5) m(o6) m(o7) m(o8)
 
-#define neat_fprint6(file, o1, o2, o3, o4, o5, o6) do { \
-neat_fprint5(file, o1, o2, o3, o4, o5); \
-neat_fprint1(file, o6); \
-} while(0)
+#define NEAT_MAP9(m, o1, o2, o3, o4, o5, o6, o7, o8, o9) \
+m(o1) m(o2) m(o3) m(o4) m(o5) m(o6) m(o7) m(o8) m(o9)
 
-#define neat_fprint7(file, o1, o2, o3, o4, o5, o6, o7) do { \
-neat_fprint6(file, o1, o2, o3, o4, o5, o6); \
-neat_fprint1(file, o7); \
-} while(0)
+#define NEAT_MAP10(m, o1, o2, o3, o4, o5, o6, o7, o8, o9, o10) \
+m(o1) m(o2) m(o3) m(o4) m(o5) m(o6) m(o7) m(o8) m(o9) m(o10)
 
-#define neat_fprint8(file, o1, o2, o3, o4, o5, o6, o7, o8) do { \
-neat_fprint7(file, o1, o2, o3, o4, o5, o6, o7); \
-neat_fprint1(file, o8); \
-} while(0)
+#define NEAT_MAP11(m, o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11) \
+m(o1) m(o2) m(o3) m(o4) m(o5) m(o6) m(o7) m(o8) m(o9) m(o10) m(o11)
 
-#define neat_fprint9(file, o1, o2, o3, o4, o5, o6, o7, o8, o9) do { \
-neat_fprint8(file, o1, o2, o3, o4, o5, o6, o7, o8); \
-neat_fprint1(file, o9); \
-} while(0)
+#define NEAT_MAP12(m, o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12) \
+m(o1) m(o2) m(o3) m(o4) m(o5) m(o6) m(o7) m(o8) m(o9) m(o10) m(o11) m(o12)
 
-#define neat_fprint10(file, o1, o2, o3, o4, o5, o6, o7, o8, o9, o10) do { \
-neat_fprint9(file, o1, o2, o3, o4, o5, o6, o7, o8, o9); \
-neat_fprint1(file, o10); \
-} while(0)
+#define NEAT_MAP13(m, o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13) \
+m(o1) m(o2) m(o3) m(o4) m(o5) m(o6) m(o7) m(o8) m(o9) m(o10) m(o11) m(o12) m(o13)
 
-#define neat_fprint11(file, o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11) do { \
-neat_fprint10(file, o1, o2, o3, o4, o5, o6, o7, o8, o9, o10); \
-neat_fprint1(file, o11); \
-} while(0)
+#define NEAT_MAP14(m, o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14) \
+m(o1) m(o2) m(o3) m(o4) m(o5) m(o6) m(o7) m(o8) m(o9) m(o10) m(o11) m(o12) m(o13) m(o14)
 
-#define neat_fprint12(file, o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12) do { \
-neat_fprint11(file, o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11); \
-neat_fprint1(file, o12); \
-} while(0)
+#define NEAT_MAP15(m, o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15) \
+m(o1) m(o2) m(o3) m(o4) m(o5) m(o6) m(o7) m(o8) m(o9) m(o10) m(o11) m(o12) m(o13) m(o14) m(o15)
 
-#define neat_fprint13(file, o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13) do { \
-neat_fprint12(file, o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12); \
-neat_fprint1(file, o13); \
-} while(0)
+#define NEAT_MAP16(m, o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16) \
+m(o1) m(o2) m(o3) m(o4) m(o5) m(o6) m(o7) m(o8) m(o9) m(o10) m(o11) m(o12) m(o13) m(o14) m(o15) m(o16)
 
-#define neat_fprint14(file, o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14) do { \
-neat_fprint13(file, o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13); \
-neat_fprint1(file, o14); \
-} while(0)
+#define NEAT_MAP17(m, o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17) \
+m(o1) m(o2) m(o3) m(o4) m(o5) m(o6) m(o7) m(o8) m(o9) m(o10) m(o11) m(o12) m(o13) m(o14) m(o15) m(o16) m(o17)
 
-#define neat_fprint15(file, o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15) do { \
-neat_fprint14(file, o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14); \
-neat_fprint1(file, o15); \
-} while(0)
+#define NEAT_MAP18(m, o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18) \
+m(o1) m(o2) m(o3) m(o4) m(o5) m(o6) m(o7) m(o8) m(o9) m(o10) m(o11) m(o12) m(o13) m(o14) m(o15) m(o16) m(o17) m(o18)
 
-#define neat_fprint16(file, o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16) do { \
-neat_fprint15(file, o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15); \
-neat_fprint1(file, o16); \
-} while(0)
+#define NEAT_MAP19(m, o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19) \
+m(o1) m(o2) m(o3) m(o4) m(o5) m(o6) m(o7) m(o8) m(o9) m(o10) m(o11) m(o12) m(o13) m(o14) m(o15) m(o16) m(o17) m(o18) m(o19)
 
-#define neat_fprint17(file, o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17) do { \
-neat_fprint16(file, o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16); \
-neat_fprint1(file, o17); \
-} while(0)
+#define NEAT_MAP20(m, o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20) \
+m(o1) m(o2) m(o3) m(o4) m(o5) m(o6) m(o7) m(o8) m(o9) m(o10) m(o11) m(o12) m(o13) m(o14) m(o15) m(o16) m(o17) m(o18) m(o19) m(o20)
 
-#define neat_fprint18(file, o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18) do { \
-neat_fprint17(file, o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17); \
-neat_fprint1(file, o18); \
-} while(0)
+#define NEAT_MAP21(m, o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21) \
+m(o1) m(o2) m(o3) m(o4) m(o5) m(o6) m(o7) m(o8) m(o9) m(o10) m(o11) m(o12) m(o13) m(o14) m(o15) m(o16) m(o17) m(o18) m(o19) m(o20) m(o21)
 
-#define neat_fprint19(file, o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19) do { \
-neat_fprint18(file, o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18); \
-neat_fprint1(file, o19); \
-} while(0)
+#define NEAT_MAP22(m, o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22) \
+m(o1) m(o2) m(o3) m(o4) m(o5) m(o6) m(o7) m(o8) m(o9) m(o10) m(o11) m(o12) m(o13) m(o14) m(o15) m(o16) m(o17) m(o18) m(o19) m(o20) m(o21) m(o22)
 
-#define neat_fprint20(file, o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20) do { \
-neat_fprint19(file, o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19); \
-neat_fprint1(file, o20); \
-} while(0)
+#define NEAT_MAP23(m, o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22, o23) \
+m(o1) m(o2) m(o3) m(o4) m(o5) m(o6) m(o7) m(o8) m(o9) m(o10) m(o11) m(o12) m(o13) m(o14) m(o15) m(o16) m(o17) m(o18) m(o19) m(o20) m(o21) m(o22) m(o23)
 
-#define neat_fprint21(file, o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21) do { \
-neat_fprint20(file, o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20); \
-neat_fprint1(file, o21); \
-} while(0)
+#define NEAT_MAP24(m, o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22, o23, o24) \
+m(o1) m(o2) m(o3) m(o4) m(o5) m(o6) m(o7) m(o8) m(o9) m(o10) m(o11) m(o12) m(o13) m(o14) m(o15) m(o16) m(o17) m(o18) m(o19) m(o20) m(o21) m(o22) m(o23) m(o24)
 
-#define neat_fprint22(file, o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22) do { \
-neat_fprint21(file, o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21); \
-neat_fprint1(file, o22); \
-} while(0)
+#define NEAT_MAP25(m, o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22, o23, o24, o25) \
+m(o1) m(o2) m(o3) m(o4) m(o5) m(o6) m(o7) m(o8) m(o9) m(o10) m(o11) m(o12) m(o13) m(o14) m(o15) m(o16) m(o17) m(o18) m(o19) m(o20) m(o21) m(o22) m(o23) m(o24) m(o25)
 
-#define neat_fprint23(file, o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22, o23) do { \
-neat_fprint22(file, o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22); \
-neat_fprint1(file, o23); \
-} while(0)
+#define NEAT_MAP26(m, o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22, o23, o24, o25, o26) \
+m(o1) m(o2) m(o3) m(o4) m(o5) m(o6) m(o7) m(o8) m(o9) m(o10) m(o11) m(o12) m(o13) m(o14) m(o15) m(o16) m(o17) m(o18) m(o19) m(o20) m(o21) m(o22) m(o23) m(o24) m(o25) m(o26)
 
-#define neat_fprint24(file, o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22, o23, o24) do { \
-neat_fprint23(file, o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22, o23); \
-neat_fprint1(file, o24); \
-} while(0)
+#define NEAT_MAP27(m, o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22, o23, o24, o25, o26, o27) \
+m(o1) m(o2) m(o3) m(o4) m(o5) m(o6) m(o7) m(o8) m(o9) m(o10) m(o11) m(o12) m(o13) m(o14) m(o15) m(o16) m(o17) m(o18) m(o19) m(o20) m(o21) m(o22) m(o23) m(o24) m(o25) m(o26) m(o27)
 
-#define neat_fprint25(file, o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22, o23, o24, o25) do { \
-neat_fprint24(file, o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22, o23, o24); \
-neat_fprint1(file, o25); \
-} while(0)
+#define NEAT_MAP28(m, o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22, o23, o24, o25, o26, o27, o28) \
+m(o1) m(o2) m(o3) m(o4) m(o5) m(o6) m(o7) m(o8) m(o9) m(o10) m(o11) m(o12) m(o13) m(o14) m(o15) m(o16) m(o17) m(o18) m(o19) m(o20) m(o21) m(o22) m(o23) m(o24) m(o25) m(o26) m(o27) m(o28)
 
-#define neat_fprint26(file, o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22, o23, o24, o25, o26) do { \
-neat_fprint25(file, o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22, o23, o24, o25); \
-neat_fprint1(file, o26); \
-} while(0)
+#define NEAT_MAP29(m, o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22, o23, o24, o25, o26, o27, o28, o29) \
+m(o1) m(o2) m(o3) m(o4) m(o5) m(o6) m(o7) m(o8) m(o9) m(o10) m(o11) m(o12) m(o13) m(o14) m(o15) m(o16) m(o17) m(o18) m(o19) m(o20) m(o21) m(o22) m(o23) m(o24) m(o25) m(o26) m(o27) m(o28) m(o29)
 
-#define neat_fprint27(file, o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22, o23, o24, o25, o26, o27) do { \
-neat_fprint26(file, o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22, o23, o24, o25, o26); \
-neat_fprint1(file, o27); \
-} while(0)
+#define NEAT_MAP30(m, o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22, o23, o24, o25, o26, o27, o28, o29, o30) \
+m(o1) m(o2) m(o3) m(o4) m(o5) m(o6) m(o7) m(o8) m(o9) m(o10) m(o11) m(o12) m(o13) m(o14) m(o15) m(o16) m(o17) m(o18) m(o19) m(o20) m(o21) m(o22) m(o23) m(o24) m(o25) m(o26) m(o27) m(o28) m(o29) m(o30)
 
-#define neat_fprint28(file, o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22, o23, o24, o25, o26, o27, o28) do { \
-neat_fprint27(file, o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22, o23, o24, o25, o26, o27); \
-neat_fprint1(file, o28); \
-} while(0)
+#define NEAT_MAP31(m, o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22, o23, o24, o25, o26, o27, o28, o29, o30, o31) \
+m(o1) m(o2) m(o3) m(o4) m(o5) m(o6) m(o7) m(o8) m(o9) m(o10) m(o11) m(o12) m(o13) m(o14) m(o15) m(o16) m(o17) m(o18) m(o19) m(o20) m(o21) m(o22) m(o23) m(o24) m(o25) m(o26) m(o27) m(o28) m(o29) m(o30) m(o31)
 
-#define neat_fprint29(file, o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22, o23, o24, o25, o26, o27, o28, o29) do { \
-neat_fprint28(file, o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22, o23, o24, o25, o26, o27, o28); \
-neat_fprint1(file, o29); \
-} while(0)
+#define NEAT_MAP32(m, o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22, o23, o24, o25, o26, o27, o28, o29, o30, o31, o32) \
+m(o1) m(o2) m(o3) m(o4) m(o5) m(o6) m(o7) m(o8) m(o9) m(o10) m(o11) m(o12) m(o13) m(o14) m(o15) m(o16) m(o17) m(o18) m(o19) m(o20) m(o21) m(o22) m(o23) m(o24) m(o25) m(o26) m(o27) m(o28) m(o29) m(o30) m(o31) m(o32)
 
-#define neat_fprint30(file, o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22, o23, o24, o25, o26, o27, o28, o29, o30) do { \
-neat_fprint29(file, o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22, o23, o24, o25, o26, o27, o28, o29); \
-neat_fprint1(file, o30); \
-} while(0)
+#define NEAT_MAP33(m, o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22, o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33) \
+m(o1) m(o2) m(o3) m(o4) m(o5) m(o6) m(o7) m(o8) m(o9) m(o10) m(o11) m(o12) m(o13) m(o14) m(o15) m(o16) m(o17) m(o18) m(o19) m(o20) m(o21) m(o22) m(o23) m(o24) m(o25) m(o26) m(o27) m(o28) m(o29) m(o30) m(o31) m(o32) m(o33)
 
-#define neat_fprint31(file, o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22, o23, o24, o25, o26, o27, o28, o29, o30, o31) do { \
-neat_fprint30(file, o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22, o23, o24, o25, o26, o27, o28, o29, o30); \
-neat_fprint1(file, o31); \
-} while(0)
+#define NEAT_MAP34(m, o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22, o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34) \
+m(o1) m(o2) m(o3) m(o4) m(o5) m(o6) m(o7) m(o8) m(o9) m(o10) m(o11) m(o12) m(o13) m(o14) m(o15) m(o16) m(o17) m(o18) m(o19) m(o20) m(o21) m(o22) m(o23) m(o24) m(o25) m(o26) m(o27) m(o28) m(o29) m(o30) m(o31) m(o32) m(o33) m(o34)
 
-#define neat_fprint32(file, o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22, o23, o24, o25, o26, o27, o28, o29, o30, o31, o32) do { \
-neat_fprint31(file, o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22, o23, o24, o25, o26, o27, o28, o29, o30, o31); \
-neat_fprint1(file, o32); \
-} while(0)
+#define NEAT_MAP35(m, o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22, o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35) \
+m(o1) m(o2) m(o3) m(o4) m(o5) m(o6) m(o7) m(o8) m(o9) m(o10) m(o11) m(o12) m(o13) m(o14) m(o15) m(o16) m(o17) m(o18) m(o19) m(o20) m(o21) m(o22) m(o23) m(o24) m(o25) m(o26) m(o27) m(o28) m(o29) m(o30) m(o31) m(o32) m(o33) m(o34) m(o35)
 
-#define neat_fprint33(file, o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22, o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33) do { \
-neat_fprint32(file, o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22, o23, o24, o25, o26, o27, o28, o29, o30, o31, o32); \
-neat_fprint1(file, o33); \
-} while(0)
+#define NEAT_MAP36(m, o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22, o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35, o36) \
+m(o1) m(o2) m(o3) m(o4) m(o5) m(o6) m(o7) m(o8) m(o9) m(o10) m(o11) m(o12) m(o13) m(o14) m(o15) m(o16) m(o17) m(o18) m(o19) m(o20) m(o21) m(o22) m(o23) m(o24) m(o25) m(o26) m(o27) m(o28) m(o29) m(o30) m(o31) m(o32) m(o33) m(o34) m(o35) m(o36)
 
-#define neat_fprint34(file, o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22, o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34) do { \
-neat_fprint33(file, o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22, o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33); \
-neat_fprint1(file, o34); \
-} while(0)
+#define NEAT_MAP37(m, o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22, o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35, o36, o37) \
+m(o1) m(o2) m(o3) m(o4) m(o5) m(o6) m(o7) m(o8) m(o9) m(o10) m(o11) m(o12) m(o13) m(o14) m(o15) m(o16) m(o17) m(o18) m(o19) m(o20) m(o21) m(o22) m(o23) m(o24) m(o25) m(o26) m(o27) m(o28) m(o29) m(o30) m(o31) m(o32) m(o33) m(o34) m(o35) m(o36) m(o37)
 
-#define neat_fprint35(file, o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22, o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35) do { \
-neat_fprint34(file, o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22, o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34); \
-neat_fprint1(file, o35); \
-} while(0)
+#define NEAT_MAP38(m, o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22, o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35, o36, o37, o38) \
+m(o1) m(o2) m(o3) m(o4) m(o5) m(o6) m(o7) m(o8) m(o9) m(o10) m(o11) m(o12) m(o13) m(o14) m(o15) m(o16) m(o17) m(o18) m(o19) m(o20) m(o21) m(o22) m(o23) m(o24) m(o25) m(o26) m(o27) m(o28) m(o29) m(o30) m(o31) m(o32) m(o33) m(o34) m(o35) m(o36) m(o37) m(o38)
 
-#define neat_fprint36(file, o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22, o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35, o36) do { \
-neat_fprint35(file, o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22, o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35); \
-neat_fprint1(file, o36); \
-} while(0)
+#define NEAT_MAP39(m, o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22, o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35, o36, o37, o38, o39) \
+m(o1) m(o2) m(o3) m(o4) m(o5) m(o6) m(o7) m(o8) m(o9) m(o10) m(o11) m(o12) m(o13) m(o14) m(o15) m(o16) m(o17) m(o18) m(o19) m(o20) m(o21) m(o22) m(o23) m(o24) m(o25) m(o26) m(o27) m(o28) m(o29) m(o30) m(o31) m(o32) m(o33) m(o34) m(o35) m(o36) m(o37) m(o38) m(o39)
 
-#define neat_fprint37(file, o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22, o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35, o36, o37) do { \
-neat_fprint36(file, o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22, o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35, o36); \
-neat_fprint1(file, o37); \
-} while(0)
+#define NEAT_MAP40(m, o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22, o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35, o36, o37, o38, o39, o40) \
+m(o1) m(o2) m(o3) m(o4) m(o5) m(o6) m(o7) m(o8) m(o9) m(o10) m(o11) m(o12) m(o13) m(o14) m(o15) m(o16) m(o17) m(o18) m(o19) m(o20) m(o21) m(o22) m(o23) m(o24) m(o25) m(o26) m(o27) m(o28) m(o29) m(o30) m(o31) m(o32) m(o33) m(o34) m(o35) m(o36) m(o37) m(o38) m(o39) m(o40)
 
-#define neat_fprint38(file, o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22, o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35, o36, o37, o38) do { \
-neat_fprint37(file, o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22, o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35, o36, o37); \
-neat_fprint1(file, o38); \
-} while(0)
+#define NEAT_MAP41(m, o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22, o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35, o36, o37, o38, o39, o40, o41) \
+m(o1) m(o2) m(o3) m(o4) m(o5) m(o6) m(o7) m(o8) m(o9) m(o10) m(o11) m(o12) m(o13) m(o14) m(o15) m(o16) m(o17) m(o18) m(o19) m(o20) m(o21) m(o22) m(o23) m(o24) m(o25) m(o26) m(o27) m(o28) m(o29) m(o30) m(o31) m(o32) m(o33) m(o34) m(o35) m(o36) m(o37) m(o38) m(o39) m(o40) m(o41)
 
-#define neat_fprint39(file, o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22, o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35, o36, o37, o38, o39) do { \
-neat_fprint38(file, o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22, o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35, o36, o37, o38); \
-neat_fprint1(file, o39); \
-} while(0)
+#define NEAT_MAP42(m, o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22, o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35, o36, o37, o38, o39, o40, o41, o42) \
+m(o1) m(o2) m(o3) m(o4) m(o5) m(o6) m(o7) m(o8) m(o9) m(o10) m(o11) m(o12) m(o13) m(o14) m(o15) m(o16) m(o17) m(o18) m(o19) m(o20) m(o21) m(o22) m(o23) m(o24) m(o25) m(o26) m(o27) m(o28) m(o29) m(o30) m(o31) m(o32) m(o33) m(o34) m(o35) m(o36) m(o37) m(o38) m(o39) m(o40) m(o41) m(o42)
 
-#define neat_fprint40(file, o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22, o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35, o36, o37, o38, o39, o40) do { \
-neat_fprint39(file, o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22, o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35, o36, o37, o38, o39); \
-neat_fprint1(file, o40); \
-} while(0)
+#define NEAT_MAP43(m, o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22, o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35, o36, o37, o38, o39, o40, o41, o42, o43) \
+m(o1) m(o2) m(o3) m(o4) m(o5) m(o6) m(o7) m(o8) m(o9) m(o10) m(o11) m(o12) m(o13) m(o14) m(o15) m(o16) m(o17) m(o18) m(o19) m(o20) m(o21) m(o22) m(o23) m(o24) m(o25) m(o26) m(o27) m(o28) m(o29) m(o30) m(o31) m(o32) m(o33) m(o34) m(o35) m(o36) m(o37) m(o38) m(o39) m(o40) m(o41) m(o42) m(o43)
 
-#define neat_fprint41(file, o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22, o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35, o36, o37, o38, o39, o40, o41) do { \
-neat_fprint40(file, o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22, o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35, o36, o37, o38, o39, o40); \
-neat_fprint1(file, o41); \
-} while(0)
+#define NEAT_MAP44(m, o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22, o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35, o36, o37, o38, o39, o40, o41, o42, o43, o44) \
+m(o1) m(o2) m(o3) m(o4) m(o5) m(o6) m(o7) m(o8) m(o9) m(o10) m(o11) m(o12) m(o13) m(o14) m(o15) m(o16) m(o17) m(o18) m(o19) m(o20) m(o21) m(o22) m(o23) m(o24) m(o25) m(o26) m(o27) m(o28) m(o29) m(o30) m(o31) m(o32) m(o33) m(o34) m(o35) m(o36) m(o37) m(o38) m(o39) m(o40) m(o41) m(o42) m(o43) m(o44)
 
-#define neat_fprint42(file, o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22, o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35, o36, o37, o38, o39, o40, o41, o42) do { \
-neat_fprint41(file, o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22, o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35, o36, o37, o38, o39, o40, o41); \
-neat_fprint1(file, o42); \
-} while(0)
+#define NEAT_MAP45(m, o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22, o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35, o36, o37, o38, o39, o40, o41, o42, o43, o44, o45) \
+m(o1) m(o2) m(o3) m(o4) m(o5) m(o6) m(o7) m(o8) m(o9) m(o10) m(o11) m(o12) m(o13) m(o14) m(o15) m(o16) m(o17) m(o18) m(o19) m(o20) m(o21) m(o22) m(o23) m(o24) m(o25) m(o26) m(o27) m(o28) m(o29) m(o30) m(o31) m(o32) m(o33) m(o34) m(o35) m(o36) m(o37) m(o38) m(o39) m(o40) m(o41) m(o42) m(o43) m(o44) m(o45)
 
-#define neat_fprint43(file, o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22, o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35, o36, o37, o38, o39, o40, o41, o42, o43) do { \
-neat_fprint42(file, o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22, o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35, o36, o37, o38, o39, o40, o41, o42); \
-neat_fprint1(file, o43); \
-} while(0)
+#define NEAT_MAP46(m, o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22, o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35, o36, o37, o38, o39, o40, o41, o42, o43, o44, o45, o46) \
+m(o1) m(o2) m(o3) m(o4) m(o5) m(o6) m(o7) m(o8) m(o9) m(o10) m(o11) m(o12) m(o13) m(o14) m(o15) m(o16) m(o17) m(o18) m(o19) m(o20) m(o21) m(o22) m(o23) m(o24) m(o25) m(o26) m(o27) m(o28) m(o29) m(o30) m(o31) m(o32) m(o33) m(o34) m(o35) m(o36) m(o37) m(o38) m(o39) m(o40) m(o41) m(o42) m(o43) m(o44) m(o45) m(o46)
 
-#define neat_fprint44(file, o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22, o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35, o36, o37, o38, o39, o40, o41, o42, o43, o44) do { \
-neat_fprint43(file, o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22, o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35, o36, o37, o38, o39, o40, o41, o42, o43); \
-neat_fprint1(file, o44); \
-} while(0)
+#define NEAT_MAP47(m, o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22, o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35, o36, o37, o38, o39, o40, o41, o42, o43, o44, o45, o46, o47) \
+m(o1) m(o2) m(o3) m(o4) m(o5) m(o6) m(o7) m(o8) m(o9) m(o10) m(o11) m(o12) m(o13) m(o14) m(o15) m(o16) m(o17) m(o18) m(o19) m(o20) m(o21) m(o22) m(o23) m(o24) m(o25) m(o26) m(o27) m(o28) m(o29) m(o30) m(o31) m(o32) m(o33) m(o34) m(o35) m(o36) m(o37) m(o38) m(o39) m(o40) m(o41) m(o42) m(o43) m(o44) m(o45) m(o46) m(o47)
 
-#define neat_fprint45(file, o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22, o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35, o36, o37, o38, o39, o40, o41, o42, o43, o44, o45) do { \
-neat_fprint44(file, o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22, o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35, o36, o37, o38, o39, o40, o41, o42, o43, o44); \
-neat_fprint1(file, o45); \
-} while(0)
+#define NEAT_MAP48(m, o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22, o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35, o36, o37, o38, o39, o40, o41, o42, o43, o44, o45, o46, o47, o48) \
+m(o1) m(o2) m(o3) m(o4) m(o5) m(o6) m(o7) m(o8) m(o9) m(o10) m(o11) m(o12) m(o13) m(o14) m(o15) m(o16) m(o17) m(o18) m(o19) m(o20) m(o21) m(o22) m(o23) m(o24) m(o25) m(o26) m(o27) m(o28) m(o29) m(o30) m(o31) m(o32) m(o33) m(o34) m(o35) m(o36) m(o37) m(o38) m(o39) m(o40) m(o41) m(o42) m(o43) m(o44) m(o45) m(o46) m(o47) m(o48)
 
-#define neat_fprint46(file, o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22, o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35, o36, o37, o38, o39, o40, o41, o42, o43, o44, o45, o46) do { \
-neat_fprint45(file, o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22, o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35, o36, o37, o38, o39, o40, o41, o42, o43, o44, o45); \
-neat_fprint1(file, o46); \
-} while(0)
+#define NEAT_MAP49(m, o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22, o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35, o36, o37, o38, o39, o40, o41, o42, o43, o44, o45, o46, o47, o48, o49) \
+m(o1) m(o2) m(o3) m(o4) m(o5) m(o6) m(o7) m(o8) m(o9) m(o10) m(o11) m(o12) m(o13) m(o14) m(o15) m(o16) m(o17) m(o18) m(o19) m(o20) m(o21) m(o22) m(o23) m(o24) m(o25) m(o26) m(o27) m(o28) m(o29) m(o30) m(o31) m(o32) m(o33) m(o34) m(o35) m(o36) m(o37) m(o38) m(o39) m(o40) m(o41) m(o42) m(o43) m(o44) m(o45) m(o46) m(o47) m(o48) m(o49)
 
-#define neat_fprint47(file, o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22, o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35, o36, o37, o38, o39, o40, o41, o42, o43, o44, o45, o46, o47) do { \
-neat_fprint46(file, o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22, o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35, o36, o37, o38, o39, o40, o41, o42, o43, o44, o45, o46); \
-neat_fprint1(file, o47); \
-} while(0)
+#define NEAT_MAP50(m, o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22, o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35, o36, o37, o38, o39, o40, o41, o42, o43, o44, o45, o46, o47, o48, o49, o50) \
+m(o1) m(o2) m(o3) m(o4) m(o5) m(o6) m(o7) m(o8) m(o9) m(o10) m(o11) m(o12) m(o13) m(o14) m(o15) m(o16) m(o17) m(o18) m(o19) m(o20) m(o21) m(o22) m(o23) m(o24) m(o25) m(o26) m(o27) m(o28) m(o29) m(o30) m(o31) m(o32) m(o33) m(o34) m(o35) m(o36) m(o37) m(o38) m(o39) m(o40) m(o41) m(o42) m(o43) m(o44) m(o45) m(o46) m(o47) m(o48) m(o49) m(o50)
 
-#define neat_fprint48(file, o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22, o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35, o36, o37, o38, o39, o40, o41, o42, o43, o44, o45, o46, o47, o48) do { \
-neat_fprint47(file, o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22, o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35, o36, o37, o38, o39, o40, o41, o42, o43, o44, o45, o46, o47); \
-neat_fprint1(file, o48); \
-} while(0)
+#define NEAT_MAP51(m, o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22, o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35, o36, o37, o38, o39, o40, o41, o42, o43, o44, o45, o46, o47, o48, o49, o50, o51) \
+m(o1) m(o2) m(o3) m(o4) m(o5) m(o6) m(o7) m(o8) m(o9) m(o10) m(o11) m(o12) m(o13) m(o14) m(o15) m(o16) m(o17) m(o18) m(o19) m(o20) m(o21) m(o22) m(o23) m(o24) m(o25) m(o26) m(o27) m(o28) m(o29) m(o30) m(o31) m(o32) m(o33) m(o34) m(o35) m(o36) m(o37) m(o38) m(o39) m(o40) m(o41) m(o42) m(o43) m(o44) m(o45) m(o46) m(o47) m(o48) m(o49) m(o50) m(o51)
 
-#define neat_fprint49(file, o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22, o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35, o36, o37, o38, o39, o40, o41, o42, o43, o44, o45, o46, o47, o48, o49) do { \
-neat_fprint48(file, o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22, o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35, o36, o37, o38, o39, o40, o41, o42, o43, o44, o45, o46, o47, o48); \
-neat_fprint1(file, o49); \
-} while(0)
+#define NEAT_MAP52(m, o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22, o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35, o36, o37, o38, o39, o40, o41, o42, o43, o44, o45, o46, o47, o48, o49, o50, o51, o52) \
+m(o1) m(o2) m(o3) m(o4) m(o5) m(o6) m(o7) m(o8) m(o9) m(o10) m(o11) m(o12) m(o13) m(o14) m(o15) m(o16) m(o17) m(o18) m(o19) m(o20) m(o21) m(o22) m(o23) m(o24) m(o25) m(o26) m(o27) m(o28) m(o29) m(o30) m(o31) m(o32) m(o33) m(o34) m(o35) m(o36) m(o37) m(o38) m(o39) m(o40) m(o41) m(o42) m(o43) m(o44) m(o45) m(o46) m(o47) m(o48) m(o49) m(o50) m(o51) m(o52)
 
-#define neat_fprint50(file, o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22, o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35, o36, o37, o38, o39, o40, o41, o42, o43, o44, o45, o46, o47, o48, o49, o50) do { \
-neat_fprint49(file, o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22, o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35, o36, o37, o38, o39, o40, o41, o42, o43, o44, o45, o46, o47, o48, o49); \
-neat_fprint1(file, o50); \
-} while(0)
+#define NEAT_MAP53(m, o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22, o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35, o36, o37, o38, o39, o40, o41, o42, o43, o44, o45, o46, o47, o48, o49, o50, o51, o52, o53) \
+m(o1) m(o2) m(o3) m(o4) m(o5) m(o6) m(o7) m(o8) m(o9) m(o10) m(o11) m(o12) m(o13) m(o14) m(o15) m(o16) m(o17) m(o18) m(o19) m(o20) m(o21) m(o22) m(o23) m(o24) m(o25) m(o26) m(o27) m(o28) m(o29) m(o30) m(o31) m(o32) m(o33) m(o34) m(o35) m(o36) m(o37) m(o38) m(o39) m(o40) m(o41) m(o42) m(o43) m(o44) m(o45) m(o46) m(o47) m(o48) m(o49) m(o50) m(o51) m(o52) m(o53)
 
-#define neat_fprint51(file, o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22, o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35, o36, o37, o38, o39, o40, o41, o42, o43, o44, o45, o46, o47, o48, o49, o50, o51) do { \
-neat_fprint50(file, o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22, o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35, o36, o37, o38, o39, o40, o41, o42, o43, o44, o45, o46, o47, o48, o49, o50); \
-neat_fprint1(file, o51); \
-} while(0)
+#define NEAT_MAP54(m, o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22, o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35, o36, o37, o38, o39, o40, o41, o42, o43, o44, o45, o46, o47, o48, o49, o50, o51, o52, o53, o54) \
+m(o1) m(o2) m(o3) m(o4) m(o5) m(o6) m(o7) m(o8) m(o9) m(o10) m(o11) m(o12) m(o13) m(o14) m(o15) m(o16) m(o17) m(o18) m(o19) m(o20) m(o21) m(o22) m(o23) m(o24) m(o25) m(o26) m(o27) m(o28) m(o29) m(o30) m(o31) m(o32) m(o33) m(o34) m(o35) m(o36) m(o37) m(o38) m(o39) m(o40) m(o41) m(o42) m(o43) m(o44) m(o45) m(o46) m(o47) m(o48) m(o49) m(o50) m(o51) m(o52) m(o53) m(o54)
 
-#define neat_fprint52(file, o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22, o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35, o36, o37, o38, o39, o40, o41, o42, o43, o44, o45, o46, o47, o48, o49, o50, o51, o52) do { \
-neat_fprint51(file, o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22, o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35, o36, o37, o38, o39, o40, o41, o42, o43, o44, o45, o46, o47, o48, o49, o50, o51); \
-neat_fprint1(file, o52); \
-} while(0)
+#define NEAT_MAP55(m, o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22, o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35, o36, o37, o38, o39, o40, o41, o42, o43, o44, o45, o46, o47, o48, o49, o50, o51, o52, o53, o54, o55) \
+m(o1) m(o2) m(o3) m(o4) m(o5) m(o6) m(o7) m(o8) m(o9) m(o10) m(o11) m(o12) m(o13) m(o14) m(o15) m(o16) m(o17) m(o18) m(o19) m(o20) m(o21) m(o22) m(o23) m(o24) m(o25) m(o26) m(o27) m(o28) m(o29) m(o30) m(o31) m(o32) m(o33) m(o34) m(o35) m(o36) m(o37) m(o38) m(o39) m(o40) m(o41) m(o42) m(o43) m(o44) m(o45) m(o46) m(o47) m(o48) m(o49) m(o50) m(o51) m(o52) m(o53) m(o54) m(o55)
 
-#define neat_fprint53(file, o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22, o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35, o36, o37, o38, o39, o40, o41, o42, o43, o44, o45, o46, o47, o48, o49, o50, o51, o52, o53) do { \
-neat_fprint52(file, o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22, o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35, o36, o37, o38, o39, o40, o41, o42, o43, o44, o45, o46, o47, o48, o49, o50, o51, o52); \
-neat_fprint1(file, o53); \
-} while(0)
+#define NEAT_MAP56(m, o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22, o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35, o36, o37, o38, o39, o40, o41, o42, o43, o44, o45, o46, o47, o48, o49, o50, o51, o52, o53, o54, o55, o56) \
+m(o1) m(o2) m(o3) m(o4) m(o5) m(o6) m(o7) m(o8) m(o9) m(o10) m(o11) m(o12) m(o13) m(o14) m(o15) m(o16) m(o17) m(o18) m(o19) m(o20) m(o21) m(o22) m(o23) m(o24) m(o25) m(o26) m(o27) m(o28) m(o29) m(o30) m(o31) m(o32) m(o33) m(o34) m(o35) m(o36) m(o37) m(o38) m(o39) m(o40) m(o41) m(o42) m(o43) m(o44) m(o45) m(o46) m(o47) m(o48) m(o49) m(o50) m(o51) m(o52) m(o53) m(o54) m(o55) m(o56)
 
-#define neat_fprint54(file, o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22, o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35, o36, o37, o38, o39, o40, o41, o42, o43, o44, o45, o46, o47, o48, o49, o50, o51, o52, o53, o54) do { \
-neat_fprint53(file, o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22, o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35, o36, o37, o38, o39, o40, o41, o42, o43, o44, o45, o46, o47, o48, o49, o50, o51, o52, o53); \
-neat_fprint1(file, o54); \
-} while(0)
+#define NEAT_MAP57(m, o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22, o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35, o36, o37, o38, o39, o40, o41, o42, o43, o44, o45, o46, o47, o48, o49, o50, o51, o52, o53, o54, o55, o56, o57) \
+m(o1) m(o2) m(o3) m(o4) m(o5) m(o6) m(o7) m(o8) m(o9) m(o10) m(o11) m(o12) m(o13) m(o14) m(o15) m(o16) m(o17) m(o18) m(o19) m(o20) m(o21) m(o22) m(o23) m(o24) m(o25) m(o26) m(o27) m(o28) m(o29) m(o30) m(o31) m(o32) m(o33) m(o34) m(o35) m(o36) m(o37) m(o38) m(o39) m(o40) m(o41) m(o42) m(o43) m(o44) m(o45) m(o46) m(o47) m(o48) m(o49) m(o50) m(o51) m(o52) m(o53) m(o54) m(o55) m(o56) m(o57)
 
-#define neat_fprint55(file, o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22, o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35, o36, o37, o38, o39, o40, o41, o42, o43, o44, o45, o46, o47, o48, o49, o50, o51, o52, o53, o54, o55) do { \
-neat_fprint54(file, o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22, o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35, o36, o37, o38, o39, o40, o41, o42, o43, o44, o45, o46, o47, o48, o49, o50, o51, o52, o53, o54); \
-neat_fprint1(file, o55); \
-} while(0)
+#define NEAT_MAP58(m, o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22, o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35, o36, o37, o38, o39, o40, o41, o42, o43, o44, o45, o46, o47, o48, o49, o50, o51, o52, o53, o54, o55, o56, o57, o58) \
+m(o1) m(o2) m(o3) m(o4) m(o5) m(o6) m(o7) m(o8) m(o9) m(o10) m(o11) m(o12) m(o13) m(o14) m(o15) m(o16) m(o17) m(o18) m(o19) m(o20) m(o21) m(o22) m(o23) m(o24) m(o25) m(o26) m(o27) m(o28) m(o29) m(o30) m(o31) m(o32) m(o33) m(o34) m(o35) m(o36) m(o37) m(o38) m(o39) m(o40) m(o41) m(o42) m(o43) m(o44) m(o45) m(o46) m(o47) m(o48) m(o49) m(o50) m(o51) m(o52) m(o53) m(o54) m(o55) m(o56) m(o57) m(o58)
 
-#define neat_fprint56(file, o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22, o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35, o36, o37, o38, o39, o40, o41, o42, o43, o44, o45, o46, o47, o48, o49, o50, o51, o52, o53, o54, o55, o56) do { \
-neat_fprint55(file, o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22, o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35, o36, o37, o38, o39, o40, o41, o42, o43, o44, o45, o46, o47, o48, o49, o50, o51, o52, o53, o54, o55); \
-neat_fprint1(file, o56); \
-} while(0)
+#define NEAT_MAP59(m, o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22, o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35, o36, o37, o38, o39, o40, o41, o42, o43, o44, o45, o46, o47, o48, o49, o50, o51, o52, o53, o54, o55, o56, o57, o58, o59) \
+m(o1) m(o2) m(o3) m(o4) m(o5) m(o6) m(o7) m(o8) m(o9) m(o10) m(o11) m(o12) m(o13) m(o14) m(o15) m(o16) m(o17) m(o18) m(o19) m(o20) m(o21) m(o22) m(o23) m(o24) m(o25) m(o26) m(o27) m(o28) m(o29) m(o30) m(o31) m(o32) m(o33) m(o34) m(o35) m(o36) m(o37) m(o38) m(o39) m(o40) m(o41) m(o42) m(o43) m(o44) m(o45) m(o46) m(o47) m(o48) m(o49) m(o50) m(o51) m(o52) m(o53) m(o54) m(o55) m(o56) m(o57) m(o58) m(o59)
 
-#define neat_fprint57(file, o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22, o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35, o36, o37, o38, o39, o40, o41, o42, o43, o44, o45, o46, o47, o48, o49, o50, o51, o52, o53, o54, o55, o56, o57) do { \
-neat_fprint56(file, o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22, o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35, o36, o37, o38, o39, o40, o41, o42, o43, o44, o45, o46, o47, o48, o49, o50, o51, o52, o53, o54, o55, o56); \
-neat_fprint1(file, o57); \
-} while(0)
+#define NEAT_MAP60(m, o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22, o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35, o36, o37, o38, o39, o40, o41, o42, o43, o44, o45, o46, o47, o48, o49, o50, o51, o52, o53, o54, o55, o56, o57, o58, o59, o60) \
+m(o1) m(o2) m(o3) m(o4) m(o5) m(o6) m(o7) m(o8) m(o9) m(o10) m(o11) m(o12) m(o13) m(o14) m(o15) m(o16) m(o17) m(o18) m(o19) m(o20) m(o21) m(o22) m(o23) m(o24) m(o25) m(o26) m(o27) m(o28) m(o29) m(o30) m(o31) m(o32) m(o33) m(o34) m(o35) m(o36) m(o37) m(o38) m(o39) m(o40) m(o41) m(o42) m(o43) m(o44) m(o45) m(o46) m(o47) m(o48) m(o49) m(o50) m(o51) m(o52) m(o53) m(o54) m(o55) m(o56) m(o57) m(o58) m(o59) m(o60)
 
-#define neat_fprint58(file, o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22, o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35, o36, o37, o38, o39, o40, o41, o42, o43, o44, o45, o46, o47, o48, o49, o50, o51, o52, o53, o54, o55, o56, o57, o58) do { \
-neat_fprint57(file, o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22, o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35, o36, o37, o38, o39, o40, o41, o42, o43, o44, o45, o46, o47, o48, o49, o50, o51, o52, o53, o54, o55, o56, o57); \
-neat_fprint1(file, o58); \
-} while(0)
+#define NEAT_MAP61(m, o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22, o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35, o36, o37, o38, o39, o40, o41, o42, o43, o44, o45, o46, o47, o48, o49, o50, o51, o52, o53, o54, o55, o56, o57, o58, o59, o60, o61) \
+m(o1) m(o2) m(o3) m(o4) m(o5) m(o6) m(o7) m(o8) m(o9) m(o10) m(o11) m(o12) m(o13) m(o14) m(o15) m(o16) m(o17) m(o18) m(o19) m(o20) m(o21) m(o22) m(o23) m(o24) m(o25) m(o26) m(o27) m(o28) m(o29) m(o30) m(o31) m(o32) m(o33) m(o34) m(o35) m(o36) m(o37) m(o38) m(o39) m(o40) m(o41) m(o42) m(o43) m(o44) m(o45) m(o46) m(o47) m(o48) m(o49) m(o50) m(o51) m(o52) m(o53) m(o54) m(o55) m(o56) m(o57) m(o58) m(o59) m(o60) m(o61)
 
-#define neat_fprint59(file, o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22, o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35, o36, o37, o38, o39, o40, o41, o42, o43, o44, o45, o46, o47, o48, o49, o50, o51, o52, o53, o54, o55, o56, o57, o58, o59) do { \
-neat_fprint58(file, o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22, o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35, o36, o37, o38, o39, o40, o41, o42, o43, o44, o45, o46, o47, o48, o49, o50, o51, o52, o53, o54, o55, o56, o57, o58); \
-neat_fprint1(file, o59); \
-} while(0)
+#define NEAT_MAP62(m, o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22, o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35, o36, o37, o38, o39, o40, o41, o42, o43, o44, o45, o46, o47, o48, o49, o50, o51, o52, o53, o54, o55, o56, o57, o58, o59, o60, o61, o62) \
+m(o1) m(o2) m(o3) m(o4) m(o5) m(o6) m(o7) m(o8) m(o9) m(o10) m(o11) m(o12) m(o13) m(o14) m(o15) m(o16) m(o17) m(o18) m(o19) m(o20) m(o21) m(o22) m(o23) m(o24) m(o25) m(o26) m(o27) m(o28) m(o29) m(o30) m(o31) m(o32) m(o33) m(o34) m(o35) m(o36) m(o37) m(o38) m(o39) m(o40) m(o41) m(o42) m(o43) m(o44) m(o45) m(o46) m(o47) m(o48) m(o49) m(o50) m(o51) m(o52) m(o53) m(o54) m(o55) m(o56) m(o57) m(o58) m(o59) m(o60) m(o61) m(o62)
 
-#define neat_fprint60(file, o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22, o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35, o36, o37, o38, o39, o40, o41, o42, o43, o44, o45, o46, o47, o48, o49, o50, o51, o52, o53, o54, o55, o56, o57, o58, o59, o60) do { \
-neat_fprint59(file, o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22, o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35, o36, o37, o38, o39, o40, o41, o42, o43, o44, o45, o46, o47, o48, o49, o50, o51, o52, o53, o54, o55, o56, o57, o58, o59); \
-neat_fprint1(file, o60); \
-} while(0)
+#define NEAT_MAP63(m, o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22, o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35, o36, o37, o38, o39, o40, o41, o42, o43, o44, o45, o46, o47, o48, o49, o50, o51, o52, o53, o54, o55, o56, o57, o58, o59, o60, o61, o62, o63) \
+m(o1) m(o2) m(o3) m(o4) m(o5) m(o6) m(o7) m(o8) m(o9) m(o10) m(o11) m(o12) m(o13) m(o14) m(o15) m(o16) m(o17) m(o18) m(o19) m(o20) m(o21) m(o22) m(o23) m(o24) m(o25) m(o26) m(o27) m(o28) m(o29) m(o30) m(o31) m(o32) m(o33) m(o34) m(o35) m(o36) m(o37) m(o38) m(o39) m(o40) m(o41) m(o42) m(o43) m(o44) m(o45) m(o46) m(o47) m(o48) m(o49) m(o50) m(o51) m(o52) m(o53) m(o54) m(o55) m(o56) m(o57) m(o58) m(o59) m(o60) m(o61) m(o62) m(o63)
 
-#define neat_fprint61(file, o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22, o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35, o36, o37, o38, o39, o40, o41, o42, o43, o44, o45, o46, o47, o48, o49, o50, o51, o52, o53, o54, o55, o56, o57, o58, o59, o60, o61) do { \
-neat_fprint60(file, o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22, o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35, o36, o37, o38, o39, o40, o41, o42, o43, o44, o45, o46, o47, o48, o49, o50, o51, o52, o53, o54, o55, o56, o57, o58, o59, o60); \
-neat_fprint1(file, o61); \
-} while(0)
+#define NEAT_MAP64(m, o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22, o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35, o36, o37, o38, o39, o40, o41, o42, o43, o44, o45, o46, o47, o48, o49, o50, o51, o52, o53, o54, o55, o56, o57, o58, o59, o60, o61, o62, o63, o64) \
+m(o1) m(o2) m(o3) m(o4) m(o5) m(o6) m(o7) m(o8) m(o9) m(o10) m(o11) m(o12) m(o13) m(o14) m(o15) m(o16) m(o17) m(o18) m(o19) m(o20) m(o21) m(o22) m(o23) m(o24) m(o25) m(o26) m(o27) m(o28) m(o29) m(o30) m(o31) m(o32) m(o33) m(o34) m(o35) m(o36) m(o37) m(o38) m(o39) m(o40) m(o41) m(o42) m(o43) m(o44) m(o45) m(o46) m(o47) m(o48) m(o49) m(o50) m(o51) m(o52) m(o53) m(o54) m(o55) m(o56) m(o57) m(o58) m(o59) m(o60) m(o61) m(o62) m(o63) m(o64)
 
-#define neat_fprint62(file, o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22, o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35, o36, o37, o38, o39, o40, o41, o42, o43, o44, o45, o46, o47, o48, o49, o50, o51, o52, o53, o54, o55, o56, o57, o58, o59, o60, o61, o62) do { \
-neat_fprint61(file, o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22, o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35, o36, o37, o38, o39, o40, o41, o42, o43, o44, o45, o46, o47, o48, o49, o50, o51, o52, o53, o54, o55, o56, o57, o58, o59, o60, o61); \
-neat_fprint1(file, o62); \
-} while(0)
+#define NEAT_MAP65(m, o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22, o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35, o36, o37, o38, o39, o40, o41, o42, o43, o44, o45, o46, o47, o48, o49, o50, o51, o52, o53, o54, o55, o56, o57, o58, o59, o60, o61, o62, o63, o64, o65) \
+m(o1) m(o2) m(o3) m(o4) m(o5) m(o6) m(o7) m(o8) m(o9) m(o10) m(o11) m(o12) m(o13) m(o14) m(o15) m(o16) m(o17) m(o18) m(o19) m(o20) m(o21) m(o22) m(o23) m(o24) m(o25) m(o26) m(o27) m(o28) m(o29) m(o30) m(o31) m(o32) m(o33) m(o34) m(o35) m(o36) m(o37) m(o38) m(o39) m(o40) m(o41) m(o42) m(o43) m(o44) m(o45) m(o46) m(o47) m(o48) m(o49) m(o50) m(o51) m(o52) m(o53) m(o54) m(o55) m(o56) m(o57) m(o58) m(o59) m(o60) m(o61) m(o62) m(o63) m(o64) m(o65)
 
-#define neat_fprint63(file, o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22, o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35, o36, o37, o38, o39, o40, o41, o42, o43, o44, o45, o46, o47, o48, o49, o50, o51, o52, o53, o54, o55, o56, o57, o58, o59, o60, o61, o62, o63) do { \
-neat_fprint62(file, o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22, o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35, o36, o37, o38, o39, o40, o41, o42, o43, o44, o45, o46, o47, o48, o49, o50, o51, o52, o53, o54, o55, o56, o57, o58, o59, o60, o61, o62); \
-neat_fprint1(file, o63); \
-} while(0)
+#define NEAT_MAP66(m, o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22, o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35, o36, o37, o38, o39, o40, o41, o42, o43, o44, o45, o46, o47, o48, o49, o50, o51, o52, o53, o54, o55, o56, o57, o58, o59, o60, o61, o62, o63, o64, o65, o66) \
+m(o1) m(o2) m(o3) m(o4) m(o5) m(o6) m(o7) m(o8) m(o9) m(o10) m(o11) m(o12) m(o13) m(o14) m(o15) m(o16) m(o17) m(o18) m(o19) m(o20) m(o21) m(o22) m(o23) m(o24) m(o25) m(o26) m(o27) m(o28) m(o29) m(o30) m(o31) m(o32) m(o33) m(o34) m(o35) m(o36) m(o37) m(o38) m(o39) m(o40) m(o41) m(o42) m(o43) m(o44) m(o45) m(o46) m(o47) m(o48) m(o49) m(o50) m(o51) m(o52) m(o53) m(o54) m(o55) m(o56) m(o57) m(o58) m(o59) m(o60) m(o61) m(o62) m(o63) m(o64) m(o65) m(o66)
 
-#define neat_fprint64(file, o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22, o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35, o36, o37, o38, o39, o40, o41, o42, o43, o44, o45, o46, o47, o48, o49, o50, o51, o52, o53, o54, o55, o56, o57, o58, o59, o60, o61, o62, o63, o64) do { \
-neat_fprint63(file, o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22, o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35, o36, o37, o38, o39, o40, o41, o42, o43, o44, o45, o46, o47, o48, o49, o50, o51, o52, o53, o54, o55, o56, o57, o58, o59, o60, o61, o62, o63); \
-neat_fprint1(file, o64); \
-} while(0)
+#define NEAT_MAP67(m, o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22, o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35, o36, o37, o38, o39, o40, o41, o42, o43, o44, o45, o46, o47, o48, o49, o50, o51, o52, o53, o54, o55, o56, o57, o58, o59, o60, o61, o62, o63, o64, o65, o66, o67) \
+m(o1) m(o2) m(o3) m(o4) m(o5) m(o6) m(o7) m(o8) m(o9) m(o10) m(o11) m(o12) m(o13) m(o14) m(o15) m(o16) m(o17) m(o18) m(o19) m(o20) m(o21) m(o22) m(o23) m(o24) m(o25) m(o26) m(o27) m(o28) m(o29) m(o30) m(o31) m(o32) m(o33) m(o34) m(o35) m(o36) m(o37) m(o38) m(o39) m(o40) m(o41) m(o42) m(o43) m(o44) m(o45) m(o46) m(o47) m(o48) m(o49) m(o50) m(o51) m(o52) m(o53) m(o54) m(o55) m(o56) m(o57) m(o58) m(o59) m(o60) m(o61) m(o62) m(o63) m(o64) m(o65) m(o66) m(o67)
 
-#define neat_fprint65(file, o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22, o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35, o36, o37, o38, o39, o40, o41, o42, o43, o44, o45, o46, o47, o48, o49, o50, o51, o52, o53, o54, o55, o56, o57, o58, o59, o60, o61, o62, o63, o64, o65) do { \
-neat_fprint64(file, o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22, o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35, o36, o37, o38, o39, o40, o41, o42, o43, o44, o45, o46, o47, o48, o49, o50, o51, o52, o53, o54, o55, o56, o57, o58, o59, o60, o61, o62, o63, o64); \
-neat_fprint1(file, o65); \
-} while(0)
+#define NEAT_MAP68(m, o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22, o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35, o36, o37, o38, o39, o40, o41, o42, o43, o44, o45, o46, o47, o48, o49, o50, o51, o52, o53, o54, o55, o56, o57, o58, o59, o60, o61, o62, o63, o64, o65, o66, o67, o68) \
+m(o1) m(o2) m(o3) m(o4) m(o5) m(o6) m(o7) m(o8) m(o9) m(o10) m(o11) m(o12) m(o13) m(o14) m(o15) m(o16) m(o17) m(o18) m(o19) m(o20) m(o21) m(o22) m(o23) m(o24) m(o25) m(o26) m(o27) m(o28) m(o29) m(o30) m(o31) m(o32) m(o33) m(o34) m(o35) m(o36) m(o37) m(o38) m(o39) m(o40) m(o41) m(o42) m(o43) m(o44) m(o45) m(o46) m(o47) m(o48) m(o49) m(o50) m(o51) m(o52) m(o53) m(o54) m(o55) m(o56) m(o57) m(o58) m(o59) m(o60) m(o61) m(o62) m(o63) m(o64) m(o65) m(o66) m(o67) m(o68)
 
-#define neat_fprint66(file, o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22, o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35, o36, o37, o38, o39, o40, o41, o42, o43, o44, o45, o46, o47, o48, o49, o50, o51, o52, o53, o54, o55, o56, o57, o58, o59, o60, o61, o62, o63, o64, o65, o66) do { \
-neat_fprint65(file, o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22, o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35, o36, o37, o38, o39, o40, o41, o42, o43, o44, o45, o46, o47, o48, o49, o50, o51, o52, o53, o54, o55, o56, o57, o58, o59, o60, o61, o62, o63, o64, o65); \
-neat_fprint1(file, o66); \
-} while(0)
+#define NEAT_MAP69(m, o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22, o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35, o36, o37, o38, o39, o40, o41, o42, o43, o44, o45, o46, o47, o48, o49, o50, o51, o52, o53, o54, o55, o56, o57, o58, o59, o60, o61, o62, o63, o64, o65, o66, o67, o68, o69) \
+m(o1) m(o2) m(o3) m(o4) m(o5) m(o6) m(o7) m(o8) m(o9) m(o10) m(o11) m(o12) m(o13) m(o14) m(o15) m(o16) m(o17) m(o18) m(o19) m(o20) m(o21) m(o22) m(o23) m(o24) m(o25) m(o26) m(o27) m(o28) m(o29) m(o30) m(o31) m(o32) m(o33) m(o34) m(o35) m(o36) m(o37) m(o38) m(o39) m(o40) m(o41) m(o42) m(o43) m(o44) m(o45) m(o46) m(o47) m(o48) m(o49) m(o50) m(o51) m(o52) m(o53) m(o54) m(o55) m(o56) m(o57) m(o58) m(o59) m(o60) m(o61) m(o62) m(o63) m(o64) m(o65) m(o66) m(o67) m(o68) m(o69)
 
-#define neat_fprint67(file, o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22, o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35, o36, o37, o38, o39, o40, o41, o42, o43, o44, o45, o46, o47, o48, o49, o50, o51, o52, o53, o54, o55, o56, o57, o58, o59, o60, o61, o62, o63, o64, o65, o66, o67) do { \
-neat_fprint66(file, o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22, o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35, o36, o37, o38, o39, o40, o41, o42, o43, o44, o45, o46, o47, o48, o49, o50, o51, o52, o53, o54, o55, o56, o57, o58, o59, o60, o61, o62, o63, o64, o65, o66); \
-neat_fprint1(file, o67); \
-} while(0)
+#define NEAT_MAP70(m, o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22, o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35, o36, o37, o38, o39, o40, o41, o42, o43, o44, o45, o46, o47, o48, o49, o50, o51, o52, o53, o54, o55, o56, o57, o58, o59, o60, o61, o62, o63, o64, o65, o66, o67, o68, o69, o70) \
+m(o1) m(o2) m(o3) m(o4) m(o5) m(o6) m(o7) m(o8) m(o9) m(o10) m(o11) m(o12) m(o13) m(o14) m(o15) m(o16) m(o17) m(o18) m(o19) m(o20) m(o21) m(o22) m(o23) m(o24) m(o25) m(o26) m(o27) m(o28) m(o29) m(o30) m(o31) m(o32) m(o33) m(o34) m(o35) m(o36) m(o37) m(o38) m(o39) m(o40) m(o41) m(o42) m(o43) m(o44) m(o45) m(o46) m(o47) m(o48) m(o49) m(o50) m(o51) m(o52) m(o53) m(o54) m(o55) m(o56) m(o57) m(o58) m(o59) m(o60) m(o61) m(o62) m(o63) m(o64) m(o65) m(o66) m(o67) m(o68) m(o69) m(o70)
 
-#define neat_fprint68(file, o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22, o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35, o36, o37, o38, o39, o40, o41, o42, o43, o44, o45, o46, o47, o48, o49, o50, o51, o52, o53, o54, o55, o56, o57, o58, o59, o60, o61, o62, o63, o64, o65, o66, o67, o68) do { \
-neat_fprint67(file, o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22, o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35, o36, o37, o38, o39, o40, o41, o42, o43, o44, o45, o46, o47, o48, o49, o50, o51, o52, o53, o54, o55, o56, o57, o58, o59, o60, o61, o62, o63, o64, o65, o66, o67); \
-neat_fprint1(file, o68); \
-} while(0)
+#define NEAT_MAP71(m, o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22, o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35, o36, o37, o38, o39, o40, o41, o42, o43, o44, o45, o46, o47, o48, o49, o50, o51, o52, o53, o54, o55, o56, o57, o58, o59, o60, o61, o62, o63, o64, o65, o66, o67, o68, o69, o70, o71) \
+m(o1) m(o2) m(o3) m(o4) m(o5) m(o6) m(o7) m(o8) m(o9) m(o10) m(o11) m(o12) m(o13) m(o14) m(o15) m(o16) m(o17) m(o18) m(o19) m(o20) m(o21) m(o22) m(o23) m(o24) m(o25) m(o26) m(o27) m(o28) m(o29) m(o30) m(o31) m(o32) m(o33) m(o34) m(o35) m(o36) m(o37) m(o38) m(o39) m(o40) m(o41) m(o42) m(o43) m(o44) m(o45) m(o46) m(o47) m(o48) m(o49) m(o50) m(o51) m(o52) m(o53) m(o54) m(o55) m(o56) m(o57) m(o58) m(o59) m(o60) m(o61) m(o62) m(o63) m(o64) m(o65) m(o66) m(o67) m(o68) m(o69) m(o70) m(o71)
 
-#define neat_fprint69(file, o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22, o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35, o36, o37, o38, o39, o40, o41, o42, o43, o44, o45, o46, o47, o48, o49, o50, o51, o52, o53, o54, o55, o56, o57, o58, o59, o60, o61, o62, o63, o64, o65, o66, o67, o68, o69) do { \
-neat_fprint68(file, o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22, o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35, o36, o37, o38, o39, o40, o41, o42, o43, o44, o45, o46, o47, o48, o49, o50, o51, o52, o53, o54, o55, o56, o57, o58, o59, o60, o61, o62, o63, o64, o65, o66, o67, o68); \
-neat_fprint1(file, o69); \
-} while(0)
+#define NEAT_MAP72(m, o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22, o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35, o36, o37, o38, o39, o40, o41, o42, o43, o44, o45, o46, o47, o48, o49, o50, o51, o52, o53, o54, o55, o56, o57, o58, o59, o60, o61, o62, o63, o64, o65, o66, o67, o68, o69, o70, o71, o72) \
+m(o1) m(o2) m(o3) m(o4) m(o5) m(o6) m(o7) m(o8) m(o9) m(o10) m(o11) m(o12) m(o13) m(o14) m(o15) m(o16) m(o17) m(o18) m(o19) m(o20) m(o21) m(o22) m(o23) m(o24) m(o25) m(o26) m(o27) m(o28) m(o29) m(o30) m(o31) m(o32) m(o33) m(o34) m(o35) m(o36) m(o37) m(o38) m(o39) m(o40) m(o41) m(o42) m(o43) m(o44) m(o45) m(o46) m(o47) m(o48) m(o49) m(o50) m(o51) m(o52) m(o53) m(o54) m(o55) m(o56) m(o57) m(o58) m(o59) m(o60) m(o61) m(o62) m(o63) m(o64) m(o65) m(o66) m(o67) m(o68) m(o69) m(o70) m(o71) m(o72)
 
-#define neat_fprint70(file, o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22, o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35, o36, o37, o38, o39, o40, o41, o42, o43, o44, o45, o46, o47, o48, o49, o50, o51, o52, o53, o54, o55, o56, o57, o58, o59, o60, o61, o62, o63, o64, o65, o66, o67, o68, o69, o70) do { \
-neat_fprint69(file, o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22, o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35, o36, o37, o38, o39, o40, o41, o42, o43, o44, o45, o46, o47, o48, o49, o50, o51, o52, o53, o54, o55, o56, o57, o58, o59, o60, o61, o62, o63, o64, o65, o66, o67, o68, o69); \
-neat_fprint1(file, o70); \
-} while(0)
+#define NEAT_MAP73(m, o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22, o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35, o36, o37, o38, o39, o40, o41, o42, o43, o44, o45, o46, o47, o48, o49, o50, o51, o52, o53, o54, o55, o56, o57, o58, o59, o60, o61, o62, o63, o64, o65, o66, o67, o68, o69, o70, o71, o72, o73) \
+m(o1) m(o2) m(o3) m(o4) m(o5) m(o6) m(o7) m(o8) m(o9) m(o10) m(o11) m(o12) m(o13) m(o14) m(o15) m(o16) m(o17) m(o18) m(o19) m(o20) m(o21) m(o22) m(o23) m(o24) m(o25) m(o26) m(o27) m(o28) m(o29) m(o30) m(o31) m(o32) m(o33) m(o34) m(o35) m(o36) m(o37) m(o38) m(o39) m(o40) m(o41) m(o42) m(o43) m(o44) m(o45) m(o46) m(o47) m(o48) m(o49) m(o50) m(o51) m(o52) m(o53) m(o54) m(o55) m(o56) m(o57) m(o58) m(o59) m(o60) m(o61) m(o62) m(o63) m(o64) m(o65) m(o66) m(o67) m(o68) m(o69) m(o70) m(o71) m(o72) m(o73)
 
-#define neat_fprint71(file, o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22, o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35, o36, o37, o38, o39, o40, o41, o42, o43, o44, o45, o46, o47, o48, o49, o50, o51, o52, o53, o54, o55, o56, o57, o58, o59, o60, o61, o62, o63, o64, o65, o66, o67, o68, o69, o70, o71) do { \
-neat_fprint70(file, o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22, o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35, o36, o37, o38, o39, o40, o41, o42, o43, o44, o45, o46, o47, o48, o49, o50, o51, o52, o53, o54, o55, o56, o57, o58, o59, o60, o61, o62, o63, o64, o65, o66, o67, o68, o69, o70); \
-neat_fprint1(file, o71); \
-} while(0)
+#define NEAT_MAP74(m, o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22, o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35, o36, o37, o38, o39, o40, o41, o42, o43, o44, o45, o46, o47, o48, o49, o50, o51, o52, o53, o54, o55, o56, o57, o58, o59, o60, o61, o62, o63, o64, o65, o66, o67, o68, o69, o70, o71, o72, o73, o74) \
+m(o1) m(o2) m(o3) m(o4) m(o5) m(o6) m(o7) m(o8) m(o9) m(o10) m(o11) m(o12) m(o13) m(o14) m(o15) m(o16) m(o17) m(o18) m(o19) m(o20) m(o21) m(o22) m(o23) m(o24) m(o25) m(o26) m(o27) m(o28) m(o29) m(o30) m(o31) m(o32) m(o33) m(o34) m(o35) m(o36) m(o37) m(o38) m(o39) m(o40) m(o41) m(o42) m(o43) m(o44) m(o45) m(o46) m(o47) m(o48) m(o49) m(o50) m(o51) m(o52) m(o53) m(o54) m(o55) m(o56) m(o57) m(o58) m(o59) m(o60) m(o61) m(o62) m(o63) m(o64) m(o65) m(o66) m(o67) m(o68) m(o69) m(o70) m(o71) m(o72) m(o73) m(o74)
 
-#define neat_fprint72(file, o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22, o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35, o36, o37, o38, o39, o40, o41, o42, o43, o44, o45, o46, o47, o48, o49, o50, o51, o52, o53, o54, o55, o56, o57, o58, o59, o60, o61, o62, o63, o64, o65, o66, o67, o68, o69, o70, o71, o72) do { \
-neat_fprint71(file, o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22, o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35, o36, o37, o38, o39, o40, o41, o42, o43, o44, o45, o46, o47, o48, o49, o50, o51, o52, o53, o54, o55, o56, o57, o58, o59, o60, o61, o62, o63, o64, o65, o66, o67, o68, o69, o70, o71); \
-neat_fprint1(file, o72); \
-} while(0)
+#define NEAT_MAP75(m, o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22, o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35, o36, o37, o38, o39, o40, o41, o42, o43, o44, o45, o46, o47, o48, o49, o50, o51, o52, o53, o54, o55, o56, o57, o58, o59, o60, o61, o62, o63, o64, o65, o66, o67, o68, o69, o70, o71, o72, o73, o74, o75) \
+m(o1) m(o2) m(o3) m(o4) m(o5) m(o6) m(o7) m(o8) m(o9) m(o10) m(o11) m(o12) m(o13) m(o14) m(o15) m(o16) m(o17) m(o18) m(o19) m(o20) m(o21) m(o22) m(o23) m(o24) m(o25) m(o26) m(o27) m(o28) m(o29) m(o30) m(o31) m(o32) m(o33) m(o34) m(o35) m(o36) m(o37) m(o38) m(o39) m(o40) m(o41) m(o42) m(o43) m(o44) m(o45) m(o46) m(o47) m(o48) m(o49) m(o50) m(o51) m(o52) m(o53) m(o54) m(o55) m(o56) m(o57) m(o58) m(o59) m(o60) m(o61) m(o62) m(o63) m(o64) m(o65) m(o66) m(o67) m(o68) m(o69) m(o70) m(o71) m(o72) m(o73) m(o74) m(o75)
 
-#define neat_fprint73(file, o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22, o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35, o36, o37, o38, o39, o40, o41, o42, o43, o44, o45, o46, o47, o48, o49, o50, o51, o52, o53, o54, o55, o56, o57, o58, o59, o60, o61, o62, o63, o64, o65, o66, o67, o68, o69, o70, o71, o72, o73) do { \
-neat_fprint72(file, o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22, o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35, o36, o37, o38, o39, o40, o41, o42, o43, o44, o45, o46, o47, o48, o49, o50, o51, o52, o53, o54, o55, o56, o57, o58, o59, o60, o61, o62, o63, o64, o65, o66, o67, o68, o69, o70, o71, o72); \
-neat_fprint1(file, o73); \
-} while(0)
+#define NEAT_MAP76(m, o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22, o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35, o36, o37, o38, o39, o40, o41, o42, o43, o44, o45, o46, o47, o48, o49, o50, o51, o52, o53, o54, o55, o56, o57, o58, o59, o60, o61, o62, o63, o64, o65, o66, o67, o68, o69, o70, o71, o72, o73, o74, o75, o76) \
+m(o1) m(o2) m(o3) m(o4) m(o5) m(o6) m(o7) m(o8) m(o9) m(o10) m(o11) m(o12) m(o13) m(o14) m(o15) m(o16) m(o17) m(o18) m(o19) m(o20) m(o21) m(o22) m(o23) m(o24) m(o25) m(o26) m(o27) m(o28) m(o29) m(o30) m(o31) m(o32) m(o33) m(o34) m(o35) m(o36) m(o37) m(o38) m(o39) m(o40) m(o41) m(o42) m(o43) m(o44) m(o45) m(o46) m(o47) m(o48) m(o49) m(o50) m(o51) m(o52) m(o53) m(o54) m(o55) m(o56) m(o57) m(o58) m(o59) m(o60) m(o61) m(o62) m(o63) m(o64) m(o65) m(o66) m(o67) m(o68) m(o69) m(o70) m(o71) m(o72) m(o73) m(o74) m(o75) m(o76)
 
-#define neat_fprint74(file, o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22, o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35, o36, o37, o38, o39, o40, o41, o42, o43, o44, o45, o46, o47, o48, o49, o50, o51, o52, o53, o54, o55, o56, o57, o58, o59, o60, o61, o62, o63, o64, o65, o66, o67, o68, o69, o70, o71, o72, o73, o74) do { \
-neat_fprint73(file, o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22, o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35, o36, o37, o38, o39, o40, o41, o42, o43, o44, o45, o46, o47, o48, o49, o50, o51, o52, o53, o54, o55, o56, o57, o58, o59, o60, o61, o62, o63, o64, o65, o66, o67, o68, o69, o70, o71, o72, o73); \
-neat_fprint1(file, o74); \
-} while(0)
+#define NEAT_MAP77(m, o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22, o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35, o36, o37, o38, o39, o40, o41, o42, o43, o44, o45, o46, o47, o48, o49, o50, o51, o52, o53, o54, o55, o56, o57, o58, o59, o60, o61, o62, o63, o64, o65, o66, o67, o68, o69, o70, o71, o72, o73, o74, o75, o76, o77) \
+m(o1) m(o2) m(o3) m(o4) m(o5) m(o6) m(o7) m(o8) m(o9) m(o10) m(o11) m(o12) m(o13) m(o14) m(o15) m(o16) m(o17) m(o18) m(o19) m(o20) m(o21) m(o22) m(o23) m(o24) m(o25) m(o26) m(o27) m(o28) m(o29) m(o30) m(o31) m(o32) m(o33) m(o34) m(o35) m(o36) m(o37) m(o38) m(o39) m(o40) m(o41) m(o42) m(o43) m(o44) m(o45) m(o46) m(o47) m(o48) m(o49) m(o50) m(o51) m(o52) m(o53) m(o54) m(o55) m(o56) m(o57) m(o58) m(o59) m(o60) m(o61) m(o62) m(o63) m(o64) m(o65) m(o66) m(o67) m(o68) m(o69) m(o70) m(o71) m(o72) m(o73) m(o74) m(o75) m(o76) m(o77)
 
-#define neat_fprint75(file, o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22, o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35, o36, o37, o38, o39, o40, o41, o42, o43, o44, o45, o46, o47, o48, o49, o50, o51, o52, o53, o54, o55, o56, o57, o58, o59, o60, o61, o62, o63, o64, o65, o66, o67, o68, o69, o70, o71, o72, o73, o74, o75) do { \
-neat_fprint74(file, o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22, o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35, o36, o37, o38, o39, o40, o41, o42, o43, o44, o45, o46, o47, o48, o49, o50, o51, o52, o53, o54, o55, o56, o57, o58, o59, o60, o61, o62, o63, o64, o65, o66, o67, o68, o69, o70, o71, o72, o73, o74); \
-neat_fprint1(file, o75); \
-} while(0)
+#define NEAT_MAP78(m, o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22, o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35, o36, o37, o38, o39, o40, o41, o42, o43, o44, o45, o46, o47, o48, o49, o50, o51, o52, o53, o54, o55, o56, o57, o58, o59, o60, o61, o62, o63, o64, o65, o66, o67, o68, o69, o70, o71, o72, o73, o74, o75, o76, o77, o78) \
+m(o1) m(o2) m(o3) m(o4) m(o5) m(o6) m(o7) m(o8) m(o9) m(o10) m(o11) m(o12) m(o13) m(o14) m(o15) m(o16) m(o17) m(o18) m(o19) m(o20) m(o21) m(o22) m(o23) m(o24) m(o25) m(o26) m(o27) m(o28) m(o29) m(o30) m(o31) m(o32) m(o33) m(o34) m(o35) m(o36) m(o37) m(o38) m(o39) m(o40) m(o41) m(o42) m(o43) m(o44) m(o45) m(o46) m(o47) m(o48) m(o49) m(o50) m(o51) m(o52) m(o53) m(o54) m(o55) m(o56) m(o57) m(o58) m(o59) m(o60) m(o61) m(o62) m(o63) m(o64) m(o65) m(o66) m(o67) m(o68) m(o69) m(o70) m(o71) m(o72) m(o73) m(o74) m(o75) m(o76) m(o77) m(o78)
 
-#define neat_fprint76(file, o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22, o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35, o36, o37, o38, o39, o40, o41, o42, o43, o44, o45, o46, o47, o48, o49, o50, o51, o52, o53, o54, o55, o56, o57, o58, o59, o60, o61, o62, o63, o64, o65, o66, o67, o68, o69, o70, o71, o72, o73, o74, o75, o76) do { \
-neat_fprint75(file, o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22, o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35, o36, o37, o38, o39, o40, o41, o42, o43, o44, o45, o46, o47, o48, o49, o50, o51, o52, o53, o54, o55, o56, o57, o58, o59, o60, o61, o62, o63, o64, o65, o66, o67, o68, o69, o70, o71, o72, o73, o74, o75); \
-neat_fprint1(file, o76); \
-} while(0)
+#define NEAT_MAP79(m, o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22, o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35, o36, o37, o38, o39, o40, o41, o42, o43, o44, o45, o46, o47, o48, o49, o50, o51, o52, o53, o54, o55, o56, o57, o58, o59, o60, o61, o62, o63, o64, o65, o66, o67, o68, o69, o70, o71, o72, o73, o74, o75, o76, o77, o78, o79) \
+m(o1) m(o2) m(o3) m(o4) m(o5) m(o6) m(o7) m(o8) m(o9) m(o10) m(o11) m(o12) m(o13) m(o14) m(o15) m(o16) m(o17) m(o18) m(o19) m(o20) m(o21) m(o22) m(o23) m(o24) m(o25) m(o26) m(o27) m(o28) m(o29) m(o30) m(o31) m(o32) m(o33) m(o34) m(o35) m(o36) m(o37) m(o38) m(o39) m(o40) m(o41) m(o42) m(o43) m(o44) m(o45) m(o46) m(o47) m(o48) m(o49) m(o50) m(o51) m(o52) m(o53) m(o54) m(o55) m(o56) m(o57) m(o58) m(o59) m(o60) m(o61) m(o62) m(o63) m(o64) m(o65) m(o66) m(o67) m(o68) m(o69) m(o70) m(o71) m(o72) m(o73) m(o74) m(o75) m(o76) m(o77) m(o78) m(o79)
 
-#define neat_fprint77(file, o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22, o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35, o36, o37, o38, o39, o40, o41, o42, o43, o44, o45, o46, o47, o48, o49, o50, o51, o52, o53, o54, o55, o56, o57, o58, o59, o60, o61, o62, o63, o64, o65, o66, o67, o68, o69, o70, o71, o72, o73, o74, o75, o76, o77) do { \
-neat_fprint76(file, o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22, o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35, o36, o37, o38, o39, o40, o41, o42, o43, o44, o45, o46, o47, o48, o49, o50, o51, o52, o53, o54, o55, o56, o57, o58, o59, o60, o61, o62, o63, o64, o65, o66, o67, o68, o69, o70, o71, o72, o73, o74, o75, o76); \
-neat_fprint1(file, o77); \
-} while(0)
+#define NEAT_MAP80(m, o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22, o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35, o36, o37, o38, o39, o40, o41, o42, o43, o44, o45, o46, o47, o48, o49, o50, o51, o52, o53, o54, o55, o56, o57, o58, o59, o60, o61, o62, o63, o64, o65, o66, o67, o68, o69, o70, o71, o72, o73, o74, o75, o76, o77, o78, o79, o80) \
+m(o1) m(o2) m(o3) m(o4) m(o5) m(o6) m(o7) m(o8) m(o9) m(o10) m(o11) m(o12) m(o13) m(o14) m(o15) m(o16) m(o17) m(o18) m(o19) m(o20) m(o21) m(o22) m(o23) m(o24) m(o25) m(o26) m(o27) m(o28) m(o29) m(o30) m(o31) m(o32) m(o33) m(o34) m(o35) m(o36) m(o37) m(o38) m(o39) m(o40) m(o41) m(o42) m(o43) m(o44) m(o45) m(o46) m(o47) m(o48) m(o49) m(o50) m(o51) m(o52) m(o53) m(o54) m(o55) m(o56) m(o57) m(o58) m(o59) m(o60) m(o61) m(o62) m(o63) m(o64) m(o65) m(o66) m(o67) m(o68) m(o69) m(o70) m(o71) m(o72) m(o73) m(o74) m(o75) m(o76) m(o77) m(o78) m(o79) m(o80)
 
-#define neat_fprint78(file, o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22, o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35, o36, o37, o38, o39, o40, o41, o42, o43, o44, o45, o46, o47, o48, o49, o50, o51, o52, o53, o54, o55, o56, o57, o58, o59, o60, o61, o62, o63, o64, o65, o66, o67, o68, o69, o70, o71, o72, o73, o74, o75, o76, o77, o78) do { \
-neat_fprint77(file, o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22, o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35, o36, o37, o38, o39, o40, o41, o42, o43, o44, o45, o46, o47, o48, o49, o50, o51, o52, o53, o54, o55, o56, o57, o58, o59, o60, o61, o62, o63, o64, o65, o66, o67, o68, o69, o70, o71, o72, o73, o74, o75, o76, o77); \
-neat_fprint1(file, o78); \
-} while(0)
+#define NEAT_MAP81(m, o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22, o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35, o36, o37, o38, o39, o40, o41, o42, o43, o44, o45, o46, o47, o48, o49, o50, o51, o52, o53, o54, o55, o56, o57, o58, o59, o60, o61, o62, o63, o64, o65, o66, o67, o68, o69, o70, o71, o72, o73, o74, o75, o76, o77, o78, o79, o80, o81) \
+m(o1) m(o2) m(o3) m(o4) m(o5) m(o6) m(o7) m(o8) m(o9) m(o10) m(o11) m(o12) m(o13) m(o14) m(o15) m(o16) m(o17) m(o18) m(o19) m(o20) m(o21) m(o22) m(o23) m(o24) m(o25) m(o26) m(o27) m(o28) m(o29) m(o30) m(o31) m(o32) m(o33) m(o34) m(o35) m(o36) m(o37) m(o38) m(o39) m(o40) m(o41) m(o42) m(o43) m(o44) m(o45) m(o46) m(o47) m(o48) m(o49) m(o50) m(o51) m(o52) m(o53) m(o54) m(o55) m(o56) m(o57) m(o58) m(o59) m(o60) m(o61) m(o62) m(o63) m(o64) m(o65) m(o66) m(o67) m(o68) m(o69) m(o70) m(o71) m(o72) m(o73) m(o74) m(o75) m(o76) m(o77) m(o78) m(o79) m(o80) m(o81)
 
-#define neat_fprint79(file, o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22, o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35, o36, o37, o38, o39, o40, o41, o42, o43, o44, o45, o46, o47, o48, o49, o50, o51, o52, o53, o54, o55, o56, o57, o58, o59, o60, o61, o62, o63, o64, o65, o66, o67, o68, o69, o70, o71, o72, o73, o74, o75, o76, o77, o78, o79) do { \
-neat_fprint78(file, o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22, o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35, o36, o37, o38, o39, o40, o41, o42, o43, o44, o45, o46, o47, o48, o49, o50, o51, o52, o53, o54, o55, o56, o57, o58, o59, o60, o61, o62, o63, o64, o65, o66, o67, o68, o69, o70, o71, o72, o73, o74, o75, o76, o77, o78); \
-neat_fprint1(file, o79); \
-} while(0)
+#define NEAT_MAP82(m, o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22, o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35, o36, o37, o38, o39, o40, o41, o42, o43, o44, o45, o46, o47, o48, o49, o50, o51, o52, o53, o54, o55, o56, o57, o58, o59, o60, o61, o62, o63, o64, o65, o66, o67, o68, o69, o70, o71, o72, o73, o74, o75, o76, o77, o78, o79, o80, o81, o82) \
+m(o1) m(o2) m(o3) m(o4) m(o5) m(o6) m(o7) m(o8) m(o9) m(o10) m(o11) m(o12) m(o13) m(o14) m(o15) m(o16) m(o17) m(o18) m(o19) m(o20) m(o21) m(o22) m(o23) m(o24) m(o25) m(o26) m(o27) m(o28) m(o29) m(o30) m(o31) m(o32) m(o33) m(o34) m(o35) m(o36) m(o37) m(o38) m(o39) m(o40) m(o41) m(o42) m(o43) m(o44) m(o45) m(o46) m(o47) m(o48) m(o49) m(o50) m(o51) m(o52) m(o53) m(o54) m(o55) m(o56) m(o57) m(o58) m(o59) m(o60) m(o61) m(o62) m(o63) m(o64) m(o65) m(o66) m(o67) m(o68) m(o69) m(o70) m(o71) m(o72) m(o73) m(o74) m(o75) m(o76) m(o77) m(o78) m(o79) m(o80) m(o81) m(o82)
 
-#define neat_fprint80(file, o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22, o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35, o36, o37, o38, o39, o40, o41, o42, o43, o44, o45, o46, o47, o48, o49, o50, o51, o52, o53, o54, o55, o56, o57, o58, o59, o60, o61, o62, o63, o64, o65, o66, o67, o68, o69, o70, o71, o72, o73, o74, o75, o76, o77, o78, o79, o80) do { \
-neat_fprint79(file, o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22, o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35, o36, o37, o38, o39, o40, o41, o42, o43, o44, o45, o46, o47, o48, o49, o50, o51, o52, o53, o54, o55, o56, o57, o58, o59, o60, o61, o62, o63, o64, o65, o66, o67, o68, o69, o70, o71, o72, o73, o74, o75, o76, o77, o78, o79); \
-neat_fprint1(file, o80); \
-} while(0)
+#define NEAT_MAP83(m, o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22, o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35, o36, o37, o38, o39, o40, o41, o42, o43, o44, o45, o46, o47, o48, o49, o50, o51, o52, o53, o54, o55, o56, o57, o58, o59, o60, o61, o62, o63, o64, o65, o66, o67, o68, o69, o70, o71, o72, o73, o74, o75, o76, o77, o78, o79, o80, o81, o82, o83) \
+m(o1) m(o2) m(o3) m(o4) m(o5) m(o6) m(o7) m(o8) m(o9) m(o10) m(o11) m(o12) m(o13) m(o14) m(o15) m(o16) m(o17) m(o18) m(o19) m(o20) m(o21) m(o22) m(o23) m(o24) m(o25) m(o26) m(o27) m(o28) m(o29) m(o30) m(o31) m(o32) m(o33) m(o34) m(o35) m(o36) m(o37) m(o38) m(o39) m(o40) m(o41) m(o42) m(o43) m(o44) m(o45) m(o46) m(o47) m(o48) m(o49) m(o50) m(o51) m(o52) m(o53) m(o54) m(o55) m(o56) m(o57) m(o58) m(o59) m(o60) m(o61) m(o62) m(o63) m(o64) m(o65) m(o66) m(o67) m(o68) m(o69) m(o70) m(o71) m(o72) m(o73) m(o74) m(o75) m(o76) m(o77) m(o78) m(o79) m(o80) m(o81) m(o82) m(o83)
 
-#define neat_fprint81(file, o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22, o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35, o36, o37, o38, o39, o40, o41, o42, o43, o44, o45, o46, o47, o48, o49, o50, o51, o52, o53, o54, o55, o56, o57, o58, o59, o60, o61, o62, o63, o64, o65, o66, o67, o68, o69, o70, o71, o72, o73, o74, o75, o76, o77, o78, o79, o80, o81) do { \
-neat_fprint80(file, o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22, o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35, o36, o37, o38, o39, o40, o41, o42, o43, o44, o45, o46, o47, o48, o49, o50, o51, o52, o53, o54, o55, o56, o57, o58, o59, o60, o61, o62, o63, o64, o65, o66, o67, o68, o69, o70, o71, o72, o73, o74, o75, o76, o77, o78, o79, o80); \
-neat_fprint1(file, o81); \
-} while(0)
+#define NEAT_MAP84(m, o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22, o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35, o36, o37, o38, o39, o40, o41, o42, o43, o44, o45, o46, o47, o48, o49, o50, o51, o52, o53, o54, o55, o56, o57, o58, o59, o60, o61, o62, o63, o64, o65, o66, o67, o68, o69, o70, o71, o72, o73, o74, o75, o76, o77, o78, o79, o80, o81, o82, o83, o84) \
+m(o1) m(o2) m(o3) m(o4) m(o5) m(o6) m(o7) m(o8) m(o9) m(o10) m(o11) m(o12) m(o13) m(o14) m(o15) m(o16) m(o17) m(o18) m(o19) m(o20) m(o21) m(o22) m(o23) m(o24) m(o25) m(o26) m(o27) m(o28) m(o29) m(o30) m(o31) m(o32) m(o33) m(o34) m(o35) m(o36) m(o37) m(o38) m(o39) m(o40) m(o41) m(o42) m(o43) m(o44) m(o45) m(o46) m(o47) m(o48) m(o49) m(o50) m(o51) m(o52) m(o53) m(o54) m(o55) m(o56) m(o57) m(o58) m(o59) m(o60) m(o61) m(o62) m(o63) m(o64) m(o65) m(o66) m(o67) m(o68) m(o69) m(o70) m(o71) m(o72) m(o73) m(o74) m(o75) m(o76) m(o77) m(o78) m(o79) m(o80) m(o81) m(o82) m(o83) m(o84)
 
-#define neat_fprint82(file, o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22, o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35, o36, o37, o38, o39, o40, o41, o42, o43, o44, o45, o46, o47, o48, o49, o50, o51, o52, o53, o54, o55, o56, o57, o58, o59, o60, o61, o62, o63, o64, o65, o66, o67, o68, o69, o70, o71, o72, o73, o74, o75, o76, o77, o78, o79, o80, o81, o82) do { \
-neat_fprint81(file, o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22, o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35, o36, o37, o38, o39, o40, o41, o42, o43, o44, o45, o46, o47, o48, o49, o50, o51, o52, o53, o54, o55, o56, o57, o58, o59, o60, o61, o62, o63, o64, o65, o66, o67, o68, o69, o70, o71, o72, o73, o74, o75, o76, o77, o78, o79, o80, o81); \
-neat_fprint1(file, o82); \
-} while(0)
+#define NEAT_MAP85(m, o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22, o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35, o36, o37, o38, o39, o40, o41, o42, o43, o44, o45, o46, o47, o48, o49, o50, o51, o52, o53, o54, o55, o56, o57, o58, o59, o60, o61, o62, o63, o64, o65, o66, o67, o68, o69, o70, o71, o72, o73, o74, o75, o76, o77, o78, o79, o80, o81, o82, o83, o84, o85) \
+m(o1) m(o2) m(o3) m(o4) m(o5) m(o6) m(o7) m(o8) m(o9) m(o10) m(o11) m(o12) m(o13) m(o14) m(o15) m(o16) m(o17) m(o18) m(o19) m(o20) m(o21) m(o22) m(o23) m(o24) m(o25) m(o26) m(o27) m(o28) m(o29) m(o30) m(o31) m(o32) m(o33) m(o34) m(o35) m(o36) m(o37) m(o38) m(o39) m(o40) m(o41) m(o42) m(o43) m(o44) m(o45) m(o46) m(o47) m(o48) m(o49) m(o50) m(o51) m(o52) m(o53) m(o54) m(o55) m(o56) m(o57) m(o58) m(o59) m(o60) m(o61) m(o62) m(o63) m(o64) m(o65) m(o66) m(o67) m(o68) m(o69) m(o70) m(o71) m(o72) m(o73) m(o74) m(o75) m(o76) m(o77) m(o78) m(o79) m(o80) m(o81) m(o82) m(o83) m(o84) m(o85)
 
-#define neat_fprint83(file, o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22, o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35, o36, o37, o38, o39, o40, o41, o42, o43, o44, o45, o46, o47, o48, o49, o50, o51, o52, o53, o54, o55, o56, o57, o58, o59, o60, o61, o62, o63, o64, o65, o66, o67, o68, o69, o70, o71, o72, o73, o74, o75, o76, o77, o78, o79, o80, o81, o82, o83) do { \
-neat_fprint82(file, o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22, o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35, o36, o37, o38, o39, o40, o41, o42, o43, o44, o45, o46, o47, o48, o49, o50, o51, o52, o53, o54, o55, o56, o57, o58, o59, o60, o61, o62, o63, o64, o65, o66, o67, o68, o69, o70, o71, o72, o73, o74, o75, o76, o77, o78, o79, o80, o81, o82); \
-neat_fprint1(file, o83); \
-} while(0)
+#define NEAT_MAP86(m, o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22, o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35, o36, o37, o38, o39, o40, o41, o42, o43, o44, o45, o46, o47, o48, o49, o50, o51, o52, o53, o54, o55, o56, o57, o58, o59, o60, o61, o62, o63, o64, o65, o66, o67, o68, o69, o70, o71, o72, o73, o74, o75, o76, o77, o78, o79, o80, o81, o82, o83, o84, o85, o86) \
+m(o1) m(o2) m(o3) m(o4) m(o5) m(o6) m(o7) m(o8) m(o9) m(o10) m(o11) m(o12) m(o13) m(o14) m(o15) m(o16) m(o17) m(o18) m(o19) m(o20) m(o21) m(o22) m(o23) m(o24) m(o25) m(o26) m(o27) m(o28) m(o29) m(o30) m(o31) m(o32) m(o33) m(o34) m(o35) m(o36) m(o37) m(o38) m(o39) m(o40) m(o41) m(o42) m(o43) m(o44) m(o45) m(o46) m(o47) m(o48) m(o49) m(o50) m(o51) m(o52) m(o53) m(o54) m(o55) m(o56) m(o57) m(o58) m(o59) m(o60) m(o61) m(o62) m(o63) m(o64) m(o65) m(o66) m(o67) m(o68) m(o69) m(o70) m(o71) m(o72) m(o73) m(o74) m(o75) m(o76) m(o77) m(o78) m(o79) m(o80) m(o81) m(o82) m(o83) m(o84) m(o85) m(o86)
 
-#define neat_fprint84(file, o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22, o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35, o36, o37, o38, o39, o40, o41, o42, o43, o44, o45, o46, o47, o48, o49, o50, o51, o52, o53, o54, o55, o56, o57, o58, o59, o60, o61, o62, o63, o64, o65, o66, o67, o68, o69, o70, o71, o72, o73, o74, o75, o76, o77, o78, o79, o80, o81, o82, o83, o84) do { \
-neat_fprint83(file, o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22, o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35, o36, o37, o38, o39, o40, o41, o42, o43, o44, o45, o46, o47, o48, o49, o50, o51, o52, o53, o54, o55, o56, o57, o58, o59, o60, o61, o62, o63, o64, o65, o66, o67, o68, o69, o70, o71, o72, o73, o74, o75, o76, o77, o78, o79, o80, o81, o82, o83); \
-neat_fprint1(file, o84); \
-} while(0)
+#define NEAT_MAP87(m, o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22, o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35, o36, o37, o38, o39, o40, o41, o42, o43, o44, o45, o46, o47, o48, o49, o50, o51, o52, o53, o54, o55, o56, o57, o58, o59, o60, o61, o62, o63, o64, o65, o66, o67, o68, o69, o70, o71, o72, o73, o74, o75, o76, o77, o78, o79, o80, o81, o82, o83, o84, o85, o86, o87) \
+m(o1) m(o2) m(o3) m(o4) m(o5) m(o6) m(o7) m(o8) m(o9) m(o10) m(o11) m(o12) m(o13) m(o14) m(o15) m(o16) m(o17) m(o18) m(o19) m(o20) m(o21) m(o22) m(o23) m(o24) m(o25) m(o26) m(o27) m(o28) m(o29) m(o30) m(o31) m(o32) m(o33) m(o34) m(o35) m(o36) m(o37) m(o38) m(o39) m(o40) m(o41) m(o42) m(o43) m(o44) m(o45) m(o46) m(o47) m(o48) m(o49) m(o50) m(o51) m(o52) m(o53) m(o54) m(o55) m(o56) m(o57) m(o58) m(o59) m(o60) m(o61) m(o62) m(o63) m(o64) m(o65) m(o66) m(o67) m(o68) m(o69) m(o70) m(o71) m(o72) m(o73) m(o74) m(o75) m(o76) m(o77) m(o78) m(o79) m(o80) m(o81) m(o82) m(o83) m(o84) m(o85) m(o86) m(o87)
 
-#define neat_fprint85(file, o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22, o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35, o36, o37, o38, o39, o40, o41, o42, o43, o44, o45, o46, o47, o48, o49, o50, o51, o52, o53, o54, o55, o56, o57, o58, o59, o60, o61, o62, o63, o64, o65, o66, o67, o68, o69, o70, o71, o72, o73, o74, o75, o76, o77, o78, o79, o80, o81, o82, o83, o84, o85) do { \
-neat_fprint84(file, o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22, o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35, o36, o37, o38, o39, o40, o41, o42, o43, o44, o45, o46, o47, o48, o49, o50, o51, o52, o53, o54, o55, o56, o57, o58, o59, o60, o61, o62, o63, o64, o65, o66, o67, o68, o69, o70, o71, o72, o73, o74, o75, o76, o77, o78, o79, o80, o81, o82, o83, o84); \
-neat_fprint1(file, o85); \
-} while(0)
+#define NEAT_MAP88(m, o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22, o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35, o36, o37, o38, o39, o40, o41, o42, o43, o44, o45, o46, o47, o48, o49, o50, o51, o52, o53, o54, o55, o56, o57, o58, o59, o60, o61, o62, o63, o64, o65, o66, o67, o68, o69, o70, o71, o72, o73, o74, o75, o76, o77, o78, o79, o80, o81, o82, o83, o84, o85, o86, o87, o88) \
+m(o1) m(o2) m(o3) m(o4) m(o5) m(o6) m(o7) m(o8) m(o9) m(o10) m(o11) m(o12) m(o13) m(o14) m(o15) m(o16) m(o17) m(o18) m(o19) m(o20) m(o21) m(o22) m(o23) m(o24) m(o25) m(o26) m(o27) m(o28) m(o29) m(o30) m(o31) m(o32) m(o33) m(o34) m(o35) m(o36) m(o37) m(o38) m(o39) m(o40) m(o41) m(o42) m(o43) m(o44) m(o45) m(o46) m(o47) m(o48) m(o49) m(o50) m(o51) m(o52) m(o53) m(o54) m(o55) m(o56) m(o57) m(o58) m(o59) m(o60) m(o61) m(o62) m(o63) m(o64) m(o65) m(o66) m(o67) m(o68) m(o69) m(o70) m(o71) m(o72) m(o73) m(o74) m(o75) m(o76) m(o77) m(o78) m(o79) m(o80) m(o81) m(o82) m(o83) m(o84) m(o85) m(o86) m(o87) m(o88)
 
-#define neat_fprint86(file, o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22, o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35, o36, o37, o38, o39, o40, o41, o42, o43, o44, o45, o46, o47, o48, o49, o50, o51, o52, o53, o54, o55, o56, o57, o58, o59, o60, o61, o62, o63, o64, o65, o66, o67, o68, o69, o70, o71, o72, o73, o74, o75, o76, o77, o78, o79, o80, o81, o82, o83, o84, o85, o86) do { \
-neat_fprint85(file, o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22, o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35, o36, o37, o38, o39, o40, o41, o42, o43, o44, o45, o46, o47, o48, o49, o50, o51, o52, o53, o54, o55, o56, o57, o58, o59, o60, o61, o62, o63, o64, o65, o66, o67, o68, o69, o70, o71, o72, o73, o74, o75, o76, o77, o78, o79, o80, o81, o82, o83, o84, o85); \
-neat_fprint1(file, o86); \
-} while(0)
+#define NEAT_MAP89(m, o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22, o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35, o36, o37, o38, o39, o40, o41, o42, o43, o44, o45, o46, o47, o48, o49, o50, o51, o52, o53, o54, o55, o56, o57, o58, o59, o60, o61, o62, o63, o64, o65, o66, o67, o68, o69, o70, o71, o72, o73, o74, o75, o76, o77, o78, o79, o80, o81, o82, o83, o84, o85, o86, o87, o88, o89) \
+m(o1) m(o2) m(o3) m(o4) m(o5) m(o6) m(o7) m(o8) m(o9) m(o10) m(o11) m(o12) m(o13) m(o14) m(o15) m(o16) m(o17) m(o18) m(o19) m(o20) m(o21) m(o22) m(o23) m(o24) m(o25) m(o26) m(o27) m(o28) m(o29) m(o30) m(o31) m(o32) m(o33) m(o34) m(o35) m(o36) m(o37) m(o38) m(o39) m(o40) m(o41) m(o42) m(o43) m(o44) m(o45) m(o46) m(o47) m(o48) m(o49) m(o50) m(o51) m(o52) m(o53) m(o54) m(o55) m(o56) m(o57) m(o58) m(o59) m(o60) m(o61) m(o62) m(o63) m(o64) m(o65) m(o66) m(o67) m(o68) m(o69) m(o70) m(o71) m(o72) m(o73) m(o74) m(o75) m(o76) m(o77) m(o78) m(o79) m(o80) m(o81) m(o82) m(o83) m(o84) m(o85) m(o86) m(o87) m(o88) m(o89)
 
-#define neat_fprint87(file, o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22, o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35, o36, o37, o38, o39, o40, o41, o42, o43, o44, o45, o46, o47, o48, o49, o50, o51, o52, o53, o54, o55, o56, o57, o58, o59, o60, o61, o62, o63, o64, o65, o66, o67, o68, o69, o70, o71, o72, o73, o74, o75, o76, o77, o78, o79, o80, o81, o82, o83, o84, o85, o86, o87) do { \
-neat_fprint86(file, o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22, o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35, o36, o37, o38, o39, o40, o41, o42, o43, o44, o45, o46, o47, o48, o49, o50, o51, o52, o53, o54, o55, o56, o57, o58, o59, o60, o61, o62, o63, o64, o65, o66, o67, o68, o69, o70, o71, o72, o73, o74, o75, o76, o77, o78, o79, o80, o81, o82, o83, o84, o85, o86); \
-neat_fprint1(file, o87); \
-} while(0)
+#define NEAT_MAP90(m, o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22, o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35, o36, o37, o38, o39, o40, o41, o42, o43, o44, o45, o46, o47, o48, o49, o50, o51, o52, o53, o54, o55, o56, o57, o58, o59, o60, o61, o62, o63, o64, o65, o66, o67, o68, o69, o70, o71, o72, o73, o74, o75, o76, o77, o78, o79, o80, o81, o82, o83, o84, o85, o86, o87, o88, o89, o90) \
+m(o1) m(o2) m(o3) m(o4) m(o5) m(o6) m(o7) m(o8) m(o9) m(o10) m(o11) m(o12) m(o13) m(o14) m(o15) m(o16) m(o17) m(o18) m(o19) m(o20) m(o21) m(o22) m(o23) m(o24) m(o25) m(o26) m(o27) m(o28) m(o29) m(o30) m(o31) m(o32) m(o33) m(o34) m(o35) m(o36) m(o37) m(o38) m(o39) m(o40) m(o41) m(o42) m(o43) m(o44) m(o45) m(o46) m(o47) m(o48) m(o49) m(o50) m(o51) m(o52) m(o53) m(o54) m(o55) m(o56) m(o57) m(o58) m(o59) m(o60) m(o61) m(o62) m(o63) m(o64) m(o65) m(o66) m(o67) m(o68) m(o69) m(o70) m(o71) m(o72) m(o73) m(o74) m(o75) m(o76) m(o77) m(o78) m(o79) m(o80) m(o81) m(o82) m(o83) m(o84) m(o85) m(o86) m(o87) m(o88) m(o89) m(o90)
 
-#define neat_fprint88(file, o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22, o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35, o36, o37, o38, o39, o40, o41, o42, o43, o44, o45, o46, o47, o48, o49, o50, o51, o52, o53, o54, o55, o56, o57, o58, o59, o60, o61, o62, o63, o64, o65, o66, o67, o68, o69, o70, o71, o72, o73, o74, o75, o76, o77, o78, o79, o80, o81, o82, o83, o84, o85, o86, o87, o88) do { \
-neat_fprint87(file, o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22, o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35, o36, o37, o38, o39, o40, o41, o42, o43, o44, o45, o46, o47, o48, o49, o50, o51, o52, o53, o54, o55, o56, o57, o58, o59, o60, o61, o62, o63, o64, o65, o66, o67, o68, o69, o70, o71, o72, o73, o74, o75, o76, o77, o78, o79, o80, o81, o82, o83, o84, o85, o86, o87); \
-neat_fprint1(file, o88); \
-} while(0)
+#define NEAT_MAP91(m, o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22, o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35, o36, o37, o38, o39, o40, o41, o42, o43, o44, o45, o46, o47, o48, o49, o50, o51, o52, o53, o54, o55, o56, o57, o58, o59, o60, o61, o62, o63, o64, o65, o66, o67, o68, o69, o70, o71, o72, o73, o74, o75, o76, o77, o78, o79, o80, o81, o82, o83, o84, o85, o86, o87, o88, o89, o90, o91) \
+m(o1) m(o2) m(o3) m(o4) m(o5) m(o6) m(o7) m(o8) m(o9) m(o10) m(o11) m(o12) m(o13) m(o14) m(o15) m(o16) m(o17) m(o18) m(o19) m(o20) m(o21) m(o22) m(o23) m(o24) m(o25) m(o26) m(o27) m(o28) m(o29) m(o30) m(o31) m(o32) m(o33) m(o34) m(o35) m(o36) m(o37) m(o38) m(o39) m(o40) m(o41) m(o42) m(o43) m(o44) m(o45) m(o46) m(o47) m(o48) m(o49) m(o50) m(o51) m(o52) m(o53) m(o54) m(o55) m(o56) m(o57) m(o58) m(o59) m(o60) m(o61) m(o62) m(o63) m(o64) m(o65) m(o66) m(o67) m(o68) m(o69) m(o70) m(o71) m(o72) m(o73) m(o74) m(o75) m(o76) m(o77) m(o78) m(o79) m(o80) m(o81) m(o82) m(o83) m(o84) m(o85) m(o86) m(o87) m(o88) m(o89) m(o90) m(o91)
 
-#define neat_fprint89(file, o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22, o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35, o36, o37, o38, o39, o40, o41, o42, o43, o44, o45, o46, o47, o48, o49, o50, o51, o52, o53, o54, o55, o56, o57, o58, o59, o60, o61, o62, o63, o64, o65, o66, o67, o68, o69, o70, o71, o72, o73, o74, o75, o76, o77, o78, o79, o80, o81, o82, o83, o84, o85, o86, o87, o88, o89) do { \
-neat_fprint88(file, o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22, o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35, o36, o37, o38, o39, o40, o41, o42, o43, o44, o45, o46, o47, o48, o49, o50, o51, o52, o53, o54, o55, o56, o57, o58, o59, o60, o61, o62, o63, o64, o65, o66, o67, o68, o69, o70, o71, o72, o73, o74, o75, o76, o77, o78, o79, o80, o81, o82, o83, o84, o85, o86, o87, o88); \
-neat_fprint1(file, o89); \
-} while(0)
+#define NEAT_MAP92(m, o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22, o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35, o36, o37, o38, o39, o40, o41, o42, o43, o44, o45, o46, o47, o48, o49, o50, o51, o52, o53, o54, o55, o56, o57, o58, o59, o60, o61, o62, o63, o64, o65, o66, o67, o68, o69, o70, o71, o72, o73, o74, o75, o76, o77, o78, o79, o80, o81, o82, o83, o84, o85, o86, o87, o88, o89, o90, o91, o92) \
+m(o1) m(o2) m(o3) m(o4) m(o5) m(o6) m(o7) m(o8) m(o9) m(o10) m(o11) m(o12) m(o13) m(o14) m(o15) m(o16) m(o17) m(o18) m(o19) m(o20) m(o21) m(o22) m(o23) m(o24) m(o25) m(o26) m(o27) m(o28) m(o29) m(o30) m(o31) m(o32) m(o33) m(o34) m(o35) m(o36) m(o37) m(o38) m(o39) m(o40) m(o41) m(o42) m(o43) m(o44) m(o45) m(o46) m(o47) m(o48) m(o49) m(o50) m(o51) m(o52) m(o53) m(o54) m(o55) m(o56) m(o57) m(o58) m(o59) m(o60) m(o61) m(o62) m(o63) m(o64) m(o65) m(o66) m(o67) m(o68) m(o69) m(o70) m(o71) m(o72) m(o73) m(o74) m(o75) m(o76) m(o77) m(o78) m(o79) m(o80) m(o81) m(o82) m(o83) m(o84) m(o85) m(o86) m(o87) m(o88) m(o89) m(o90) m(o91) m(o92)
 
-#define neat_fprint90(file, o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22, o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35, o36, o37, o38, o39, o40, o41, o42, o43, o44, o45, o46, o47, o48, o49, o50, o51, o52, o53, o54, o55, o56, o57, o58, o59, o60, o61, o62, o63, o64, o65, o66, o67, o68, o69, o70, o71, o72, o73, o74, o75, o76, o77, o78, o79, o80, o81, o82, o83, o84, o85, o86, o87, o88, o89, o90) do { \
-neat_fprint89(file, o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22, o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35, o36, o37, o38, o39, o40, o41, o42, o43, o44, o45, o46, o47, o48, o49, o50, o51, o52, o53, o54, o55, o56, o57, o58, o59, o60, o61, o62, o63, o64, o65, o66, o67, o68, o69, o70, o71, o72, o73, o74, o75, o76, o77, o78, o79, o80, o81, o82, o83, o84, o85, o86, o87, o88, o89); \
-neat_fprint1(file, o90); \
-} while(0)
+#define NEAT_MAP93(m, o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22, o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35, o36, o37, o38, o39, o40, o41, o42, o43, o44, o45, o46, o47, o48, o49, o50, o51, o52, o53, o54, o55, o56, o57, o58, o59, o60, o61, o62, o63, o64, o65, o66, o67, o68, o69, o70, o71, o72, o73, o74, o75, o76, o77, o78, o79, o80, o81, o82, o83, o84, o85, o86, o87, o88, o89, o90, o91, o92, o93) \
+m(o1) m(o2) m(o3) m(o4) m(o5) m(o6) m(o7) m(o8) m(o9) m(o10) m(o11) m(o12) m(o13) m(o14) m(o15) m(o16) m(o17) m(o18) m(o19) m(o20) m(o21) m(o22) m(o23) m(o24) m(o25) m(o26) m(o27) m(o28) m(o29) m(o30) m(o31) m(o32) m(o33) m(o34) m(o35) m(o36) m(o37) m(o38) m(o39) m(o40) m(o41) m(o42) m(o43) m(o44) m(o45) m(o46) m(o47) m(o48) m(o49) m(o50) m(o51) m(o52) m(o53) m(o54) m(o55) m(o56) m(o57) m(o58) m(o59) m(o60) m(o61) m(o62) m(o63) m(o64) m(o65) m(o66) m(o67) m(o68) m(o69) m(o70) m(o71) m(o72) m(o73) m(o74) m(o75) m(o76) m(o77) m(o78) m(o79) m(o80) m(o81) m(o82) m(o83) m(o84) m(o85) m(o86) m(o87) m(o88) m(o89) m(o90) m(o91) m(o92) m(o93)
 
-#define neat_fprint91(file, o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22, o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35, o36, o37, o38, o39, o40, o41, o42, o43, o44, o45, o46, o47, o48, o49, o50, o51, o52, o53, o54, o55, o56, o57, o58, o59, o60, o61, o62, o63, o64, o65, o66, o67, o68, o69, o70, o71, o72, o73, o74, o75, o76, o77, o78, o79, o80, o81, o82, o83, o84, o85, o86, o87, o88, o89, o90, o91) do { \
-neat_fprint90(file, o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22, o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35, o36, o37, o38, o39, o40, o41, o42, o43, o44, o45, o46, o47, o48, o49, o50, o51, o52, o53, o54, o55, o56, o57, o58, o59, o60, o61, o62, o63, o64, o65, o66, o67, o68, o69, o70, o71, o72, o73, o74, o75, o76, o77, o78, o79, o80, o81, o82, o83, o84, o85, o86, o87, o88, o89, o90); \
-neat_fprint1(file, o91); \
-} while(0)
+#define NEAT_MAP94(m, o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22, o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35, o36, o37, o38, o39, o40, o41, o42, o43, o44, o45, o46, o47, o48, o49, o50, o51, o52, o53, o54, o55, o56, o57, o58, o59, o60, o61, o62, o63, o64, o65, o66, o67, o68, o69, o70, o71, o72, o73, o74, o75, o76, o77, o78, o79, o80, o81, o82, o83, o84, o85, o86, o87, o88, o89, o90, o91, o92, o93, o94) \
+m(o1) m(o2) m(o3) m(o4) m(o5) m(o6) m(o7) m(o8) m(o9) m(o10) m(o11) m(o12) m(o13) m(o14) m(o15) m(o16) m(o17) m(o18) m(o19) m(o20) m(o21) m(o22) m(o23) m(o24) m(o25) m(o26) m(o27) m(o28) m(o29) m(o30) m(o31) m(o32) m(o33) m(o34) m(o35) m(o36) m(o37) m(o38) m(o39) m(o40) m(o41) m(o42) m(o43) m(o44) m(o45) m(o46) m(o47) m(o48) m(o49) m(o50) m(o51) m(o52) m(o53) m(o54) m(o55) m(o56) m(o57) m(o58) m(o59) m(o60) m(o61) m(o62) m(o63) m(o64) m(o65) m(o66) m(o67) m(o68) m(o69) m(o70) m(o71) m(o72) m(o73) m(o74) m(o75) m(o76) m(o77) m(o78) m(o79) m(o80) m(o81) m(o82) m(o83) m(o84) m(o85) m(o86) m(o87) m(o88) m(o89) m(o90) m(o91) m(o92) m(o93) m(o94)
 
-#define neat_fprint92(file, o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22, o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35, o36, o37, o38, o39, o40, o41, o42, o43, o44, o45, o46, o47, o48, o49, o50, o51, o52, o53, o54, o55, o56, o57, o58, o59, o60, o61, o62, o63, o64, o65, o66, o67, o68, o69, o70, o71, o72, o73, o74, o75, o76, o77, o78, o79, o80, o81, o82, o83, o84, o85, o86, o87, o88, o89, o90, o91, o92) do { \
-neat_fprint91(file, o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22, o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35, o36, o37, o38, o39, o40, o41, o42, o43, o44, o45, o46, o47, o48, o49, o50, o51, o52, o53, o54, o55, o56, o57, o58, o59, o60, o61, o62, o63, o64, o65, o66, o67, o68, o69, o70, o71, o72, o73, o74, o75, o76, o77, o78, o79, o80, o81, o82, o83, o84, o85, o86, o87, o88, o89, o90, o91); \
-neat_fprint1(file, o92); \
-} while(0)
+#define NEAT_MAP95(m, o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22, o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35, o36, o37, o38, o39, o40, o41, o42, o43, o44, o45, o46, o47, o48, o49, o50, o51, o52, o53, o54, o55, o56, o57, o58, o59, o60, o61, o62, o63, o64, o65, o66, o67, o68, o69, o70, o71, o72, o73, o74, o75, o76, o77, o78, o79, o80, o81, o82, o83, o84, o85, o86, o87, o88, o89, o90, o91, o92, o93, o94, o95) \
+m(o1) m(o2) m(o3) m(o4) m(o5) m(o6) m(o7) m(o8) m(o9) m(o10) m(o11) m(o12) m(o13) m(o14) m(o15) m(o16) m(o17) m(o18) m(o19) m(o20) m(o21) m(o22) m(o23) m(o24) m(o25) m(o26) m(o27) m(o28) m(o29) m(o30) m(o31) m(o32) m(o33) m(o34) m(o35) m(o36) m(o37) m(o38) m(o39) m(o40) m(o41) m(o42) m(o43) m(o44) m(o45) m(o46) m(o47) m(o48) m(o49) m(o50) m(o51) m(o52) m(o53) m(o54) m(o55) m(o56) m(o57) m(o58) m(o59) m(o60) m(o61) m(o62) m(o63) m(o64) m(o65) m(o66) m(o67) m(o68) m(o69) m(o70) m(o71) m(o72) m(o73) m(o74) m(o75) m(o76) m(o77) m(o78) m(o79) m(o80) m(o81) m(o82) m(o83) m(o84) m(o85) m(o86) m(o87) m(o88) m(o89) m(o90) m(o91) m(o92) m(o93) m(o94) m(o95)
+
+#define NEAT_MAP96(m, o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22, o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35, o36, o37, o38, o39, o40, o41, o42, o43, o44, o45, o46, o47, o48, o49, o50, o51, o52, o53, o54, o55, o56, o57, o58, o59, o60, o61, o62, o63, o64, o65, o66, o67, o68, o69, o70, o71, o72, o73, o74, o75, o76, o77, o78, o79, o80, o81, o82, o83, o84, o85, o86, o87, o88, o89, o90, o91, o92, o93, o94, o95, o96) \
+m(o1) m(o2) m(o3) m(o4) m(o5) m(o6) m(o7) m(o8) m(o9) m(o10) m(o11) m(o12) m(o13) m(o14) m(o15) m(o16) m(o17) m(o18) m(o19) m(o20) m(o21) m(o22) m(o23) m(o24) m(o25) m(o26) m(o27) m(o28) m(o29) m(o30) m(o31) m(o32) m(o33) m(o34) m(o35) m(o36) m(o37) m(o38) m(o39) m(o40) m(o41) m(o42) m(o43) m(o44) m(o45) m(o46) m(o47) m(o48) m(o49) m(o50) m(o51) m(o52) m(o53) m(o54) m(o55) m(o56) m(o57) m(o58) m(o59) m(o60) m(o61) m(o62) m(o63) m(o64) m(o65) m(o66) m(o67) m(o68) m(o69) m(o70) m(o71) m(o72) m(o73) m(o74) m(o75) m(o76) m(o77) m(o78) m(o79) m(o80) m(o81) m(o82) m(o83) m(o84) m(o85) m(o86) m(o87) m(o88) m(o89) m(o90) m(o91) m(o92) m(o93) m(o94) m(o95) m(o96)
+
+#define NEAT_MAP97(m, o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22, o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35, o36, o37, o38, o39, o40, o41, o42, o43, o44, o45, o46, o47, o48, o49, o50, o51, o52, o53, o54, o55, o56, o57, o58, o59, o60, o61, o62, o63, o64, o65, o66, o67, o68, o69, o70, o71, o72, o73, o74, o75, o76, o77, o78, o79, o80, o81, o82, o83, o84, o85, o86, o87, o88, o89, o90, o91, o92, o93, o94, o95, o96, o97) \
+m(o1) m(o2) m(o3) m(o4) m(o5) m(o6) m(o7) m(o8) m(o9) m(o10) m(o11) m(o12) m(o13) m(o14) m(o15) m(o16) m(o17) m(o18) m(o19) m(o20) m(o21) m(o22) m(o23) m(o24) m(o25) m(o26) m(o27) m(o28) m(o29) m(o30) m(o31) m(o32) m(o33) m(o34) m(o35) m(o36) m(o37) m(o38) m(o39) m(o40) m(o41) m(o42) m(o43) m(o44) m(o45) m(o46) m(o47) m(o48) m(o49) m(o50) m(o51) m(o52) m(o53) m(o54) m(o55) m(o56) m(o57) m(o58) m(o59) m(o60) m(o61) m(o62) m(o63) m(o64) m(o65) m(o66) m(o67) m(o68) m(o69) m(o70) m(o71) m(o72) m(o73) m(o74) m(o75) m(o76) m(o77) m(o78) m(o79) m(o80) m(o81) m(o82) m(o83) m(o84) m(o85) m(o86) m(o87) m(o88) m(o89) m(o90) m(o91) m(o92) m(o93) m(o94) m(o95) m(o96) m(o97)
+
+#define NEAT_MAP98(m, o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22, o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35, o36, o37, o38, o39, o40, o41, o42, o43, o44, o45, o46, o47, o48, o49, o50, o51, o52, o53, o54, o55, o56, o57, o58, o59, o60, o61, o62, o63, o64, o65, o66, o67, o68, o69, o70, o71, o72, o73, o74, o75, o76, o77, o78, o79, o80, o81, o82, o83, o84, o85, o86, o87, o88, o89, o90, o91, o92, o93, o94, o95, o96, o97, o98) \
+m(o1) m(o2) m(o3) m(o4) m(o5) m(o6) m(o7) m(o8) m(o9) m(o10) m(o11) m(o12) m(o13) m(o14) m(o15) m(o16) m(o17) m(o18) m(o19) m(o20) m(o21) m(o22) m(o23) m(o24) m(o25) m(o26) m(o27) m(o28) m(o29) m(o30) m(o31) m(o32) m(o33) m(o34) m(o35) m(o36) m(o37) m(o38) m(o39) m(o40) m(o41) m(o42) m(o43) m(o44) m(o45) m(o46) m(o47) m(o48) m(o49) m(o50) m(o51) m(o52) m(o53) m(o54) m(o55) m(o56) m(o57) m(o58) m(o59) m(o60) m(o61) m(o62) m(o63) m(o64) m(o65) m(o66) m(o67) m(o68) m(o69) m(o70) m(o71) m(o72) m(o73) m(o74) m(o75) m(o76) m(o77) m(o78) m(o79) m(o80) m(o81) m(o82) m(o83) m(o84) m(o85) m(o86) m(o87) m(o88) m(o89) m(o90) m(o91) m(o92) m(o93) m(o94) m(o95) m(o96) m(o97) m(o98)
+
+#define NEAT_MAP99(m, o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22, o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35, o36, o37, o38, o39, o40, o41, o42, o43, o44, o45, o46, o47, o48, o49, o50, o51, o52, o53, o54, o55, o56, o57, o58, o59, o60, o61, o62, o63, o64, o65, o66, o67, o68, o69, o70, o71, o72, o73, o74, o75, o76, o77, o78, o79, o80, o81, o82, o83, o84, o85, o86, o87, o88, o89, o90, o91, o92, o93, o94, o95, o96, o97, o98, o99) \
+m(o1) m(o2) m(o3) m(o4) m(o5) m(o6) m(o7) m(o8) m(o9) m(o10) m(o11) m(o12) m(o13) m(o14) m(o15) m(o16) m(o17) m(o18) m(o19) m(o20) m(o21) m(o22) m(o23) m(o24) m(o25) m(o26) m(o27) m(o28) m(o29) m(o30) m(o31) m(o32) m(o33) m(o34) m(o35) m(o36) m(o37) m(o38) m(o39) m(o40) m(o41) m(o42) m(o43) m(o44) m(o45) m(o46) m(o47) m(o48) m(o49) m(o50) m(o51) m(o52) m(o53) m(o54) m(o55) m(o56) m(o57) m(o58) m(o59) m(o60) m(o61) m(o62) m(o63) m(o64) m(o65) m(o66) m(o67) m(o68) m(o69) m(o70) m(o71) m(o72) m(o73) m(o74) m(o75) m(o76) m(o77) m(o78) m(o79) m(o80) m(o81) m(o82) m(o83) m(o84) m(o85) m(o86) m(o87) m(o88) m(o89) m(o90) m(o91) m(o92) m(o93) m(o94) m(o95) m(o96) m(o97) m(o98) m(o99)
+
+#define NEAT_MAP100(m, o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22, o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35, o36, o37, o38, o39, o40, o41, o42, o43, o44, o45, o46, o47, o48, o49, o50, o51, o52, o53, o54, o55, o56, o57, o58, o59, o60, o61, o62, o63, o64, o65, o66, o67, o68, o69, o70, o71, o72, o73, o74, o75, o76, o77, o78, o79, o80, o81, o82, o83, o84, o85, o86, o87, o88, o89, o90, o91, o92, o93, o94, o95, o96, o97, o98, o99, o100) \
+m(o1) m(o2) m(o3) m(o4) m(o5) m(o6) m(o7) m(o8) m(o9) m(o10) m(o11) m(o12) m(o13) m(o14) m(o15) m(o16) m(o17) m(o18) m(o19) m(o20) m(o21) m(o22) m(o23) m(o24) m(o25) m(o26) m(o27) m(o28) m(o29) m(o30) m(o31) m(o32) m(o33) m(o34) m(o35) m(o36) m(o37) m(o38) m(o39) m(o40) m(o41) m(o42) m(o43) m(o44) m(o45) m(o46) m(o47) m(o48) m(o49) m(o50) m(o51) m(o52) m(o53) m(o54) m(o55) m(o56) m(o57) m(o58) m(o59) m(o60) m(o61) m(o62) m(o63) m(o64) m(o65) m(o66) m(o67) m(o68) m(o69) m(o70) m(o71) m(o72) m(o73) m(o74) m(o75) m(o76) m(o77) m(o78) m(o79) m(o80) m(o81) m(o82) m(o83) m(o84) m(o85) m(o86) m(o87) m(o88) m(o89) m(o90) m(o91) m(o92) m(o93) m(o94) m(o95) m(o96) m(o97) m(o98) m(o99) m(o100)
+
+#ifndef NEAT_WRITER_BUF_SIZE
+    #define NEAT_WRITER_BUF_SIZE 1024
+#endif
+
+// the kind of value an arg of print is, see neat_wprint_args
+#define NEAT_PRINT_KIND(obj) \
+_Generic(obj, \
+    char*:    NEAT_PRINT_STR, \
+    char:     NEAT_PRINT_CHAR, \
+    bool:     NEAT_PRINT_BOOL, \
+    int8_t:   NEAT_PRINT_I8, \
+    int16_t:  NEAT_PRINT_I16, \
+    int32_t:  NEAT_PRINT_I32, \
+    int64_t:  NEAT_PRINT_I64, \
+    uint8_t:  NEAT_PRINT_U8, \
+    uint16_t: NEAT_PRINT_U16, \
+    uint32_t: NEAT_PRINT_U32, \
+    uint64_t: NEAT_PRINT_U64, \
+    float:    NEAT_PRINT_FLOAT, \
+    double:   NEAT_PRINT_DOUBLE, \
+    default:  NEAT_PRINT_STRFN \
+)
+
+// only the user's types, the built-in ones don't need a strfn to be printed.
+#define neat_print_strfn_raw(obj) \
+_Generic( (typeof(obj)){0} , \
+    char*:    (neat_strfn){0}, \
+    char:     (neat_strfn){0}, \
+    bool:     (neat_strfn){0}, \
+    int8_t:   (neat_strfn){0}, \
+    int16_t:  (neat_strfn){0}, \
+    int32_t:  (neat_strfn){0}, \
+    int64_t:  (neat_strfn){0}, \
+    uint8_t:  (neat_strfn){0}, \
+    uint16_t: (neat_strfn){0}, \
+    uint32_t: (neat_strfn){0}, \
+    uint64_t: (neat_strfn){0}, \
+    float:    (neat_strfn){0}, \
+    double:   (neat_strfn){0} \
+    NEAT_USER_STRINGABLE_TYPES \
+)
+
+#define neat_print_strfn(obj) \
+_Generic(neat_print_strfn_raw(obj), \
+    neat_strfn: neat_strfn_same, \
+    default:    neat_strfn_of_tostr \
+)(neat_print_strfn_raw(obj))
 
-#define neat_fprint93(file, o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22, o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35, o36, o37, o38, o39, o40, o41, o42, o43, o44, o45, o46, o47, o48, o49, o50, o51, o52, o53, o54, o55, o56, o57, o58, o59, o60, o61, o62, o63, o64, o65, o66, o67, o68, o69, o70, o71, o72, o73, o74, o75, o76, o77, o78, o79, o80, o81, o82, o83, o84, o85, o86, o87, o88, o89, o90, o91, o92, o93) do { \
-neat_fprint92(file, o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22, o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35, o36, o37, o38, o39, o40, o41, o42, o43, o44, o45, o46, o47, o48, o49, o50, o51, o52, o53, o54, o55, o56, o57, o58, o59, o60, o61, o62, o63, o64, o65, o66, o67, o68, o69, o70, o71, o72, o73, o74, o75, o76, o77, o78, o79, o80, o81, o82, o83, o84, o85, o86, o87, o88, o89, o90, o91, o92); \
-neat_fprint1(file, o93); \
+// one element of the array neat_wprint_args gets, char* are passed as is, anything else as a pointer to a copy.
+// A print call only expands to that array (a type tag and a pointer per arg), so its expansion stays small.
+#define NEAT_PRINT_ARG(obj) \
+{ NEAT_PRINT_KIND(obj), _Generic(obj, char*: obj, default: &( (struct { typeof(obj) T; }){obj}.T )), neat_print_strfn(obj) },
+
+#define neat_wprint(w, ...) do { \
+NEAT_TOSTR_SILENCE_W_BEGIN \
+neat_wprint_args(w, (neat_print_arg[]){ NEAT_MAP(NEAT_PRINT_ARG, __VA_ARGS__) }, NEAT_NARG(__VA_ARGS__)) \
+NEAT_TOSTR_SILENCE_W_END \
 } while(0)
 
-#define neat_fprint94(file, o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22, o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35, o36, o37, o38, o39, o40, o41, o42, o43, o44, o45, o46, o47, o48, o49, o50, o51, o52, o53, o54, o55, o56, o57, o58, o59, o60, o61, o62, o63, o64, o65, o66, o67, o68, o69, o70, o71, o72, o73, o74, o75, o76, o77, o78, o79, o80, o81, o82, o83, o84, o85, o86, o87, o88, o89, o90, o91, o92, o93, o94) do { \
-neat_fprint93(file, o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22, o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35, o36, o37, o38, o39, o40, o41, o42, o43, o44, o45, o46, o47, o48, o49, o50, o51, o52, o53, o54, o55, o56, o57, o58, o59, o60, o61, o62, o63, o64, o65, o66, o67, o68, o69, o70, o71, o72, o73, o74, o75, o76, o77, o78, o79, o80, o81, o82, o83, o84, o85, o86, o87, o88, o89, o90, o91, o92, o93); \
-neat_fprint1(file, o94); \
+#define neat_wprintln(w, ...) do { \
+neat_wprint(w, __VA_ARGS__); \
+neat_writer_put_char(w, '\n'); \
 } while(0)
 
-#define neat_fprint95(file, o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22, o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35, o36, o37, o38, o39, o40, o41, o42, o43, o44, o45, o46, o47, o48, o49, o50, o51, o52, o53, o54, o55, o56, o57, o58, o59, o60, o61, o62, o63, o64, o65, o66, o67, o68, o69, o70, o71, o72, o73, o74, o75, o76, o77, o78, o79, o80, o81, o82, o83, o84, o85, o86, o87, o88, o89, o90, o91, o92, o93, o94, o95) do { \
-neat_fprint94(file, o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22, o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35, o36, o37, o38, o39, o40, o41, o42, o43, o44, o45, o46, o47, o48, o49, o50, o51, o52, o53, o54, o55, o56, o57, o58, o59, o60, o61, o62, o63, o64, o65, o66, o67, o68, o69, o70, o71, o72, o73, o74, o75, o76, o77, o78, o79, o80, o81, o82, o83, o84, o85, o86, o87, o88, o89, o90, o91, o92, o93, o94); \
-neat_fprint1(file, o95); \
+// what print reserves for an arg of unknown length (char* and user types), any bound past this is unknown
+#define NEAT_PRINT_UNBOUNDED (1 << 20)
+
+// compile-time upper bound of what print writes for obj
+#define neat_print_max_chars(obj) neat_max_chars_or(obj, NEAT_PRINT_UNBOUNDED)
+
+#define NEAT_PRINT_BOUND_OF(obj) + neat_print_max_chars(obj)
+
+#define NEAT_PRINT_BOUND(...) (0 NEAT_MAP(NEAT_PRINT_BOUND_OF, __VA_ARGS__))
+
+/*
+    Stack buffer size for printing args whose NEAT_PRINT_BOUND is bound.
+    When all their lengths are known, it's their sum plus the most a single
+    put reserves, so the writer never flushes before the end and the line
+    is written at once.
+*/
+#define NEAT_PRINT_BUF_SIZE(bound) \
+( (bound) < NEAT_PRINT_UNBOUNDED ? (bound) + NEAT_FLOAT_MAX_CHARS + 1 : NEAT_WRITER_BUF_SIZE )
+
+// all the args are formatted into one buffer on the stack, then written with a single fwrite.
+#define neat_fprint(file, ...) do { \
+enum { neat_bound = NEAT_PRINT_BOUND(__VA_ARGS__) }; \
+char neat_wbuf[NEAT_PRINT_BUF_SIZE(neat_bound)]; \
+neat_writer neat_w = neat_writer_file(file, neat_wbuf, sizeof(neat_wbuf)); \
+neat_wprint(&neat_w, __VA_ARGS__); \
+neat_writer_flush(&neat_w); \
 } while(0)
 
-#define neat_fprint96(file, o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22, o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35, o36, o37, o38, o39, o40, o41, o42, o43, o44, o45, o46, o47, o48, o49, o50, o51, o52, o53, o54, o55, o56, o57, o58, o59, o60, o61, o62, o63, o64, o65, o66, o67, o68, o69, o70, o71, o72, o73, o74, o75, o76, o77, o78, o79, o80, o81, o82, o83, o84, o85, o86, o87, o88, o89, o90, o91, o92, o93, o94, o95, o96) do { \
-neat_fprint95(file, o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22, o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35, o36, o37, o38, o39, o40, o41, o42, o43, o44, o45, o46, o47, o48, o49, o50, o51, o52, o53, o54, o55, o56, o57, o58, o59, o60, o61, o62, o63, o64, o65, o66, o67, o68, o69, o70, o71, o72, o73, o74, o75, o76, o77, o78, o79, o80, o81, o82, o83, o84, o85, o86, o87, o88, o89, o90, o91, o92, o93, o94, o95); \
-neat_fprint1(file, o96); \
+#define neat_print(...) neat_fprint(stdout, __VA_ARGS__)
+
+#define neat_fprintln(file, ...) do { \
+enum { neat_bound = NEAT_PRINT_BOUND(__VA_ARGS__) }; \
+char neat_wbuf[NEAT_PRINT_BUF_SIZE(neat_bound)]; \
+neat_writer neat_w = neat_writer_file(file, neat_wbuf, sizeof(neat_wbuf)); \
+neat_wprintln(&neat_w, __VA_ARGS__); \
+neat_writer_flush(&neat_w); \
 } while(0)
 
-#define neat_fprint97(file, o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22, o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35, o36, o37, o38, o39, o40, o41, o42, o43, o44, o45, o46, o47, o48, o49, o50, o51, o52, o53, o54, o55, o56, o57, o58, o59, o60, o61, o62, o63, o64, o65, o66, o67, o68, o69, o70, o71, o72, o73, o74, o75, o76, o77, o78, o79, o80, o81, o82, o83, o84, o85, o86, o87, o88, o89, o90, o91, o92, o93, o94, o95, o96, o97) do { \
-neat_fprint96(file, o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22, o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35, o36, o37, o38, o39, o40, o41, o42, o43, o44, o45, o46, o47, o48, o49, o50, o51, o52, o53, o54, o55, o56, o57, o58, o59, o60, o61, o62, o63, o64, o65, o66, o67, o68, o69, o70, o71, o72, o73, o74, o75, o76, o77, o78, o79, o80, o81, o82, o83, o84, o85, o86, o87, o88, o89, o90, o91, o92, o93, o94, o95, o96); \
-neat_fprint1(file, o97); \
+#define neat_println(...) neat_fprintln(stdout, __VA_ARGS__)
+
+// like the print functions, but char* and char args are written in double quotes, escaped like JSON strings
+#define neat_wprint_quoted(w, ...) do { \
+NEAT_TOSTR_SILENCE_W_BEGIN \
+neat_wprint_args_quoted(w, (neat_print_arg[]){ NEAT_MAP(NEAT_PRINT_ARG, __VA_ARGS__) }, NEAT_NARG(__VA_ARGS__)) \
+NEAT_TOSTR_SILENCE_W_END \
 } while(0)
 
-#define neat_fprint98(file, o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22, o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35, o36, o37, o38, o39, o40, o41, o42, o43, o44, o45, o46, o47, o48, o49, o50, o51, o52, o53, o54, o55, o56, o57, o58, o59, o60, o61, o62, o63, o64, o65, o66, o67, o68, o69, o70, o71, o72, o73, o74, o75, o76, o77, o78, o79, o80, o81, o82, o83, o84, o85, o86, o87, o88, o89, o90, o91, o92, o93, o94, o95, o96, o97, o98) do { \
-neat_fprint97(file, o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22, o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35, o36, o37, o38, o39, o40, o41, o42, o43, o44, o45, o46, o47, o48, o49, o50, o51, o52, o53, o54, o55, o56, o57, o58, o59, o60, o61, o62, o63, o64, o65, o66, o67, o68, o69, o70, o71, o72, o73, o74, o75, o76, o77, o78, o79, o80, o81, o82, o83, o84, o85, o86, o87, o88, o89, o90, o91, o92, o93, o94, o95, o96, o97); \
-neat_fprint1(file, o98); \
+#define neat_wprintln_quoted(w, ...) do { \
+neat_wprint_quoted(w, __VA_ARGS__); \
+neat_writer_put_char(w, '\n'); \
 } while(0)
 
-#define neat_fprint99(file, o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22, o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35, o36, o37, o38, o39, o40, o41, o42, o43, o44, o45, o46, o47, o48, o49, o50, o51, o52, o53, o54, o55, o56, o57, o58, o59, o60, o61, o62, o63, o64, o65, o66, o67, o68, o69, o70, o71, o72, o73, o74, o75, o76, o77, o78, o79, o80, o81, o82, o83, o84, o85, o86, o87, o88, o89, o90, o91, o92, o93, o94, o95, o96, o97, o98, o99) do { \
-neat_fprint98(file, o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22, o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35, o36, o37, o38, o39, o40, o41, o42, o43, o44, o45, o46, o47, o48, o49, o50, o51, o52, o53, o54, o55, o56, o57, o58, o59, o60, o61, o62, o63, o64, o65, o66, o67, o68, o69, o70, o71, o72, o73, o74, o75, o76, o77, o78, o79, o80, o81, o82, o83, o84, o85, o86, o87, o88, o89, o90, o91, o92, o93, o94, o95, o96, o97, o98); \
-neat_fprint1(file, o99); \
+#define neat_fprint_quoted(file, ...) do { \
+char neat_wbuf[NEAT_WRITER_BUF_SIZE]; \
+neat_writer neat_w = neat_writer_file(file, neat_wbuf, sizeof(neat_wbuf)); \
+neat_wprint_quoted(&neat_w, __VA_ARGS__); \
+neat_writer_flush(&neat_w); \
 } while(0)
 
-#define neat_fprint100(file, o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22, o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35, o36, o37, o38, o39, o40, o41, o42, o43, o44, o45, o46, o47, o48, o49, o50, o51, o52, o53, o54, o55, o56, o57, o58, o59, o60, o61, o62, o63, o64, o65, o66, o67, o68, o69, o70, o71, o72, o73, o74, o75, o76, o77, o78, o79, o80, o81, o82, o83, o84, o85, o86, o87, o88, o89, o90, o91, o92, o93, o94, o95, o96, o97, o98, o99, o100) do { \
-neat_fprint99(file, o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22, o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35, o36, o37, o38, o39, o40, o41, o42, o43, o44, o45, o46, o47, o48, o49, o50, o51, o52, o53, o54, o55, o56, o57, o58, o59, o60, o61, o62, o63, o64, o65, o66, o67, o68, o69, o70, o71, o72, o73, o74, o75, o76, o77, o78, o79, o80, o81, o82, o83, o84, o85, o86, o87, o88, o89, o90, o91, o92, o93, o94, o95, o96, o97, o98, o99); \
-neat_fprint1(file, o100); \
+#define neat_print_quoted(...) neat_fprint_quoted(stdout, __VA_ARGS__)
+
+#define neat_fprintln_quoted(file, ...) do { \
+char neat_wbuf[NEAT_WRITER_BUF_SIZE]; \
+neat_writer neat_w = neat_writer_file(file, neat_wbuf, sizeof(neat_wbuf)); \
+neat_wprintln_quoted(&neat_w, __VA_ARGS__); \
+neat_writer_flush(&neat_w); \
 } while(0)
 
+#define neat_println_quoted(...) neat_fprintln_quoted(stdout, __VA_ARGS__)
+
 #define neat_parse(type, str, ...) \
 _Generic((type){0}, NEAT_ALL_PARSABLE_TYPES)(str, (int*[2]){ &(int){0} , ##__VA_ARGS__ }[ !neat_is_empty(d,__VA_ARGS__) ])
 
+#define neat_parse_n(type, str, len, ...) \
+_Generic((type){0}, NEAT_ALL_PARSABLE_N_TYPES)(str, len, (int*[2]){ &(int){0} , ##__VA_ARGS__ }[ !neat_is_empty(d,__VA_ARGS__) ])
+
+#define neat_get_serfn(type) \
+_Generic( (typeof(type)){0} , \
+    NEAT_ALL_SERIALIZABLE_TYPES \
+)
+
+#define neat_to_bytes(buf, cap, obj) \
+_Generic(obj, \
+    char*:   neat_str2bytes(buf, cap, _Generic(obj, char*: obj, default: NULL)), \
+    default: neat_get_serfn(obj).tobytes(buf, cap, &( (struct { typeof(obj) T; }){obj}.T )) \
+)
+
+#define neat_from_bytes(buf, len, out) \
+neat_get_serfn(*(out)).frombytes(buf, len, out)
+
+#define neat_array_to_bytes(buf, cap, arr, n) \
+neat_array_to_bytes_f(buf, cap, arr, n, sizeof(*(arr)), neat_get_serfn(*(arr)))
+
+#define neat_array_from_bytes(buf, len, out, n) \
+neat_array_from_bytes_f(buf, len, out, n, sizeof(*(out)), neat_get_serfn(*(out)))
+
+#define NEAT_PARSE_ARRAY_TYPES \
+char:     neat_parse_array_char, \
+char*:    neat_parse_array_str, \
+bool:     neat_parse_array_bool, \
+int8_t:   neat_parse_array_int8_t, \
+int16_t:  neat_parse_array_int16_t, \
+int32_t:  neat_parse_array_int32_t, \
+int64_t:  neat_parse_array_int64_t, \
+uint8_t:  neat_parse_array_uint8_t, \
+uint16_t: neat_parse_array_uint16_t, \
+uint32_t: neat_parse_array_uint32_t, \
+uint64_t: neat_parse_array_uint64_t, \
+float:    neat_parse_array_float, \
+double:   neat_parse_array_double
+
+#define neat_parse_array(type, buf, len, delim, out, cap) \
+_Generic((type){0}, NEAT_PARSE_ARRAY_TYPES)(buf, len, delim, out, cap)
+
+#define NEAT_CURSOR_TYPES \
+bool:     neat_cursor_next_bool, \
+int8_t:   neat_cursor_next_int8_t, \
+int16_t:  neat_cursor_next_int16_t, \
+int32_t:  neat_cursor_next_int32_t, \
+int64_t:  neat_cursor_next_int64_t, \
+uint8_t:  neat_cursor_next_uint8_t, \
+uint16_t: neat_cursor_next_uint16_t, \
+uint32_t: neat_cursor_next_uint32_t, \
+uint64_t: neat_cursor_next_uint64_t, \
+float:    neat_cursor_next_float, \
+double:   neat_cursor_next_double
+
+#define neat_cursor_next(c, type, ...) \
+_Generic((type){0}, NEAT_CURSOR_TYPES)(c, (int*[2]){ &(int){0} , ##__VA_ARGS__ }[ !neat_is_empty(d,__VA_ARGS__) ])
+
+#define NEAT_PARSE_FILE_TYPES \
+char:     (neat_parse_array_fn) neat_parse_array_char, \
+bool:     (neat_parse_array_fn) neat_parse_array_bool, \
+int8_t:   (neat_parse_array_fn) neat_parse_array_int8_t, \
+int16_t:  (neat_parse_array_fn) neat_parse_array_int16_t, \
+int32_t:  (neat_parse_array_fn) neat_parse_array_int32_t, \
+int64_t:  (neat_parse_array_fn) neat_parse_array_int64_t, \
+uint8_t:  (neat_parse_array_fn) neat_parse_array_uint8_t, \
+uint16_t: (neat_parse_array_fn) neat_parse_array_uint16_t, \
+uint32_t: (neat_parse_array_fn) neat_parse_array_uint32_t, \
+uint64_t: (neat_parse_array_fn) neat_parse_array_uint64_t, \
+float:    (neat_parse_array_fn) neat_parse_array_float, \
+double:   (neat_parse_array_fn) neat_parse_array_double
+
+#define neat_parse_file(type, path, delim, out, ...) \
+neat_parse_file_f(path, delim, (void **) (type **[1]){ out }[0], sizeof(type), _Generic((type){0}, NEAT_PARSE_FILE_TYPES), (int[2]){ 1 , ##__VA_ARGS__ }[ !neat_is_empty(d,__VA_ARGS__) ])
+
 
 #ifndef NEAT_TOSTR_PREFIX
     #define ADD_STRINGABLE NEAT_ADD_STRINGABLE
+    #define ADD_STRINGABLE_BUF NEAT_ADD_STRINGABLE_BUF
     #define ADD_PARSABLE NEAT_ADD_PARSABLE
+    #define ADD_PARSABLE_N NEAT_ADD_PARSABLE_N
+    #define ADD_SERIALIZABLE NEAT_ADD_SERIALIZABLE
     #define to_string neat_to_string
+    #define to_chars neat_to_chars
+    #define to_chars_hex neat_to_chars_hex
+    #define to_string_ref neat_to_string_ref
+    #define array_to_chars neat_array_to_chars
     #define array_to_string neat_array_to_string
+    #define array_to_string_json neat_array_to_string_json
     #define print neat_print
     #define fprint neat_fprint
     #define println neat_println
     #define fprintln neat_fprintln
+    #define print_quoted neat_print_quoted
+    #define fprint_quoted neat_fprint_quoted
+    #define println_quoted neat_println_quoted
+    #define fprintln_quoted neat_fprintln_quoted
     #define print_array neat_print_array
     #define fprint_array neat_fprint_array
     #define println_array neat_println_array
     #define fprintln_array neat_fprintln_array
+    #define wprint neat_wprint
+    #define wprintln neat_wprintln
+    #define wprint_quoted neat_wprint_quoted
+    #define wprintln_quoted neat_wprintln_quoted
+    #define wprint_array neat_wprint_array
+    #define wprintln_array neat_wprintln_array
     #define parse neat_parse
+    #define parse_n neat_parse_n
+    #define parse_array neat_parse_array
+    #define parse_file neat_parse_file
+    #define to_bytes neat_to_bytes
+    #define from_bytes neat_from_bytes
+    #define array_to_bytes neat_array_to_bytes
+    #define array_from_bytes neat_array_from_bytes
     #define get_tostr neat_get_tostr
     #define get_parse neat_get_parse
+    #define get_serfn neat_get_serfn
 #endif
 
-char *neat_array_to_string_f(void *arr, size_t len, size_t elm_size, char*(*tostr)(void*));
+typedef char *(*neat_tostr_func)(void*);
+typedef size_t (*neat_tochars_func)(char*, size_t, void*);
 
-// 2str functions declarations
+// a type-erased way to stringify: exactly one of the two is set.
+typedef struct neat_strfn
+{
+    neat_tostr_func tostr;
+    neat_tochars_func tochars;
+} neat_strfn;
 
-char *neat_char2str(char *obj);
-char *neat_str2str(char *obj); char *neat_str2str_dummy(char **obj);
-char *neat_bool2str(bool *obj);
-char *neat_int8_t2str(int8_t *obj);
-char *neat_int16_t2str(int16_t *obj);
-char *neat_int32_t2str(int32_t *obj);
-char *neat_int64_t2str(int64_t *obj);
-char *neat_uint8_t2str(uint8_t *obj);
-char *neat_uint16_t2str(uint16_t *obj);
-char *neat_uint32_t2str(uint32_t *obj);
-char *neat_uint64_t2str(uint64_t *obj);
-char *neat_float2str(float *obj);
-char *neat_double2str(double *obj);
+char *neat_strfn_to_string(neat_strfn fn, void *obj);
+size_t neat_strfn_to_chars(char *buf, size_t cap, neat_strfn fn, void *obj);
 
-// parse functions declarations
+typedef size_t (*neat_tobytes_func)(void*, size_t, void*);
+typedef size_t (*neat_frombytes_func)(const void*, size_t, void*);
 
-char neat_parse_char(char *str, int *err);
-char *neat_parse_str(char *str, int *err);
+// how a type is written to and read from bytes, see ADD_SERIALIZABLE.
+typedef struct neat_serfn
+{
+    neat_tobytes_func tobytes;
+    neat_frombytes_func frombytes;
+    bool raw; // the encoding is the value's own bytes, so arrays are copied with one memcpy
+} neat_serfn;
+
+size_t neat_array_to_bytes_f(void *buf, size_t cap, const void *arr, size_t n, size_t elm_size, neat_serfn fn);
+size_t neat_array_from_bytes_f(const void *buf, size_t len, void *out, size_t n, size_t elm_size, neat_serfn fn);
+
+// a string that's either borrowed (a static table entry, or the caller's own string) or 'malloc'ed.
+typedef struct neat_strref
+{
+    const char *str;
+    size_t len;
+    bool owned; // str must be freed, neat_strref_free does it
+} neat_strref;
+
+// the range of integers that have a static string
+#define NEAT_SMALL_INT_MIN -128
+#define NEAT_SMALL_INT_MAX 999
+
+neat_strref neat_str2ref(const char *str);
+neat_strref neat_char2ref(char c);
+neat_strref neat_bool2ref(bool b);
+neat_strref neat_int2ref(int64_t v);
+neat_strref neat_uint2ref(uint64_t v);
+neat_strref neat_strref_own(char *str);
+void neat_strref_free(neat_strref ref);
+
+// an output sink: a caller-provided buffer that's written to a FILE (or a file descriptor) when it fills up.
+// Any cap works, but with less than 64 numbers are formatted on the stack and copied in.
+typedef struct neat_writer
+{
+    char *buf;
+    size_t len;
+    size_t cap;
+    FILE *file; // if NULL, fd is used
+    int fd;
+    bool error; // a flush failed
+} neat_writer;
+
+neat_writer neat_writer_file(FILE *file, char *buf, size_t cap);
+neat_writer neat_writer_fd(int fd, char *buf, size_t cap);
+void neat_writer_flush(neat_writer *w);
+void neat_writer_write(neat_writer *w, const char *str, size_t len);
+char *neat_writer_reserve(neat_writer *w, size_t len);
+void neat_writer_put_str(neat_writer *w, const char *str);
+void neat_writer_put_bool(neat_writer *w, bool b);
+void neat_writer_put_i64(neat_writer *w, int64_t v);
+void neat_writer_put_u64(neat_writer *w, uint64_t v);
+void neat_writer_put_float(neat_writer *w, float v);
+void neat_writer_put_double(neat_writer *w, double v);
+void neat_writer_put_strfn(neat_writer *w, neat_strfn fn, void *obj);
+
+static inline void neat_writer_put_char(neat_writer *w, char c)
+{
+    if(w->len == w->cap)
+    {
+        neat_writer_flush(w);
+        if(w->cap == 0)
+        {
+            neat_writer_write(w, &c, 1);
+            return;
+        }
+    }
+    w->buf[w->len++] = c;
+}
+
+typedef enum neat_print_kind
+{
+    NEAT_PRINT_STR,
+    NEAT_PRINT_CHAR,
+    NEAT_PRINT_BOOL,
+    NEAT_PRINT_I8,
+    NEAT_PRINT_I16,
+    NEAT_PRINT_I32,
+    NEAT_PRINT_I64,
+    NEAT_PRINT_U8,
+    NEAT_PRINT_U16,
+    NEAT_PRINT_U32,
+    NEAT_PRINT_U64,
+    NEAT_PRINT_FLOAT,
+    NEAT_PRINT_DOUBLE,
+    NEAT_PRINT_STRFN, // a user type, printed with fn
+} neat_print_kind;
+
+// an arg of print: its kind, and where it is. print passes them all in one array instead of expanding a call per arg.
+typedef struct neat_print_arg
+{
+    neat_print_kind kind;
+    const void *obj; // the string itself for NEAT_PRINT_STR
+    neat_strfn fn;
+} neat_print_arg;
+
+void neat_wprint_args(neat_writer *w, const neat_print_arg *args, size_t n);
+void neat_wprint_args_quoted(neat_writer *w, const neat_print_arg *args, size_t n);
+void neat_writer_put_quoted(neat_writer *w, const char *str, size_t len);
+
+static inline neat_strfn neat_strfn_same(neat_strfn fn)
+{
+    return fn;
+}
+
+static inline neat_strfn neat_strfn_of_tostr(neat_tostr_func tostr)
+{
+    return (neat_strfn){ .tostr = tostr };
+}
+
+// how the array printing functions lay out an array
+typedef struct neat_array_fmt
+{
+    const char *open;
+    const char *sep;
+    const char *close;
+    int precision; // digits after the point for float and double (at most NEAT_FIXED_MAX_PRECISION), or -1 for the shortest round-trip form
+    int nthreads; // threads to format big arrays with, needs NEAT_TOSTR_THREADS. 0 or 1 formats on the calling thread
+    bool quote; // write char* and char elements in double quotes, escaped like JSON strings
+} neat_array_fmt;
+
+#define NEAT_ARRAY_FMT_DEFAULT ((neat_array_fmt){ .open = "{", .sep = ", ", .close = "}", .precision = -1 })
+#define NEAT_ARRAY_FMT_JSON ((neat_array_fmt){ .open = "[", .sep = ",", .close = "]", .precision = -1, .quote = true })
+
+#define NEAT_FIXED_MAX_PRECISION 17
+
+// the fewest elements a thread formats at once
+#ifndef NEAT_ARRAY_PAR_CHUNK
+    #define NEAT_ARRAY_PAR_CHUNK ((size_t) 1 << 16)
+#endif
+
+size_t neat_array_to_chars_f(char *buf, size_t cap, const void *arr, size_t n, neat_print_kind kind, neat_array_fmt fmt);
+void neat_wprint_array_f(neat_writer *w, const void *arr, size_t n, size_t elm_size, neat_print_kind kind, neat_strfn fn, neat_array_fmt fmt);
+char *neat_array_to_string_fmt_f(const void *arr, size_t n, size_t elm_size, neat_print_kind kind, neat_strfn fn, size_t elm_max_chars, neat_array_fmt fmt);
+
+#ifdef NEAT_TOSTR_ASYNC
+
+// what a thread does when its ring is full
+typedef enum neat_async_policy
+{
+    NEAT_ASYNC_DROP,  // drop the output, the bytes are counted in neat_async_dropped()
+    NEAT_ASYNC_BLOCK, // wait for the background thread to make room
+} neat_async_policy;
+
+int neat_async_start(FILE *file, size_t ring_size, neat_async_policy policy);
+int neat_async_start_fd(int fd, size_t ring_size, neat_async_policy policy);
+void neat_async_flush(void);
+void neat_async_stop(void);
+uint64_t neat_async_dropped(void);
+
+#endif // NEAT_TOSTR_ASYNC
+
+// 2str functions declarations
+
+char *neat_char2str(char *obj);
+char *neat_str2str(char *obj); char *neat_str2str_dummy(char **obj);
+char *neat_bool2str(bool *obj);
+char *neat_int8_t2str(int8_t *obj);
+char *neat_int16_t2str(int16_t *obj);
+char *neat_int32_t2str(int32_t *obj);
+char *neat_int64_t2str(int64_t *obj);
+char *neat_uint8_t2str(uint8_t *obj);
+char *neat_uint16_t2str(uint16_t *obj);
+char *neat_uint32_t2str(uint32_t *obj);
+char *neat_uint64_t2str(uint64_t *obj);
+char *neat_float2str(float *obj);
+char *neat_double2str(double *obj);
+
+// integer formatting kernels, these write no NUL terminator and return the length.
+// out needs room for NEAT_INT_MAX_CHARS chars (16 for hex).
+
+#define NEAT_INT_MAX_CHARS 20
+
+int neat_count_digits(uint64_t v);
+size_t neat_u64_to_dec(char *out, uint64_t v);
+size_t neat_i64_to_dec(char *out, int64_t v);
+size_t neat_u64_to_hex(char *out, uint64_t v);
+
+size_t neat_int2chars(char *buf, size_t cap, int64_t v);
+size_t neat_uint2chars(char *buf, size_t cap, uint64_t v);
+size_t neat_hex2chars(char *buf, size_t cap, uint64_t v);
+
+// shortest round-trip float formatting, writes no NUL terminator and returns the length.
+// out needs room for NEAT_FLOAT_MAX_CHARS chars.
+
+#define NEAT_FLOAT_MAX_CHARS 32
+
+size_t neat_float_to_shortest(char *out, float v);
+size_t neat_double_to_shortest(char *out, double v);
+
+// 2chars functions declarations
+
+size_t neat_char2chars(char *buf, size_t cap, char *obj);
+size_t neat_str2chars(char *buf, size_t cap, char *obj); size_t neat_str2chars_dummy(char *buf, size_t cap, char **obj);
+size_t neat_bool2chars(char *buf, size_t cap, bool *obj);
+size_t neat_int8_t2chars(char *buf, size_t cap, int8_t *obj);
+size_t neat_int16_t2chars(char *buf, size_t cap, int16_t *obj);
+size_t neat_int32_t2chars(char *buf, size_t cap, int32_t *obj);
+size_t neat_int64_t2chars(char *buf, size_t cap, int64_t *obj);
+size_t neat_uint8_t2chars(char *buf, size_t cap, uint8_t *obj);
+size_t neat_uint16_t2chars(char *buf, size_t cap, uint16_t *obj);
+size_t neat_uint32_t2chars(char *buf, size_t cap, uint32_t *obj);
+size_t neat_uint64_t2chars(char *buf, size_t cap, uint64_t *obj);
+size_t neat_float2chars(char *buf, size_t cap, float *obj);
+size_t neat_double2chars(char *buf, size_t cap, double *obj);
+
+// parse error codes, put into err by the parse functions
+
+#define NEAT_PARSE_OK       0
+#define NEAT_PARSE_INVALID -1 // str doesn't start with a number
+#define NEAT_PARSE_EMPTY   -2 // str is empty or only whitespace
+#define NEAT_PARSE_RANGE   -3 // the number doesn't fit in the type, the closest value (or inf) is returned
+#define NEAT_PARSE_IO      -4 // parse_file couldn't read the file, or ran out of memory
+
+// integer parsing kernels, locale independent.
+// Leading whitespace and a sign are skipped, and parsing stops at the first non-digit.
+// If end isn't NULL, it's set to the char after the number (or to str if there's no number).
+
+int64_t neat_parse_i64(const char *str, char **end, int64_t min, int64_t max, int *err);
+uint64_t neat_parse_u64(const char *str, char **end, uint64_t max, int *err);
+
+// float parsing kernels, locale independent and correctly rounded.
+// Also accepts inf, infinity, and nan (any case), end works like above.
+
+float neat_parse_f32(const char *str, char **end, int *err);
+double neat_parse_f64(const char *str, char **end, int *err);
+
+// bulk parsing, see neat_parse_array
+
+typedef struct neat_parse_array_result
+{
+    size_t count; // values written to out
+    size_t pos;   // offset of the first bad field, or of where parsing stopped
+    int err;      // NEAT_PARSE_OK, or the error of the first bad field
+} neat_parse_array_result;
+
+neat_parse_array_result neat_parse_array_char(const char *buf, size_t len, char delim, char *out, size_t cap);
+neat_parse_array_result neat_parse_array_str(char *buf, size_t len, char delim, char **out, size_t cap);
+neat_parse_array_result neat_parse_array_bool(const char *buf, size_t len, char delim, bool *out, size_t cap);
+neat_parse_array_result neat_parse_array_int8_t(const char *buf, size_t len, char delim, int8_t *out, size_t cap);
+neat_parse_array_result neat_parse_array_int16_t(const char *buf, size_t len, char delim, int16_t *out, size_t cap);
+neat_parse_array_result neat_parse_array_int32_t(const char *buf, size_t len, char delim, int32_t *out, size_t cap);
+neat_parse_array_result neat_parse_array_int64_t(const char *buf, size_t len, char delim, int64_t *out, size_t cap);
+neat_parse_array_result neat_parse_array_uint8_t(const char *buf, size_t len, char delim, uint8_t *out, size_t cap);
+neat_parse_array_result neat_parse_array_uint16_t(const char *buf, size_t len, char delim, uint16_t *out, size_t cap);
+neat_parse_array_result neat_parse_array_uint32_t(const char *buf, size_t len, char delim, uint32_t *out, size_t cap);
+neat_parse_array_result neat_parse_array_uint64_t(const char *buf, size_t len, char delim, uint64_t *out, size_t cap);
+neat_parse_array_result neat_parse_array_float(const char *buf, size_t len, char delim, float *out, size_t cap);
+neat_parse_array_result neat_parse_array_double(const char *buf, size_t len, char delim, double *out, size_t cap);
+
+typedef neat_parse_array_result (*neat_parse_array_fn)(const char *buf, size_t len, char delim, void *out, size_t cap);
+
+// the file is mapped and parsed in chunks of this many bytes (and split between threads at line breaks)
+#ifndef NEAT_PARSE_FILE_CHUNK
+    #define NEAT_PARSE_FILE_CHUNK ((size_t) 64 << 20)
+#endif
+
+neat_parse_array_result neat_parse_file_f(const char *path, char delim, void **out, size_t elm_size, neat_parse_array_fn parse_fn, int nthreads);
+
+// a cursor reads values one after another from a buffer, or from a FILE or fd through buf
+
+typedef struct neat_cursor
+{
+    const char *p;   // next unread char
+    const char *end; // end of what's in buf
+    char delim;
+    int err;         // the first error, NEAT_PARSE_OK if none
+    char *buf;
+    size_t cap;
+    FILE *file;      // if NULL, fd is used
+    int fd;
+    bool eof;        // nothing more to read into buf
+} neat_cursor;
+
+neat_cursor neat_cursor_buf(const char *buf, size_t len, char delim);
+neat_cursor neat_cursor_file(FILE *file, char *buf, size_t cap, char delim);
+neat_cursor neat_cursor_fd(int fd, char *buf, size_t cap, char delim);
+bool neat_cursor_eof(neat_cursor *c);
+const char *neat_cursor_next_str(neat_cursor *c, size_t *len);
+bool neat_cursor_next_bool(neat_cursor *c, int *err);
+int8_t neat_cursor_next_int8_t(neat_cursor *c, int *err);
+int16_t neat_cursor_next_int16_t(neat_cursor *c, int *err);
+int32_t neat_cursor_next_int32_t(neat_cursor *c, int *err);
+int64_t neat_cursor_next_int64_t(neat_cursor *c, int *err);
+uint8_t neat_cursor_next_uint8_t(neat_cursor *c, int *err);
+uint16_t neat_cursor_next_uint16_t(neat_cursor *c, int *err);
+uint32_t neat_cursor_next_uint32_t(neat_cursor *c, int *err);
+uint64_t neat_cursor_next_uint64_t(neat_cursor *c, int *err);
+float neat_cursor_next_float(neat_cursor *c, int *err);
+double neat_cursor_next_double(neat_cursor *c, int *err);
+
+// parse functions declarations
+
+char neat_parse_char(char *str, int *err);
+char *neat_parse_str(char *str, int *err);
 bool neat_parse_bool(char *str, int *err);
 int8_t neat_parse_int8_t(char *str, int *err);
 int16_t neat_parse_int16_t(char *str, int *err);
@@ -1016,235 +1750,4908 @@ uint64_t neat_parse_uint64_t(char *str, int *err);
 float neat_parse_float(char *str, int *err);
 double neat_parse_double(char *str, int *err);
 
-static inline void neat_dummy()
+// span parse functions declarations, they never read past str + len
+
+char neat_parse_n_char(const char *str, size_t len, int *err);
+bool neat_parse_n_bool(const char *str, size_t len, int *err);
+int8_t neat_parse_n_int8_t(const char *str, size_t len, int *err);
+int16_t neat_parse_n_int16_t(const char *str, size_t len, int *err);
+int32_t neat_parse_n_int32_t(const char *str, size_t len, int *err);
+int64_t neat_parse_n_int64_t(const char *str, size_t len, int *err);
+uint8_t neat_parse_n_uint8_t(const char *str, size_t len, int *err);
+uint16_t neat_parse_n_uint16_t(const char *str, size_t len, int *err);
+uint32_t neat_parse_n_uint32_t(const char *str, size_t len, int *err);
+uint64_t neat_parse_n_uint64_t(const char *str, size_t len, int *err);
+float neat_parse_n_float(const char *str, size_t len, int *err);
+double neat_parse_n_double(const char *str, size_t len, int *err);
+
+// binary serialization functions declarations. 2bytes ones return the size of the encoding, and only write it if it fits in cap.
+// bytes2 ones never read past buf + len, and return how many bytes they read, 0 if it's truncated or out of range.
+
+size_t neat_str2bytes(void *buf, size_t cap, const char *str);
+size_t neat_char2bytes(void *buf, size_t cap, char *obj);
+size_t neat_str2bytes_dummy(void *buf, size_t cap, char **obj);
+size_t neat_bool2bytes(void *buf, size_t cap, bool *obj);
+size_t neat_int8_t2bytes(void *buf, size_t cap, int8_t *obj);
+size_t neat_int16_t2bytes(void *buf, size_t cap, int16_t *obj);
+size_t neat_int32_t2bytes(void *buf, size_t cap, int32_t *obj);
+size_t neat_int64_t2bytes(void *buf, size_t cap, int64_t *obj);
+size_t neat_uint8_t2bytes(void *buf, size_t cap, uint8_t *obj);
+size_t neat_uint16_t2bytes(void *buf, size_t cap, uint16_t *obj);
+size_t neat_uint32_t2bytes(void *buf, size_t cap, uint32_t *obj);
+size_t neat_uint64_t2bytes(void *buf, size_t cap, uint64_t *obj);
+size_t neat_float2bytes(void *buf, size_t cap, float *obj);
+size_t neat_double2bytes(void *buf, size_t cap, double *obj);
+
+size_t neat_bytes2char(const void *buf, size_t len, char *out);
+size_t neat_bytes2str(const void *buf, size_t len, char **out);
+size_t neat_bytes2bool(const void *buf, size_t len, bool *out);
+size_t neat_bytes2int8_t(const void *buf, size_t len, int8_t *out);
+size_t neat_bytes2int16_t(const void *buf, size_t len, int16_t *out);
+size_t neat_bytes2int32_t(const void *buf, size_t len, int32_t *out);
+size_t neat_bytes2int64_t(const void *buf, size_t len, int64_t *out);
+size_t neat_bytes2uint8_t(const void *buf, size_t len, uint8_t *out);
+size_t neat_bytes2uint16_t(const void *buf, size_t len, uint16_t *out);
+size_t neat_bytes2uint32_t(const void *buf, size_t len, uint32_t *out);
+size_t neat_bytes2uint64_t(const void *buf, size_t len, uint64_t *out);
+size_t neat_bytes2float(const void *buf, size_t len, float *out);
+size_t neat_bytes2double(const void *buf, size_t len, double *out);
+
+static inline void neat_dummy()
+{
+    return;
+}
+
+#endif // NEAT_TOSTR_H
+
+#ifdef NEAT_TOSTR_IMPLEMENTATION
+
+#ifdef _WIN32
+    #include <io.h>
+    #define neat_sys_write _write
+    #define neat_sys_read _read
+#else
+    #include <unistd.h>
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #define neat_sys_write write
+    #define neat_sys_read read
+#endif
+
+#ifdef NEAT_TOSTR_THREADS
+    #include <pthread.h>
+#endif
+
+#if defined(__SSE2__)
+    #include <emmintrin.h>
+#endif
+
+char *neat_strfn_to_string(neat_strfn fn, void *obj)
+{
+    if(fn.tostr) return fn.tostr(obj);
+    
+    char small[64];
+    size_t len = fn.tochars(small, sizeof(small), obj);
+    char *ret = malloc(len + 1);
+    if(len < sizeof(small))
+        memcpy(ret, small, len + 1);
+    else
+        fn.tochars(ret, len + 1, obj);
+    return ret;
+}
+
+size_t neat_strfn_to_chars(char *buf, size_t cap, neat_strfn fn, void *obj)
+{
+    if(fn.tochars) return fn.tochars(buf, cap, obj);
+    
+    char *str = fn.tostr(obj);
+    size_t len = neat_str2chars(buf, cap, str);
+    free(str);
+    return len;
+}
+
+// copies len chars of str into buf snprintf style, returns len.
+static inline size_t neat_chars_copy(char *buf, size_t cap, const char *str, size_t len)
+{
+    if(cap == 0) return len;
+    size_t n = len < cap ? len : cap - 1;
+    memcpy(buf, str, n);
+    buf[n] = '\0';
+    return len;
+}
+
+static inline void neat_strbuf_reserve(char **buf, size_t *cap, size_t need)
+{
+    if(need <= *cap) return;
+    size_t new_cap = *cap * 2;
+    if(new_cap < need) new_cap = need;
+    *buf = realloc(*buf, new_cap);
+    *cap = new_cap;
+}
+
+// runs fn on each of the nparts parts (part_size bytes apart), the first on this thread and the others on their own
+static void neat_run_parts(void *(*fn)(void*), void *parts, size_t part_size, size_t nparts)
+{
+    char *part = parts;
+#ifdef NEAT_TOSTR_THREADS
+    pthread_t *threads = nparts > 1 ? malloc((nparts - 1) * sizeof(*threads)) : NULL;
+    bool *started = nparts > 1 ? calloc(nparts - 1, sizeof(*started)) : NULL;
+    for(size_t i = 1 ; i < nparts && started ; i++)
+    {
+        // if a thread can't be made, its part is run here
+        started[i - 1] = threads && pthread_create(&threads[i - 1], NULL, fn, part + i * part_size) == 0;
+    }
+    fn(part);
+    for(size_t i = 1 ; i < nparts ; i++)
+    {
+        if(started && started[i - 1])
+            pthread_join(threads[i - 1], NULL);
+        else
+            fn(part + i * part_size);
+    }
+    free(threads);
+    free(started);
+#else
+    for(size_t i = 0 ; i < nparts ; i++)
+        fn(part + i * part_size);
+#endif
+}
+
+// how many threads to split n elements of at least min_part each between
+static size_t neat_count_parts(size_t n, size_t min_part, int nthreads)
+{
+#ifdef NEAT_TOSTR_THREADS
+    // parts smaller than min_part aren't worth a thread
+    size_t nparts = nthreads > 1 ? (size_t) nthreads : 1;
+    if(nparts > n / min_part + 1)
+        nparts = n / min_part + 1;
+    return nparts;
+#else
+    (void) n;
+    (void) min_part;
+    (void) nthreads;
+    return 1;
+#endif
+}
+
+// integer formatting kernels
+
+static const char neat_digit_pairs[201] =
+    "00010203040506070809"
+    "10111213141516171819"
+    "20212223242526272829"
+    "30313233343536373839"
+    "40414243444546474849"
+    "50515253545556575859"
+    "60616263646566676869"
+    "70717273747576777879"
+    "80818283848586878889"
+    "90919293949596979899";
+
+static const uint64_t neat_pow10[20] = {
+    1ull, 10ull, 100ull, 1000ull, 10000ull, 100000ull, 1000000ull, 10000000ull,
+    100000000ull, 1000000000ull, 10000000000ull, 100000000000ull, 1000000000000ull,
+    10000000000000ull, 100000000000000ull, 1000000000000000ull, 10000000000000000ull,
+    100000000000000000ull, 1000000000000000000ull, 10000000000000000000ull
+};
+
+static inline int neat_bit_length(uint64_t v)
+{
+#ifdef __GNUC__
+    return 64 - __builtin_clzll(v | 1);
+#else
+    int r = 1;
+    while(v >>= 1) r++;
+    return r;
+#endif
+}
+
+/*
+    log10(2) ~= 1233 / 4096, so this guesses the digit count from the
+    bit length and corrects the guess with one table lookup.
+*/
+int neat_count_digits(uint64_t v)
+{
+    int t = (neat_bit_length(v) * 1233) >> 12;
+    return t + (v >= neat_pow10[t]) + (v == 0);
+}
+
+size_t neat_u64_to_dec(char *out, uint64_t v)
+{
+    int len = neat_count_digits(v);
+    char *p = out + len;
+    while(v >= 100)
+    {
+        const char *d = neat_digit_pairs + (v % 100) * 2;
+        v /= 100;
+        *--p = d[1];
+        *--p = d[0];
+    }
+    if(v >= 10)
+    {
+        *--p = neat_digit_pairs[v * 2 + 1];
+        *--p = neat_digit_pairs[v * 2];
+    }
+    else
+    {
+        *--p = (char) ('0' + v);
+    }
+    return (size_t) len;
+}
+
+size_t neat_i64_to_dec(char *out, int64_t v)
+{
+    // negating as unsigned so INT64_MIN doesn't overflow
+    uint64_t u = (uint64_t) v;
+    if(v < 0)
+    {
+        *out = '-';
+        return 1 + neat_u64_to_dec(out + 1, 0 - u);
+    }
+    return neat_u64_to_dec(out, u);
+}
+
+size_t neat_u64_to_hex(char *out, uint64_t v)
+{
+    static const char hex[] = "0123456789abcdef";
+    int len = (neat_bit_length(v) + 3) / 4;
+    for(int i = len - 1 ; i >= 0 ; i--)
+    {
+        out[i] = hex[v & 0xf];
+        v >>= 4;
+    }
+    return (size_t) len;
+}
+
+size_t neat_int2chars(char *buf, size_t cap, int64_t v)
+{
+    if(cap > NEAT_INT_MAX_CHARS)
+    {
+        size_t len = neat_i64_to_dec(buf, v);
+        buf[len] = '\0';
+        return len;
+    }
+    char tmp[NEAT_INT_MAX_CHARS];
+    return neat_chars_copy(buf, cap, tmp, neat_i64_to_dec(tmp, v));
+}
+
+size_t neat_uint2chars(char *buf, size_t cap, uint64_t v)
+{
+    if(cap > NEAT_INT_MAX_CHARS)
+    {
+        size_t len = neat_u64_to_dec(buf, v);
+        buf[len] = '\0';
+        return len;
+    }
+    char tmp[NEAT_INT_MAX_CHARS];
+    return neat_chars_copy(buf, cap, tmp, neat_u64_to_dec(tmp, v));
+}
+
+size_t neat_hex2chars(char *buf, size_t cap, uint64_t v)
+{
+    char tmp[16];
+    return neat_chars_copy(buf, cap, tmp, neat_u64_to_hex(tmp, v));
+}
+
+// static strings
+
+#define NEAT_STR_(x) #x
+#define NEAT_STR(x) NEAT_STR_(x)
+
+#define NEAT_INTS10(pre, p) \
+pre NEAT_STR(p##0), pre NEAT_STR(p##1), pre NEAT_STR(p##2), pre NEAT_STR(p##3), pre NEAT_STR(p##4), \
+pre NEAT_STR(p##5), pre NEAT_STR(p##6), pre NEAT_STR(p##7), pre NEAT_STR(p##8), pre NEAT_STR(p##9)
+
+#define NEAT_INTS100(pre, p) \
+NEAT_INTS10(pre, p##0), NEAT_INTS10(pre, p##1), NEAT_INTS10(pre, p##2), NEAT_INTS10(pre, p##3), NEAT_INTS10(pre, p##4), \
+NEAT_INTS10(pre, p##5), NEAT_INTS10(pre, p##6), NEAT_INTS10(pre, p##7), NEAT_INTS10(pre, p##8), NEAT_INTS10(pre, p##9)
+
+#define NEAT_INTS_1_99(pre) \
+pre "1", pre "2", pre "3", pre "4", pre "5", pre "6", pre "7", pre "8", pre "9", \
+NEAT_INTS10(pre, 1), NEAT_INTS10(pre, 2), NEAT_INTS10(pre, 3), NEAT_INTS10(pre, 4), NEAT_INTS10(pre, 5), \
+NEAT_INTS10(pre, 6), NEAT_INTS10(pre, 7), NEAT_INTS10(pre, 8), NEAT_INTS10(pre, 9)
+
+// neat_pos_ints[v] is v, neat_neg_ints[v] is -v
+static const char neat_pos_ints[NEAT_SMALL_INT_MAX + 1][4] = {
+    "0", NEAT_INTS_1_99(),
+    NEAT_INTS100(, 1), NEAT_INTS100(, 2), NEAT_INTS100(, 3), NEAT_INTS100(, 4), NEAT_INTS100(, 5),
+    NEAT_INTS100(, 6), NEAT_INTS100(, 7), NEAT_INTS100(, 8), NEAT_INTS100(, 9)
+};
+
+static const char neat_neg_ints[-NEAT_SMALL_INT_MIN + 1][5] = {
+    "0", NEAT_INTS_1_99("-"),
+    NEAT_INTS10("-", 10), NEAT_INTS10("-", 11), "-120", "-121", "-122", "-123", "-124", "-125", "-126", "-127", "-128"
+};
+
+// every char followed by a NUL
+static const char neat_char_strs[512] = {
+#define NEAT_C2(c) (char) (c), 0
+#define NEAT_C16(c) \
+NEAT_C2(c + 0), NEAT_C2(c + 1), NEAT_C2(c + 2),  NEAT_C2(c + 3),  NEAT_C2(c + 4),  NEAT_C2(c + 5),  NEAT_C2(c + 6),  NEAT_C2(c + 7), \
+NEAT_C2(c + 8), NEAT_C2(c + 9), NEAT_C2(c + 10), NEAT_C2(c + 11), NEAT_C2(c + 12), NEAT_C2(c + 13), NEAT_C2(c + 14), NEAT_C2(c + 15)
+    NEAT_C16(0),   NEAT_C16(16),  NEAT_C16(32),  NEAT_C16(48),  NEAT_C16(64),  NEAT_C16(80),  NEAT_C16(96),  NEAT_C16(112),
+    NEAT_C16(128), NEAT_C16(144), NEAT_C16(160), NEAT_C16(176), NEAT_C16(192), NEAT_C16(208), NEAT_C16(224), NEAT_C16(240)
+#undef NEAT_C16
+#undef NEAT_C2
+};
+
+neat_strref neat_str2ref(const char *str)
+{
+    return (neat_strref){ .str = str, .len = strlen(str), .owned = false };
+}
+
+neat_strref neat_char2ref(char c)
+{
+    return (neat_strref){ .str = neat_char_strs + (unsigned char) c * 2, .len = 1, .owned = false };
+}
+
+neat_strref neat_bool2ref(bool b)
+{
+    return b ? (neat_strref){ "true", 4, false } : (neat_strref){ "false", 5, false };
+}
+
+neat_strref neat_int2ref(int64_t v)
+{
+    if(v >= 0) return neat_uint2ref((uint64_t) v);
+    if(v >= NEAT_SMALL_INT_MIN)
+    {
+        const char *str = neat_neg_ints[-v];
+        return (neat_strref){ .str = str, .len = strlen(str), .owned = false };
+    }
+    char *str = malloc(NEAT_INT_MAX_CHARS + 1);
+    size_t len = neat_i64_to_dec(str, v);
+    str[len] = '\0';
+    return (neat_strref){ .str = str, .len = len, .owned = true };
+}
+
+neat_strref neat_uint2ref(uint64_t v)
+{
+    if(v <= NEAT_SMALL_INT_MAX)
+    {
+        const char *str = neat_pos_ints[v];
+        return (neat_strref){ .str = str, .len = (size_t) neat_count_digits(v), .owned = false };
+    }
+    char *str = malloc(NEAT_INT_MAX_CHARS + 1);
+    size_t len = neat_u64_to_dec(str, v);
+    str[len] = '\0';
+    return (neat_strref){ .str = str, .len = len, .owned = true };
+}
+
+neat_strref neat_strref_own(char *str)
+{
+    return (neat_strref){ .str = str, .len = strlen(str), .owned = true };
+}
+
+void neat_strref_free(neat_strref ref)
+{
+    if(ref.owned) free((char *) ref.str);
+}
+
+// shortest round-trip float formatting
+
+/*
+    Ryu (Ulf Adams, 2018). The value is turned into the shortest
+    decimal mantissa and exponent that parses back to the same bits,
+    using a table of 5^i (and 2^k / 5^i) truncated to 125 bits for
+    double and 61 bits for float. The tables are only as big as the
+    exponent range of each type needs.
+*/
+
+static const uint64_t neat_d2s_pow5_inv_split[291][2] = {
+    { 0x1u, 0x2000000000000000u }, { 0x999999999999999au, 0x1999999999999999u },
+    { 0x47ae147ae147ae15u, 0x147ae147ae147ae1u }, { 0x6c8b4395810624deu, 0x10624dd2f1a9fbe7u },
+    { 0x7a786c226809d496u, 0x1a36e2eb1c432ca5u }, { 0x61f9f01b866e43abu, 0x14f8b588e368f084u },
+    { 0xb4c7f34938583622u, 0x10c6f7a0b5ed8d36u }, { 0x87a6520ec08d236au, 0x1ad7f29abcaf4857u },
+    { 0x9fb841a566d74f88u, 0x15798ee2308c39dfu }, { 0xe62d01511f12a607u, 0x112e0be826d694b2u },
+    { 0xd6ae6881cb5109a4u, 0x1b7cdfd9d7bdbab7u }, { 0xdef1ed34a2a73aeau, 0x15fd7fe17964955fu },
+    { 0x7f27f0f6e885c8bbu, 0x119799812dea1119u }, { 0x650cb4be40d60df8u, 0x1c25c268497681c2u },
+    { 0xea70909833de7193u, 0x16849b86a12b9b01u }, { 0x21f3a6e0297ec143u, 0x1203af9ee756159bu },
+    { 0x6985d7cd0f313537u, 0x1cd2b297d889bc2bu }, { 0x2137dfd73f5a90f9u, 0x170ef54646d49689u },
+    { 0xe75fe645cc4873fau, 0x12725dd1d243aba0u }, { 0xa5663d3c7a0d865du, 0x1d83c94fb6d2ac34u },
+    { 0x511e976394d79eb1u, 0x179ca10c9242235du }, { 0xda7edf82dd794bc1u, 0x12e3b40a0e9b4f7du },
+    { 0x2a6498d1625bac68u, 0x1e392010175ee596u }, { 0xeeb6e0a781e2f053u, 0x182db34012b25144u },
+    { 0x58924d52ce4f26a9u, 0x1357c299a88ea76au }, { 0x27507bb7b07ea441u, 0x1ef2d0f5da7dd8aau },
+    { 0x52a6c95fc0655034u, 0x18c240c4aecb13bbu }, { 0xeebd44c99eaa690u, 0x13ce9a36f23c0fc9u },
+    { 0xb17953adc3110a80u, 0x1fb0f6be50601941u }, { 0xc12ddc8b02740867u, 0x195a5efea6b34767u },
+    { 0x3424b06f3529a052u, 0x14484bfeebc29f86u }, { 0x901d59f290ee19dbu, 0x1039d66589687f9eu },
+    { 0x4cfbc31db4b0295fu, 0x19f623d5a8a73297u }, { 0x3d9635b15d59bab2u, 0x14c4e977ba1f5bacu },
+    { 0x97ab5e277de16228u, 0x109d8792fb4c4956u }, { 0xf2abc9d8c9689d0du, 0x1a95a5b7f87a0ef0u },
+    { 0x5bbca17a3aba173eu, 0x154484932d2e725au }, { 0xafca1ac82efb45cbu, 0x11039d428a8b8eaeu },
+    { 0xb2dcf7a6b1920945u, 0x1b38fb9daa78e44au }, { 0xf57d92ebc141a104u, 0x15c72fb1552d836eu },
+    { 0xc46475896767b403u, 0x116c262777579c58u }, { 0x6d6d88dbd8a5ecd2u, 0x1be03d0bf225c6f4u },
+    { 0x8abe071646eb23dbu, 0x164cfda3281e38c3u }, { 0x6efe6c11d255b649u, 0x11d7314f534b609cu },
+    { 0xb197134fb6ef8a0eu, 0x1c8b821885456760u }, { 0x27ac0f72f8bfa1a5u, 0x16d601ad376ab91au },
+    { 0xb95672c260994e1eu, 0x1244ce242c5560e1u }, { 0xf5571e03cdc21695u, 0x1d3ae36d13bbce35u },
+    { 0x2aac18030b01ababu, 0x17624f8a762fd82bu }, { 0xbbbce0026f348956u, 0x12b50c6ec4f31355u },
+    { 0x92c7ccd0b1eda889u, 0x1dee7a4ad4b81eefu }, { 0xdbd30a408e57ba07u, 0x17f1fb6f10934bf2u },
+    { 0x7ca8d50071dfc806u, 0x1327fc58da0f6ff5u }, { 0xfaa7bb33e9660cd6u, 0x1ea6608e29b24cbbu },
+    { 0x9552fc298784d711u, 0x18851a0b548ea3c9u }, { 0xaaa8c9bad2d0ac0eu, 0x139dae6f76d88307u },
+    { 0xdddadc5e1e1aace3u, 0x1f62b0b257c0d1a5u }, { 0x7e48b04b4b488a4fu, 0x191bc08eac9a4151u },
+    { 0xcb6d59d5d5d3a1d9u, 0x141633a556e1cddau }, { 0x3c577b1177dc817bu, 0x1011c2eaabe7d7e2u },
+    { 0xc6f25e825960cf2au, 0x19b604aaaca62636u }, { 0x6bf518684780a5bbu, 0x14919d5556eb51c5u },
+    { 0x232a79ed06008496u, 0x10747ddddf22a7d1u }, { 0xd1dd8fe1a3340756u, 0x1a53fc9631d10c81u },
+    { 0xa7e4731ae8f66c45u, 0x150ffd44f4a73d34u }, { 0x531d28e253f8569eu, 0x10d9976a5d52975du },
+    { 0xeb61db03b98d5762u, 0x1af5bf109550f22eu }, { 0xbc4e48cfc7a445e8u, 0x159165a6ddda5b58u },
+    { 0x6371d3d96c836b20u, 0x11411e1f17e1e2adu }, { 0x9f1c8628ad9f11cdu, 0x1b9b6364f3030448u },
+    { 0xe5b06b53be18db0bu, 0x1615e91d8f359d06u }, { 0xeaf3890fcb4715a2u, 0x11ab20e472914a6bu },
+    { 0x44b8db4c7871bc37u, 0x1c45016d841baa46u }, { 0x3c715d6c6c1635fu, 0x169d9abe03495505u },
+    { 0x3638de456bcde919u, 0x1217aefe69077737u }, { 0x56c163a2461641c1u, 0x1cf2b1970e725858u },
+    { 0xdf011c81d1ab67ceu, 0x17288e1271f51379u }, { 0x7f3416ce4155eca5u, 0x1286d80ec190dc61u },
+    { 0x6520247d3556476eu, 0x1da48ce468e7c702u }, { 0xea801d30f7783925u, 0x17b6d71d20b96c01u },
+    { 0xbb99b0f3f92cfa84u, 0x12f8ac174d612334u }, { 0x5f5c4e532847f739u, 0x1e5aacf215683854u },
+    { 0x7f7d0b75b9d32c2eu, 0x18488a5b44536043u }, { 0x9930d5f7c7dc2358u, 0x136d3b7c36a919cfu },
+    { 0x8eb4898c72f9d226u, 0x1f152bf9f10e8fb2u }, { 0x722a07a38f2e41b8u, 0x18ddbcc7f40ba628u },
+    { 0xc1bb394fa5be9afau, 0x13e497065cd61e86u }, { 0x9c5ec2190930f7f6u, 0x1fd424d6faf030d7u },
+    { 0x49e56814075a5ff8u, 0x197683df2f268d79u }, { 0x6e51201005e1e660u, 0x145ecfe5bf520ac7u },
+    { 0xf1da800cd181851au, 0x104bd984990e6f05u }, { 0x4fc400148268d4f5u, 0x1a12f5a0f4e3e4d6u },
+    { 0xd96999aa01ed772bu, 0x14dbf7b3f71cb711u }, { 0xadee1488018ac5bcu, 0x10aff95cc5b09274u },
+    { 0x497ceda668de092cu, 0x1ab328946f80ea54u }, { 0x3aca57b853e4d424u, 0x155c2076bf9a5510u },
+    { 0x623b7960431d7683u, 0x1116805effaeaa73u }, { 0x9d2bf566d1c8bd9eu, 0x1b5733cb32b110b8u },
+    { 0x7dbcc452416d647fu, 0x15df5ca28ef40d60u }, { 0xcafd69db678ab6ccu, 0x117f7d4ed8c33de6u },
+    { 0xab2f0fc572778adfu, 0x1bff2ee48e052fd7u }, { 0x88f273045b92d580u, 0x1665bf1d3e6a8cacu },
+    { 0xd3f528d049424466u, 0x11eaff4a98553d56u }, { 0xb988414d4203a0a3u, 0x1cab3210f3bb9557u },
+    { 0x6139cdd76802e6e9u, 0x16ef5b40c2fc7779u }, { 0xe761717920025254u, 0x125915cd68c9f92du },
+    { 0xa568b58e999d5086u, 0x1d5b561574765b7cu }, { 0x5120913ee14aa6d2u, 0x177c44ddf6c515fdu },
+    { 0xa74d40ff1aa21f0eu, 0x12c9d0b1923744cau }, { 0xbaece64f769cb4au, 0x1e0fb44f50586e11u },
+    { 0x3c8bd850c5ee3c3bu, 0x180c903f7379f1a7u }, { 0xca0979da37f1c9c9u, 0x133d4032c2c7f485u },
+    { 0xa9a8c2f6bfe942dbu, 0x1ec866b79e0cba6fu }, { 0x2153cf2bccba9be3u, 0x18a0522c7e709526u },
+    { 0x1aa9728970954982u, 0x13b374f06526ddb8u }, { 0xf775840f1a88759du, 0x1f8587e7083e2f8cu },
+    { 0x5f9136727ba05e17u, 0x19379fec0698260au }, { 0x1940f85b9619e4dfu, 0x142c7ff0054684d5u },
+    { 0xe100c6afab47ea4cu, 0x1023998cd1053710u }, { 0xce67a44c453fdd47u, 0x19d28f47b4d524e7u },
+    { 0xd852e9d69dccb106u, 0x14a8729fc3ddb71fu }, { 0x79dbee454b0a2738u, 0x1086c219697e2c19u },
+    { 0x295fe3a211a9d859u, 0x1a71368f0f30468fu }, { 0xbab31c81a7bb137au, 0x15275ed8d8f36ba5u },
+    { 0x6228e39aec95a92fu, 0x10ec4be0ad8f8951u }, { 0x9d0e38f7e0ef7517u, 0x1b13ac9aaf4c0ee8u },
+    { 0xb0d82d931a592a79u, 0x15a956e225d67253u }, { 0x8d79be0f4847552eu, 0x11544581b7dec1dcu },
+    { 0x158f967eda0bbb7cu, 0x1bba08cf8c979c94u }, { 0x77a611ff14d62f97u, 0x162e6d72d6dfb076u },
+    { 0xf951a7ff43de8c79u, 0x11bebdf578b2f391u }, { 0xc21c3ffed2fdad8eu, 0x1c6463225ab7ec1cu },
+    { 0x1b0333242648ad8u, 0x16b6b5b5155ff017u }, { 0x159c28e9b83a246u, 0x122bc490dde659acu },
+    { 0xcef604175f3903a3u, 0x1d12d41afca3c2acu }, { 0x725e69ac4c2d9c83u, 0x17424348ca1c9bbdu },
+    { 0xf5185489d68ae39cu, 0x129b69070816e2fdu }, { 0xee8d540fbdab05c6u, 0x1dc574d80cf16b2fu },
+    { 0xbed77672fe226b05u, 0x17d12a4670c1228cu }, { 0xff12c528cb4ebc04u, 0x130dbb6b8d674ed6u },
+    { 0xcb513b74787df9a0u, 0x1e7c5f127bd87e24u }, { 0x90dc929f9fe614du, 0x18637f41fcad31b7u },
+    { 0xa0d7d42194cb810au, 0x1382cc34ca2427c5u }, { 0x67bfb9cf5478ce77u, 0x1f37ad21436d0c6fu },
+    { 0x1fcc94a5dd2d71f9u, 0x18f9574dcf8a7059u }, { 0x7fd6dd517dbdf4c7u, 0x13faac3e3fa1f37au },
+    { 0xffbe2ee8c92fee0bu, 0x1ff779fd329cb8c3u }, { 0x6631bf20a0f324d6u, 0x1992c7fdc216fa36u },
+    { 0xb827cc1a1a5c1d78u, 0x14756ccb01abfb5eu }, { 0x935309ae7b7ce460u, 0x105df0a267bcc918u },
+    { 0x1eeb42b0c594a099u, 0x1a2fe76a3f9474f4u }, { 0xe58902270476e6e1u, 0x14f31f8832dd2a5cu },
+    { 0xb7a0ce859d2bebe7u, 0x10c27fa028b0eeb0u }, { 0x59014a6f61dfdfd8u, 0x1ad0cc33744e4ab4u },
+    { 0xe0cdd525e7e64cadu, 0x1573d68f903ea229u }, { 0x4d7177518651d6f1u, 0x11297872d9cbb4eeu },
+    { 0x7be8bee8d6e957e8u, 0x1b758d848fac54b0u }, { 0xfcba3253df211320u, 0x15f7a46a0c89dd59u },
+    { 0x63c8284318e74280u, 0x1192e9ee706e4aaeu }, { 0x60d0d3827d86a66u, 0x1c1e43171a4a1117u },
+    { 0x6b3da42cecad21ebu, 0x167e9c127b6e7412u }, { 0x88fe1cf0bd574e56u, 0x11fee341fc585cdbu },
+    { 0x419694b462254a23u, 0x1ccb0536608d615fu }, { 0x67abaa29e81dd4e9u, 0x1708d0f84d3de77fu },
+    { 0xb95621bb2017dd87u, 0x126d73f9d764b932u }, { 0xc223692b668c95a5u, 0x1d7becc2f23ac1eau },
+    { 0xce82ba891ed6de1du, 0x179657025b6234bbu }, { 0xa53562074bdf1818u, 0x12deac01e2b4f6fcu },
+    { 0x3b889cd87964f359u, 0x1e3113363787f194u }, { 0xfc6d4a46c783f5e1u, 0x18274291c6065adcu },
+    { 0x30576e9f06032b1au, 0x13529ba7d19eaf17u }, { 0x1a257dcb3cd1de90u, 0x1eea92a61c311825u },
+    { 0x481dfe3c30a7e540u, 0x18bba884e35a79b7u }, { 0xd34b31c9c0865100u, 0x13c9539d82aec7c5u },
+    { 0x5211e942cda3b4cdu, 0x1fa885c8d117a609u }, { 0x74db21023e1c90a4u, 0x19539e3a40dfb807u },
+    { 0xf715b401cb4a0d50u, 0x1442e4fb67196005u }, { 0xf8de299b09080aa7u, 0x103583fc527ab337u },
+    { 0x8e304291a80cddd7u, 0x19ef3993b72ab859u }, { 0x3e8d020e200a4b13u, 0x14bf6142f8eef9e1u },
+    { 0x653d9b3e80083c0fu, 0x10991a9bfa58c7e7u }, { 0x6ec8f864000d2ce4u, 0x1a8e90f9908e0ca5u },
+    { 0x8bd3f9e999a423eau, 0x153eda614071a3b7u }, { 0x3ca994bae1501cbbu, 0x10ff151a99f482f9u },
+    { 0xc775bac49bb3612bu, 0x1b31bb5dc320d18eu }, { 0xd2c4956a16291a89u, 0x15c162b168e70e0bu },
+    { 0xdbd0778811ba7ba1u, 0x11678227871f3e6fu }, { 0x2c80bf401c5d929bu, 0x1bd8d03f3e9863e6u },
+    { 0xbd33cc3349e47549u, 0x16470cff6546b651u }, { 0xca8fd68f6e505dd4u, 0x11d270cc51055ea7u },
+    { 0x4419574be3b3c953u, 0x1c83e7ad4e6efdd9u }, { 0x347790982f63aa9u, 0x16cfec8aa52597e1u },
+    { 0xcf6c60d468c4fbbau, 0x123ff06eea847980u }, { 0xe57a34870e07f92au, 0x1d331a4b10d3f59au },
+    { 0x512e906c0b399422u, 0x175c1508da432ae2u }, { 0xda8ba6bcd5c7a9b5u, 0x12b010d3e1cf5581u },
+    { 0x90df712e22d90f87u, 0x1de6815302e5559cu }, { 0xda4c5a8b4f140c6cu, 0x17eb9aa8cf1dde16u },
+    { 0xaea37ba2a5a9a38au, 0x1322e220a5b17e78u }, { 0x7dd25f6aa2a905a9u, 0x1e9e369aa2b59727u },
+    { 0x97db7f888220d154u, 0x187e92154ef7ac1fu }, { 0x797c6606ce80a777u, 0x139874ddd8c6234cu },
+    { 0x8f2d700ae4010bf1u, 0x1f5a549627a36badu }, { 0xc2459a25000d65au, 0x191510781fb5efbeu },
+    { 0x701d1481d99a4515u, 0x1410d9f9b2f7f2feu }, { 0xc017439b147b6a77u, 0x100d7b2e28c65bfeu },
+    { 0xccf205c4ed9243f2u, 0x19af2b7d0e0a2ccau }, { 0xa5b37d0be0e9cc2u, 0x148c22ca71a1bd6fu },
+    { 0x848f973cb3ee3ceu, 0x10701bd527b4978cu }, { 0xda0e5bec78649fb0u, 0x1a4cf9550c5425acu },
+    { 0x7b3eaff060507fc0u, 0x150a6110d6a9b7bdu }, { 0x95cbbff380406633u, 0x10d51a73deee2c97u },
+    { 0xefac665266cd7052u, 0x1aee90b964b04758u }, { 0x2623850eb8a459dbu, 0x158ba6fab6f36c47u },
+    { 0x1e82d0d893b6ae49u, 0x113c85955f29236cu }, { 0xfd9e1af41f8ab075u, 0x1b9408eefea838acu },
+    { 0x97b1af29b2d559f7u, 0x16100725988693bdu }, { 0xac8e25baf5777b2cu, 0x11a66c1e139edc97u },
+    { 0x7a7d092b2258c513u, 0x1c3d79c9b8fe2dbfu }, { 0x61fda0ef4ead6a76u, 0x169794a160cb57ccu },
+    { 0xe7fe1a590bbdeec5u, 0x1212dd4de7091309u }, { 0xa6635d5b45fcb13au, 0x1ceafbafd80e84dcu },
+    { 0x851c4aaf6b308dc8u, 0x172262f3133ed0b0u }, { 0xd0e36ef2bc26d7d4u, 0x1281e8c275cbda26u },
+    { 0xb49f17eac6a48c86u, 0x1d9ca79d894629d7u }, { 0x2a18dfef0550706bu, 0x17b08617a104ee46u },
+    { 0x54e0b3259dd9f389u, 0x12f39e794d9d8b6bu }, { 0x87cdeb6f62f65274u, 0x1e5297287c2f4578u },
+    { 0xd30b22bf825ea85du, 0x18421286c9bf6ac6u }, { 0xf3c1bcc684bb9e4u, 0x13680ed23aff889fu },
+    { 0x18602c7a4079296du, 0x1f0ce4839198da98u }, { 0x46b356c833942124u, 0x18d71d360e13e213u },
+    { 0x388f78a029434db6u, 0x13df4a91a4dcb4dcu }, { 0x5a7f2766a86baf8au, 0x1fcbaa82a1612160u },
+    { 0x153285ebb9efbfa2u, 0x196fbb9bb44db44du }, { 0xaa8ed189618c994eu, 0x145962e2f6a4903du },
+    { 0xeed8a7a11ad6e10cu, 0x1047824f2bb6d9cau }, { 0x7e27729b5e249b45u, 0x1a0c03b1df8af611u },
+    { 0xfe85f549181d4904u, 0x14d6695b193bf80du }, { 0xcb9e5dd4134aa0d0u, 0x10ab877c142ff9a4u },
+    { 0xdf63c9535211014du, 0x1aac0bf9b9e65c3au }, { 0x191ca10f74da6771u, 0x15566ffafb1eb02fu },
+    { 0xadb080d92a4852c1u, 0x1111f32f2f4bc025u }, { 0x15e7348eaa0d5134u, 0x1b4feb7eb212cd09u },
+    { 0xab1f5d3eee710dc4u, 0x15d98932280f0a6du }, { 0xbc1917658b8da49du, 0x117ad428200c0857u },
+    { 0x2cf4f23c127c3a94u, 0x1bf7b9d9cce00d59u }, { 0xf0c3f4fcdb969543u, 0x165fc7e170b33de0u },
+    { 0x5a365d9716121103u, 0x11e6398126f5cb1au }, { 0x9056fc24f01ce804u, 0x1ca38f350b22de90u },
+    { 0xd9df301d8ce3ecd0u, 0x16e93f5da2824ba6u }, { 0xe17f59b13d8323dau, 0x125432b14ecea2ebu },
+    { 0x68cbc2b52f38395cu, 0x1d53844ee47dd179u }, { 0x53d6355dbf602de3u, 0x177603725064a794u },
+    { 0xa9782ab165e68b1cu, 0x12c4cf8ea6b6ec76u }, { 0xf26aab56fd744fau, 0x1e07b27dd78b13f1u },
+    { 0x3f52222abfdf6a62u, 0x18062864ac6f4327u }, { 0x65db4e88997f884eu, 0x1338205089f29c1fu },
+    { 0x6fc54a7428cc0d4au, 0x1ec033b40fea9365u }, { 0x596aa1f68709a43bu, 0x1899c2f673220f84u },
+    { 0xadeee7f86c07b696u, 0x13ae3591f5b4d936u }, { 0x497e3ff3e00c5756u, 0x1f7d228322baf524u },
+    { 0xd464fff64cd6ac45u, 0x1930e868e89590e9u }, { 0x4383fff83d7889d1u, 0x14272053ed4473eeu },
+    { 0xcf9cccc69793a174u, 0x101f4d0ff1038ff1u }, { 0x7f6147a425b90252u, 0x19cbae7fe805b31cu },
+    { 0xcc4dd2e9b7c7350fu, 0x14a2f1ffecd15c16u }, { 0x3d0b0f215fd290d9u, 0x10825b3323dab012u },
+    { 0x61ab4b689950e7c1u, 0x1a6a2b85062ab350u }, { 0x4e22a2ba1440b967u, 0x1521bc6a6b555c40u },
+    { 0xb4ee894dd009453u, 0x10e7c9eebc4449cdu }, { 0x1217da87c800ed51u, 0x1b0c764ac6d3a948u },
+    { 0xdb46486ca000bddau, 0x15a391d56bdc876cu }, { 0x490506bd4ccd64afu, 0x114fa7ddefe39f8au },
+    { 0xa8080ac87ae23ab1u, 0x1bb2a62fe638ff43u }, { 0x5339a239fbe82ef4u, 0x162884f31e93ff69u },
+    { 0x75c7b4fb2fecf25du, 0x11ba03f5b20fff87u }, { 0x22d92191e647ea2eu, 0x1c5cd322b67fff3fu },
+    { 0xb57a8141850654f2u, 0x16b0a8e891ffff65u }, { 0xc4620101373843f5u, 0x1226ed86db3332b7u },
+    { 0x3a366801f1f39feeu, 0x1d0b15a491eb8459u }, { 0xfb5eb99b27f6198bu, 0x173c115074bc69e0u },
+    { 0x2f7efae2865e7ad6u, 0x129674405d6387e7u }, { 0xe597f7d0d6fd9156u, 0x1dbd86cd6238d971u },
+    { 0x8479930d78cadaabu, 0x17cad23de82d7ac1u }, { 0xd06142712d6f1556u, 0x1308a831868ac89au },
+    { 0x4d686a4eaf182222u, 0x1e74404f3daada91u }, { 0xa453883ef279b4e8u, 0x185d003f6488aedau },
+    { 0xe9dc6cff28615d87u, 0x137d99cc506d58aeu }, { 0xa960ae650d6895a4u, 0x1f2f5c7a1a488de4u },
+    { 0xbab3beb73ded4483u, 0x18f2b061aea07183u }
+};
+
+static const uint64_t neat_d2s_pow5_split[326][2] = {
+    { 0x0u, 0x1000000000000000u }, { 0x0u, 0x1400000000000000u },
+    { 0x0u, 0x1900000000000000u }, { 0x0u, 0x1f40000000000000u },
+    { 0x0u, 0x1388000000000000u }, { 0x0u, 0x186a000000000000u },
+    { 0x0u, 0x1e84800000000000u }, { 0x0u, 0x1312d00000000000u },
+    { 0x0u, 0x17d7840000000000u }, { 0x0u, 0x1dcd650000000000u },
+    { 0x0u, 0x12a05f2000000000u }, { 0x0u, 0x174876e800000000u },
+    { 0x0u, 0x1d1a94a200000000u }, { 0x0u, 0x12309ce540000000u },
+    { 0x0u, 0x16bcc41e90000000u }, { 0x0u, 0x1c6bf52634000000u },
+    { 0x0u, 0x11c37937e0800000u }, { 0x0u, 0x16345785d8a00000u },
+    { 0x0u, 0x1bc16d674ec80000u }, { 0x0u, 0x1158e460913d0000u },
+    { 0x0u, 0x15af1d78b58c4000u }, { 0x0u, 0x1b1ae4d6e2ef5000u },
+    { 0x0u, 0x10f0cf064dd59200u }, { 0x0u, 0x152d02c7e14af680u },
+    { 0x0u, 0x1a784379d99db420u }, { 0x0u, 0x108b2a2c28029094u },
+    { 0x0u, 0x14adf4b7320334b9u }, { 0x4000000000000000u, 0x19d971e4fe8401e7u },
+    { 0x8800000000000000u, 0x1027e72f1f128130u }, { 0xaa00000000000000u, 0x1431e0fae6d7217cu },
+    { 0xd480000000000000u, 0x193e5939a08ce9dbu }, { 0xc9a0000000000000u, 0x1f8def8808b02452u },
+    { 0xbe04000000000000u, 0x13b8b5b5056e16b3u }, { 0xad85000000000000u, 0x18a6e32246c99c60u },
+    { 0xd8e6400000000000u, 0x1ed09bead87c0378u }, { 0x878fe80000000000u, 0x13426172c74d822bu },
+    { 0x6973e20000000000u, 0x1812f9cf7920e2b6u }, { 0x3d0da8000000000u, 0x1e17b84357691b64u },
+    { 0x8262889000000000u, 0x12ced32a16a1b11eu }, { 0x22fb2ab400000000u, 0x178287f49c4a1d66u },
+    { 0xabb9f56100000000u, 0x1d6329f1c35ca4bfu }, { 0xcb54395ca0000000u, 0x125dfa371a19e6f7u },
+    { 0xbe2947b3c8000000u, 0x16f578c4e0a060b5u }, { 0x2db399a0ba000000u, 0x1cb2d6f618c878e3u },
+    { 0xfc90400474400000u, 0x11efc659cf7d4b8du }, { 0x7bb4500591500000u, 0x166bb7f0435c9e71u },
+    { 0xdaa16406f5a40000u, 0x1c06a5ec5433c60du }, { 0xa8a4de8459868000u, 0x118427b3b4a05bc8u },
+    { 0xd2ce16256fe82000u, 0x15e531a0a1c872bau }, { 0x87819baecbe22800u, 0x1b5e7e08ca3a8f69u },
+    { 0xf4b1014d3f6d5900u, 0x111b0ec57e6499a1u }, { 0x71dd41a08f48af40u, 0x1561d276ddfdc00au },
+    { 0xe549208b31adb10u, 0x1aba4714957d300du }, { 0x28f4db456ff0c8eau, 0x10b46c6cdd6e3e08u },
+    { 0x33321216cbecfb24u, 0x14e1878814c9cd8au }, { 0xbffe969c7ee839edu, 0x1a19e96a19fc40ecu },
+    { 0xf7ff1e21cf512434u, 0x105031e2503da893u }, { 0xf5fee5aa43256d41u, 0x14643e5ae44d12b8u },
+    { 0x337e9f14d3eec892u, 0x197d4df19d605767u }, { 0x5e46da08ea7ab6u, 0x1fdca16e04b86d41u },
+    { 0xa03aec4845928cb2u, 0x13e9e4e4c2f34448u }, { 0xc849a75a56f72fdeu, 0x18e45e1df3b0155au },
+    { 0x7a5c1130ecb4fbd6u, 0x1f1d75a5709c1ab1u }, { 0xec798abe93f11d65u, 0x13726987666190aeu },
+    { 0xa797ed6e38ed64bfu, 0x184f03e93ff9f4dau }, { 0x517de8c9c728bdefu, 0x1e62c4e38ff87211u },
+    { 0xd2eeb17e1c7976b5u, 0x12fdbb0e39fb474au }, { 0x87aa5ddda397d462u, 0x17bd29d1c87a191du },
+    { 0xe994f5550c7dc97bu, 0x1dac74463a989f64u }, { 0x11fd195527ce9dedu, 0x128bc8abe49f639fu },
+    { 0xd67c5faa71c24568u, 0x172ebad6ddc73c86u }, { 0x8c1b77950e32d6c2u, 0x1cfa698c95390ba8u },
+    { 0x57912abd28dfc639u, 0x121c81f7dd43a749u }, { 0xad75756c7317b7c8u, 0x16a3a275d494911bu },
+    { 0x98d2d2c78fdda5bau, 0x1c4c8b1349b9b562u }, { 0x9f83c3bcb9ea8794u, 0x11afd6ec0e14115du },
+    { 0x764b4abe8652979u, 0x161bcca7119915b5u }, { 0x493de1d6e27e73d7u, 0x1ba2bfd0d5ff5b22u },
+    { 0x6dc6ad264d8f0866u, 0x1145b7e285bf98f5u }, { 0xc938586fe0f2ca80u, 0x159725db272f7f32u },
+    { 0x7b866e8bd92f7d20u, 0x1afcef51f0fb5effu }, { 0xad34051767bdae34u, 0x10de1593369d1b5fu },
+    { 0x9881065d41ad19c1u, 0x15159af804446237u }, { 0x7ea147f492186032u, 0x1a5b01b605557ac5u },
+    { 0x6f24ccf8db4f3c1fu, 0x1078e111c3556cbbu }, { 0x4aee003712230b27u, 0x14971956342ac7eau },
+    { 0xdda98044d6abcdf0u, 0x19bcdfabc13579e4u }, { 0xa89f02b062b60b6u, 0x10160bcb58c16c2fu },
+    { 0xcd2c6c35c7b638e4u, 0x141b8ebe2ef1c73au }, { 0x8077874339a3c71du, 0x1922726dbaae3909u },
+    { 0xe0956914080cb8e4u, 0x1f6b0f092959c74bu }, { 0x6c5d61ac8507f38eu, 0x13a2e965b9d81c8fu },
+    { 0x4774ba17a649f072u, 0x188ba3bf284e23b3u }, { 0x1951e89d8fdc6c8fu, 0x1eae8caef261aca0u },
+    { 0xfd3316279e9c3d9u, 0x132d17ed577d0be4u }, { 0x13c7fdbb186434cfu, 0x17f85de8ad5c4eddu },
+    { 0x58b9fd29de7d4203u, 0x1df67562d8b36294u }, { 0xb7743e3a2b0e4942u, 0x12ba095dc7701d9cu },
+    { 0xe5514dc8b5d1db92u, 0x17688bb5394c2503u }, { 0xdea5a13ae3465277u, 0x1d42aea2879f2e44u },
+    { 0xb2784c4ce0bf38au, 0x1249ad2594c37cebu }, { 0xcdf165f6018ef06du, 0x16dc186ef9f45c25u },
+    { 0x416dbf7381f2ac88u, 0x1c931e8ab871732fu }, { 0x88e497a83137abd5u, 0x11dbf316b346e7fdu },
+    { 0xeb1dbd923d8596cau, 0x1652efdc6018a1fcu }, { 0x25e52cf6cce6fc7du, 0x1be7abd3781eca7cu },
+    { 0x97af3c1a40105dceu, 0x1170cb642b133e8du }, { 0xfd9b0b20d0147542u, 0x15ccfe3d35d80e30u },
+    { 0x3d01cde904199292u, 0x1b403dcc834e11bdu }, { 0x462120b1a28ffb9bu, 0x1108269fd210cb16u },
+    { 0xd7a968de0b33fa82u, 0x154a3047c694fddbu }, { 0xcd93c3158e00f923u, 0x1a9cbc59b83a3d52u },
+    { 0xc07c59ed78c09bb6u, 0x10a1f5b813246653u }, { 0xb09b7068d6f0c2a3u, 0x14ca732617ed7fe8u },
+    { 0xdcc24c830cacf34cu, 0x19fd0fef9de8dfe2u }, { 0xc9f96fd1e7ec180fu, 0x103e29f5c2b18bedu },
+    { 0x3c77cbc661e71e13u, 0x144db473335deee9u }, { 0x8b95beb7fa60e598u, 0x1961219000356aa3u },
+    { 0x6e7b2e65f8f91efeu, 0x1fb969f40042c54cu }, { 0xc50cfcffbb9bb35fu, 0x13d3e2388029bb4fu },
+    { 0xb6503c3faa82a037u, 0x18c8dac6a0342a23u }, { 0xa3e44b4f95234844u, 0x1efb1178484134acu },
+    { 0xe66eaf11bd360d2bu, 0x135ceaeb2d28c0ebu }, { 0xe00a5ad62c839075u, 0x183425a5f872f126u },
+    { 0x980cf18bb7a47493u, 0x1e412f0f768fad70u }, { 0x5f0816f752c6c8dcu, 0x12e8bd69aa19cc66u },
+    { 0xf6ca1cb527787b13u, 0x17a2ecc414a03f7fu }, { 0xf47ca3e2715699d7u, 0x1d8ba7f519c84f5fu },
+    { 0xf8cde66d86d62026u, 0x127748f9301d319bu }, { 0xf7016008e88ba830u, 0x17151b377c247e02u },
+    { 0xb4c1b80b22ae923cu, 0x1cda62055b2d9d83u }, { 0x50f91306f5ad1b65u, 0x12087d4358fc8272u },
+    { 0xe53757c8b318623fu, 0x168a9c942f3ba30eu }, { 0x9e852dbadfde7acfu, 0x1c2d43b93b0a8bd2u },
+    { 0xa3133c94cbeb0cc1u, 0x119c4a53c4e69763u }, { 0x8bd80bb9fee5cff1u, 0x16035ce8b6203d3cu },
+    { 0xaece0ea87e9f43eeu, 0x1b843422e3a84c8bu }, { 0x4d40c9294f238a75u, 0x1132a095ce492fd7u },
+    { 0x2090fb73a2ec6d12u, 0x157f48bb41db7bcdu }, { 0x68b53a508ba78856u, 0x1adf1aea12525ac0u },
+    { 0x417144725748b536u, 0x10cb70d24b7378b8u }, { 0x51cd958eed1ae283u, 0x14fe4d06de5056e6u },
+    { 0xe640faf2a8619b24u, 0x1a3de04895e46c9fu }, { 0xefe89cd7a93d00f7u, 0x1066ac2d5daec3e3u },
+    { 0xebe2c40d938c4134u, 0x14805738b51a74dcu }, { 0x26db7510f86f5181u, 0x19a06d06e2611214u },
+    { 0x9849292a9b4592f1u, 0x100444244d7cab4cu }, { 0xbe5b73754216f7adu, 0x1405552d60dbd61fu },
+    { 0xadf25052929cb598u, 0x1906aa78b912cba7u }, { 0x996ee4673743e2ffu, 0x1f485516e7577e91u },
+    { 0xffe54ec0828a6ddfu, 0x138d352e5096af1au }, { 0xbfdea270a32d0957u, 0x18708279e4bc5ae1u },
+    { 0x2fd64b0ccbf84badu, 0x1e8ca3185deb719au }, { 0x5de5eee7ff7b2f4cu, 0x1317e5ef3ab32700u },
+    { 0x755f6aa1ff59fb1fu, 0x17dddf6b095ff0c0u }, { 0x92b7454a7f3079e7u, 0x1dd55745cbb7ecf0u },
+    { 0x5bb28b4e8f7e4c30u, 0x12a5568b9f52f416u }, { 0xf29f2e22335ddf3cu, 0x174eac2e8727b11bu },
+    { 0xef46f9aac035570bu, 0x1d22573a28f19d62u }, { 0xd58c5c0ab8215667u, 0x123576845997025du },
+    { 0x4aef730d6629ac01u, 0x16c2d4256ffcc2f5u }, { 0x9dab4fd0bfb41701u, 0x1c73892ecbfbf3b2u },
+    { 0xa28b11e277d08e60u, 0x11c835bd3f7d784fu }, { 0x8b2dd65b15c4b1f9u, 0x163a432c8f5cd663u },
+    { 0x6df94bf1db35de77u, 0x1bc8d3f7b3340bfcu }, { 0xc4bbcf772901ab0au, 0x115d847ad000877du },
+    { 0x35eac354f34215cdu, 0x15b4e5998400a95du }, { 0x8365742a30129b40u, 0x1b221effe500d3b4u },
+    { 0xd21f689a5e0ba108u, 0x10f5535fef208450u }, { 0x6a742c0f58e894au, 0x1532a837eae8a565u },
+    { 0x4851137132f22b9du, 0x1a7f5245e5a2cebeu }, { 0xed32ac26bfd75b42u, 0x108f936baf85c136u },
+    { 0xa87f57306fcd3212u, 0x14b378469b673184u }, { 0xd29f2cfc8bc07e97u, 0x19e056584240fde5u },
+    { 0xa3a37c1dd7584f1eu, 0x102c35f729689eafu }, { 0x8c8c5b254d2e62e6u, 0x14374374f3c2c65bu },
+    { 0x6faf71eea079fb9fu, 0x1945145230b377f2u }, { 0xb9b4e6a48987a87u, 0x1f965966bce055efu },
+    { 0x674111026d5f4c94u, 0x13bdf7e0360c35b5u }, { 0xc111554308b71fbau, 0x18ad75d8438f4322u },
+    { 0x7155aa93cae4e7a8u, 0x1ed8d34e547313ebu }, { 0x26d58a9c5ecf10c9u, 0x13478410f4c7ec73u },
+    { 0xf08aed437682d4fbu, 0x1819651531f9e78fu }, { 0xecada89454238a3au, 0x1e1fbe5a7e786173u },
+    { 0x73ec895cb4963664u, 0x12d3d6f88f0b3ce8u }, { 0x90e7abb3e1bbc3fdu, 0x1788ccb6b2ce0c22u },
+    { 0x352196a0da2ab4fdu, 0x1d6affe45f818f2bu }, { 0x134fe24885ab11eu, 0x1262dfeebbb0f97bu },
+    { 0xc1823dadaa715d65u, 0x16fb97ea6a9d37d9u }, { 0x31e2cd19150db4bfu, 0x1cba7de5054485d0u },
+    { 0x1f2dc02fad2890f7u, 0x11f48eaf234ad3a2u }, { 0xa6f9303b9872b535u, 0x1671b25aec1d888au },
+    { 0x50b77c4a7e8f6282u, 0x1c0e1ef1a724eaadu }, { 0x5272adae8f199d91u, 0x1188d357087712acu },
+    { 0x670f591a32e004f6u, 0x15eb082cca94d757u }, { 0x40d32f60bf980633u, 0x1b65ca37fd3a0d2du },
+    { 0x4883fd9c77bf03e0u, 0x111f9e62fe44483cu }, { 0x5aa4fd0395aec4d8u, 0x156785fbbdd55a4bu },
+    { 0x314e3c447b1a760eu, 0x1ac1677aad4ab0deu }, { 0xded0e5aaccf089c9u, 0x10b8e0acac4eae8au },
+    { 0x96851f15802cac3bu, 0x14e718d7d7625a2du }, { 0xfc2666dae037d74au, 0x1a20df0dcd3af0b8u },
+    { 0x9d980048cc22e68eu, 0x10548b68a044d673u }, { 0x84fe005aff2ba032u, 0x1469ae42c8560c10u },
+    { 0xa63d8071bef6883eu, 0x198419d37a6b8f14u }, { 0xcfcce08e2eb42a4eu, 0x1fe52048590672d9u },
+    { 0x21e00c58dd309a70u, 0x13ef342d37a407c8u }, { 0x2a580f6f147cc10du, 0x18eb0138858d09bau },
+    { 0xb4ee134ad99bf150u, 0x1f25c186a6f04c28u }, { 0x7114cc0ec80176d2u, 0x137798f428562f99u },
+    { 0xcd59ff127a01d486u, 0x18557f31326bbb7fu }, { 0xc0b07ed7188249a8u, 0x1e6adefd7f06aa5fu },
+    { 0xd86e4f466f516e09u, 0x1302cb5e6f642a7bu }, { 0xce89e3180b25c98bu, 0x17c37e360b3d351au },
+    { 0x822c5bde0def3beeu, 0x1db45dc38e0c8261u }, { 0xf15bb96ac8b58575u, 0x1290ba9a38c7d17cu },
+    { 0x2db2a7c57ae2e6d2u, 0x1734e940c6f9c5dcu }, { 0x391f51b6d99ba086u, 0x1d022390f8b83753u },
+    { 0x3b3931248014454u, 0x1221563a9b732294u }, { 0x4a077d6da019569u, 0x16a9abc9424feb39u },
+    { 0x45c895cc9081fac3u, 0x1c5416bb92e3e607u }, { 0x8b9d5d9fda513cbau, 0x11b48e353bce6fc4u },
+    { 0xae84b507d0e58be8u, 0x1621b1c28ac20bb5u }, { 0x1a25e249c51eeee3u, 0x1baa1e332d728ea3u },
+    { 0xf057ad6e1b33554du, 0x114a52dffc679925u }, { 0x6c6d98c9a2002aa1u, 0x159ce797fb817f6fu },
+    { 0x4788fefc0a803549u, 0x1b04217dfa61df4bu }, { 0xcb59f5d8690214eu, 0x10e294eebc7d2b8fu },
+    { 0xcfe30734e83429a1u, 0x151b3a2a6b9c7672u }, { 0x83dbc9022241340au, 0x1a6208b50683940fu },
+    { 0xb2695da15568c086u, 0x107d457124123c89u }, { 0x1f03b509aac2f0a7u, 0x149c96cd6d16cbacu },
+    { 0x26c4a24c1573acd1u, 0x19c3bc80c85c7e97u }, { 0x783ae56f8d684c03u, 0x101a55d07d39cf1eu },
+    { 0x16499ecb70c25f03u, 0x1420eb449c8842e6u }, { 0x9bdc067e4cf2f6c4u, 0x19292615c3aa539fu },
+    { 0x82d3081de02fb476u, 0x1f736f9b3494e887u }, { 0xb1c3e512ac1dd0c9u, 0x13a825c100dd1154u },
+    { 0xde34de57572544fcu, 0x18922f31411455a9u }, { 0x55c215ed2cee963bu, 0x1eb6bafd91596b14u },
+    { 0xb5994db43c151de5u, 0x133234de7ad7e2ecu }, { 0xe2ffa1214b1a655eu, 0x17fec216198ddba7u },
+    { 0xdbbf89699de0feb6u, 0x1dfe729b9ff15291u }, { 0x2957b5e202ac9f31u, 0x12bf07a143f6d39bu },
+    { 0xf3ada35a8357c6feu, 0x176ec98994f48881u }, { 0x70990c31242db8bdu, 0x1d4a7bebfa31aaa2u },
+    { 0x865fa79eb69c9376u, 0x124e8d737c5f0aa5u }, { 0xe7f791866443b854u, 0x16e230d05b76cd4eu },
+    { 0xa1f575e7fd54a669u, 0x1c9abd04725480a2u }, { 0xa53969b0fe54e801u, 0x11e0b622c774d065u },
+    { 0xe87c41d3dea2202u, 0x1658e3ab7952047fu }, { 0xd229b5248d64aa82u, 0x1bef1c9657a6859eu },
+    { 0x435a1136d85eea91u, 0x117571ddf6c81383u }, { 0x143095848e76a536u, 0x15d2ce55747a1864u },
+    { 0x193cbae5b2144e83u, 0x1b4781ead1989e7du }, { 0x2fc5f4cf8f4cb112u, 0x110cb132c2ff630eu },
+    { 0xbbb77203731fdd56u, 0x154fdd7f73bf3bd1u }, { 0x2aa54e844fe7d4acu, 0x1aa3d4df50af0ac6u },
+    { 0xdaa75112b1f0e4ebu, 0x10a6650b926d66bbu }, { 0xd15125575e6d1e26u, 0x14cffe4e7708c06au },
+    { 0x85a56ead360865b0u, 0x1a03fde214caf085u }, { 0x7387652c41c53f8eu, 0x10427ead4cfed653u },
+    { 0x50693e7752368f71u, 0x14531e58a03e8be8u }, { 0x64838e1526c4334eu, 0x1967e5eec84e2ee2u },
+    { 0xfda4719a70754022u, 0x1fc1df6a7a61ba9au }, { 0xde86c70086494815u, 0x13d92ba28c7d14a0u },
+    { 0x162878c0a7db9a1au, 0x18cf768b2f9c59c9u }, { 0x5bb296f0d1d280a1u, 0x1f03542dfb83703bu },
+    { 0x194f9e5683239064u, 0x1362149cbd322625u }, { 0x5fa385ec23ec747eu, 0x183a99c3ec7eafaeu },
+    { 0xf78c67672ce7919du, 0x1e494034e79e5b99u }, { 0x3ab7c0a07c10bb02u, 0x12edc82110c2f940u },
+    { 0x4965b0c89b14e9c3u, 0x17a93a2954f3b790u }, { 0x5bbf1cfac1da2433u, 0x1d9388b3aa30a574u },
+    { 0xb957721cb92856a0u, 0x127c35704a5e6768u }, { 0xe7ad4ea3e7726c48u, 0x171b42cc5cf60142u },
+    { 0xa198a24ce14f075au, 0x1ce2137f74338193u }, { 0x44ff65700cd16498u, 0x120d4c2fa8a030fcu },
+    { 0x563f3ecc1005bdbeu, 0x16909f3b92c83d3bu }, { 0x2bcf0e7f14072d2eu, 0x1c34c70a777a4c8au },
+    { 0x5b61690f6c847c3du, 0x11a0fc668aac6fd6u }, { 0xf239c35347a59b4cu, 0x16093b802d578bcbu },
+    { 0xeec83428198f021fu, 0x1b8b8a6038ad6ebeu }, { 0x553d20990ff96153u, 0x1137367c236c6537u },
+    { 0x2a8c68bf53f7b9a8u, 0x1585041b2c477e85u }, { 0x752f82ef28f5a812u, 0x1ae64521f7595e26u },
+    { 0x93db1d57999890bu, 0x10cfeb353a97dad8u }, { 0xb8d1e4ad7ffeb4eu, 0x1503e602893dd18eu },
+    { 0x8e7065dd8dffe622u, 0x1a44df832b8d45f1u }, { 0xf9063faa78bfefd5u, 0x106b0bb1fb384bb6u },
+    { 0xb747cf9516efebcau, 0x1485ce9e7a065ea4u }, { 0xe519c37a5cabe6bdu, 0x19a742461887f64du },
+    { 0xaf301a2c79eb7036u, 0x1008896bcf54f9f0u }, { 0xdafc20b798664c43u, 0x140aabc6c32a386cu },
+    { 0x11bb28e57e7fdf54u, 0x190d56b873f4c688u }, { 0x1629f31ede1fd72au, 0x1f50ac6690f1f82au },
+    { 0x4dda37f34ad3e67au, 0x13926bc01a973b1au }, { 0xe150c5f01d88e019u, 0x187706b0213d09e0u },
+    { 0x19a4f76c24eb181fu, 0x1e94c85c298c4c59u }, { 0xb0071aa39712ef13u, 0x131cfd3999f7afb7u },
+    { 0x9c08e14c7cd7aad8u, 0x17e43c8800759ba5u }, { 0x30b199f9c0d958eu, 0x1ddd4baa0093028fu },
+    { 0x61e6f003c1887d79u, 0x12aa4f4a405be199u }, { 0xba60ac04b1ea9cd7u, 0x1754e31cd072d9ffu },
+    { 0xa8f8d705de65440du, 0x1d2a1be4048f907fu }, { 0xc99b8663aaff4a88u, 0x123a516e82d9ba4fu },
+    { 0xbc0267fc95bf1d2au, 0x16c8e5ca239028e3u }, { 0xab0301fbbb2ee474u, 0x1c7b1f3cac74331cu },
+    { 0xeae1e13d54fd4ec9u, 0x11ccf385ebc89ff1u }, { 0x659a598caa3ca27bu, 0x1640306766bac7eeu },
+    { 0xff00efefd4cbcb1au, 0x1bd03c81406979e9u }, { 0x3f6095f5e4ff5ef0u, 0x116225d0c841ec32u },
+    { 0xcf38bb735e3f36acu, 0x15baaf44fa52673eu }, { 0x8306ea5035cf0457u, 0x1b295b1638e7010eu },
+    { 0x11e4527221a162b6u, 0x10f9d8ede39060a9u }, { 0x565d670eaa09bb64u, 0x15384f295c7478d3u },
+    { 0x2bf4c0d2548c2a3du, 0x1a8662f3b3919708u }, { 0x1b78f88374d79a66u, 0x1093fdd8503afe65u },
+    { 0x625736a4520d8100u, 0x14b8fd4e6449bdfeu }, { 0xfaed044d6690e140u, 0x19e73ca1fd5c2d7du },
+    { 0xbcd422b0601a8cc8u, 0x103085e53e599c6eu }, { 0x6c092b5c78212ffau, 0x143ca75e8df0038au },
+    { 0x70b763396297bf8u, 0x194bd136316c046du }, { 0x48ce53c07bb3daf6u, 0x1f9ec583bdc70588u },
+    { 0x2d80f4584d5068dau, 0x13c33b72569c6375u }, { 0x78e1316e60a48310u, 0x18b40a4eec437c52u }
+};
+
+static const uint64_t neat_f2s_pow5_inv_split[31] = {
+    0x800000000000001u, 0x666666666666667u, 0x51eb851eb851eb9u,
+    0x4189374bc6a7efau, 0x68db8bac710cb2au, 0x53e2d6238da3c22u,
+    0x431bde82d7b634eu, 0x6b5fca6af2bd216u, 0x55e63b88c230e78u,
+    0x44b82fa09b5a52du, 0x6df37f675ef6eaeu, 0x57f5ff85e592558u,
+    0x465e6604b7a8447u, 0x709709a125da071u, 0x5a126e1a84ae6c1u,
+    0x480ebe7b9d58567u, 0x734aca5f6226f0bu, 0x5c3bd5191b525a3u,
+    0x49c97747490eae9u, 0x760f253edb4ab0eu, 0x5e72843249088d8u,
+    0x4b8ed0283a6d3e0u, 0x78e480405d7b966u, 0x60b6cd004ac9452u,
+    0x4d5f0a66a23a9dbu, 0x7bcb43d769f762bu, 0x63090312bb2c4efu,
+    0x4f3a68dbc8f03f3u, 0x7ec3daf94180651u, 0x65697bfa9acd1dau,
+    0x51212ffbaf0a7e2u
+};
+
+static const uint64_t neat_f2s_pow5_split[48] = {
+    0x1000000000000000u, 0x1400000000000000u, 0x1900000000000000u,
+    0x1f40000000000000u, 0x1388000000000000u, 0x186a000000000000u,
+    0x1e84800000000000u, 0x1312d00000000000u, 0x17d7840000000000u,
+    0x1dcd650000000000u, 0x12a05f2000000000u, 0x174876e800000000u,
+    0x1d1a94a200000000u, 0x12309ce540000000u, 0x16bcc41e90000000u,
+    0x1c6bf52634000000u, 0x11c37937e0800000u, 0x16345785d8a00000u,
+    0x1bc16d674ec80000u, 0x1158e460913d0000u, 0x15af1d78b58c4000u,
+    0x1b1ae4d6e2ef5000u, 0x10f0cf064dd59200u, 0x152d02c7e14af680u,
+    0x1a784379d99db420u, 0x108b2a2c28029094u, 0x14adf4b7320334b9u,
+    0x19d971e4fe8401e7u, 0x1027e72f1f128130u, 0x1431e0fae6d7217cu,
+    0x193e5939a08ce9dbu, 0x1f8def8808b02452u, 0x13b8b5b5056e16b3u,
+    0x18a6e32246c99c60u, 0x1ed09bead87c0378u, 0x13426172c74d822bu,
+    0x1812f9cf7920e2b6u, 0x1e17b84357691b64u, 0x12ced32a16a1b11eu,
+    0x178287f49c4a1d66u, 0x1d6329f1c35ca4bfu, 0x125dfa371a19e6f7u,
+    0x16f578c4e0a060b5u, 0x1cb2d6f618c878e3u, 0x11efc659cf7d4b8du,
+    0x166bb7f0435c9e71u, 0x1c06a5ec5433c60du, 0x118427b3b4a05bc8u
+};
+
+static inline uint32_t neat_ryu_pow5bits(int32_t e)
+{
+    // ceil(log2(5^e)) for e > 0, 1 for e == 0
+    return (uint32_t) (((e * 1217359) >> 19) + 1);
+}
+
+static inline uint32_t neat_ryu_log10_pow2(int32_t e)
+{
+    return (uint32_t) ((e * 78913) >> 18);
+}
+
+static inline uint32_t neat_ryu_log10_pow5(int32_t e)
+{
+    return (uint32_t) ((e * 732923) >> 20);
+}
+
+static inline uint32_t neat_ryu_pow5_factor(uint64_t v)
+{
+    uint32_t count = 0;
+    while(v % 5 == 0)
+    {
+        v /= 5;
+        count++;
+    }
+    return count;
+}
+
+static inline bool neat_ryu_multiple_of_pow5(uint64_t v, uint32_t p)
+{
+    return neat_ryu_pow5_factor(v) >= p;
+}
+
+static inline bool neat_ryu_multiple_of_pow2(uint64_t v, uint32_t p)
+{
+    return (v & ((1ull << p) - 1)) == 0;
+}
+
+// (m * mul) >> j, where mul is a 128 bit number stored as { low, high } and 64 < j < 128
+static inline uint64_t neat_ryu_mul_shift64(uint64_t m, const uint64_t *mul, int32_t j)
+{
+#ifdef __SIZEOF_INT128__
+    unsigned __int128 b0 = (unsigned __int128) m * mul[0];
+    unsigned __int128 b2 = (unsigned __int128) m * mul[1];
+    return (uint64_t) (((b0 >> 64) + b2) >> (j - 64));
+#else
+    uint64_t m_lo = (uint32_t) m, m_hi = m >> 32;
+    uint64_t hi[2], lo[2];
+    for(int k = 0 ; k < 2 ; k++)
+    {
+        uint64_t a_lo = (uint32_t) mul[k], a_hi = mul[k] >> 32;
+        uint64_t b00 = m_lo * a_lo, b01 = m_lo * a_hi;
+        uint64_t b10 = m_hi * a_lo, b11 = m_hi * a_hi;
+        uint64_t mid = (b00 >> 32) + (uint32_t) b01 + (uint32_t) b10;
+        lo[k] = (mid << 32) | (uint32_t) b00;
+        hi[k] = b11 + (b01 >> 32) + (b10 >> 32) + (mid >> 32);
+    }
+    uint64_t sum = hi[0] + lo[1];
+    uint64_t high = hi[1] + (sum < hi[0]);
+    int32_t dist = j - 64;
+    return (high << (64 - dist)) | (sum >> dist);
+#endif
+}
+
+static inline uint32_t neat_ryu_mul_shift32(uint32_t m, uint64_t factor, int32_t shift)
+{
+    uint64_t bits0 = (uint64_t) m * (uint32_t) factor;
+    uint64_t bits1 = (uint64_t) m * (factor >> 32);
+    return (uint32_t) (((bits0 >> 32) + bits1) >> (shift - 32));
+}
+
+static void neat_d2d(uint64_t ieee_mantissa, uint32_t ieee_exponent, uint64_t *out_m, int32_t *out_e)
+{
+    int32_t e2;
+    uint64_t m2;
+    if(ieee_exponent == 0)
+    {
+        e2 = 1 - 1023 - 52 - 2;
+        m2 = ieee_mantissa;
+    }
+    else
+    {
+        e2 = (int32_t) ieee_exponent - 1023 - 52 - 2;
+        m2 = (1ull << 52) | ieee_mantissa;
+    }
+    
+    // the halfway points between this value and its neighbours are (mv - 2 or 1, mv + 2) / 4 * 2^e2
+    bool accept_bounds = (m2 & 1) == 0;
+    uint64_t mv = 4 * m2;
+    uint32_t mm_shift = ieee_mantissa != 0 || ieee_exponent <= 1;
+    
+    uint64_t vr, vp, vm;
+    int32_t e10;
+    bool vm_trailing_zeros = false, vr_trailing_zeros = false;
+    
+    if(e2 >= 0)
+    {
+        uint32_t q = neat_ryu_log10_pow2(e2) - (e2 > 3);
+        e10 = (int32_t) q;
+        int32_t k = 125 + (int32_t) neat_ryu_pow5bits((int32_t) q) - 1;
+        int32_t i = -e2 + (int32_t) q + k;
+        const uint64_t *mul = neat_d2s_pow5_inv_split[q];
+        vr = neat_ryu_mul_shift64(4 * m2, mul, i);
+        vp = neat_ryu_mul_shift64(4 * m2 + 2, mul, i);
+        vm = neat_ryu_mul_shift64(4 * m2 - 1 - mm_shift, mul, i);
+        if(q <= 21)
+        {
+            // only one of mp, mv, and mm can be a multiple of 5, if any.
+            if(mv % 5 == 0)
+                vr_trailing_zeros = neat_ryu_multiple_of_pow5(mv, q);
+            else if(accept_bounds)
+                vm_trailing_zeros = neat_ryu_multiple_of_pow5(mv - 1 - mm_shift, q);
+            else
+                vp -= neat_ryu_multiple_of_pow5(mv + 2, q);
+        }
+    }
+    else
+    {
+        uint32_t q = neat_ryu_log10_pow5(-e2) - (-e2 > 1);
+        e10 = (int32_t) q + e2;
+        int32_t i = -e2 - (int32_t) q;
+        int32_t k = (int32_t) neat_ryu_pow5bits(i) - 125;
+        int32_t j = (int32_t) q - k;
+        const uint64_t *mul = neat_d2s_pow5_split[i];
+        vr = neat_ryu_mul_shift64(4 * m2, mul, j);
+        vp = neat_ryu_mul_shift64(4 * m2 + 2, mul, j);
+        vm = neat_ryu_mul_shift64(4 * m2 - 1 - mm_shift, mul, j);
+        if(q <= 1)
+        {
+            // mv = 4 * m2 always has at least two trailing 0 bits.
+            vr_trailing_zeros = true;
+            if(accept_bounds)
+                vm_trailing_zeros = mm_shift == 1;
+            else
+                --vp;
+        }
+        else if(q < 63)
+        {
+            vr_trailing_zeros = neat_ryu_multiple_of_pow2(mv, q);
+        }
+    }
+    
+    // drop digits while the interval [vm, vp] still holds a shorter number
+    int32_t removed = 0;
+    uint8_t last_removed = 0;
+    uint64_t output;
+    if(vm_trailing_zeros || vr_trailing_zeros)
+    {
+        // rare case, the exact value might be a tie
+        while(vp / 10 > vm / 10)
+        {
+            vm_trailing_zeros &= vm % 10 == 0;
+            vr_trailing_zeros &= last_removed == 0;
+            last_removed = (uint8_t) (vr % 10);
+            vr /= 10; vp /= 10; vm /= 10;
+            removed++;
+        }
+        if(vm_trailing_zeros)
+        {
+            while(vm % 10 == 0)
+            {
+                vr_trailing_zeros &= last_removed == 0;
+                last_removed = (uint8_t) (vr % 10);
+                vr /= 10; vp /= 10; vm /= 10;
+                removed++;
+            }
+        }
+        // round to even if the exact value is .....50..0
+        if(vr_trailing_zeros && last_removed == 5 && vr % 2 == 0)
+            last_removed = 4;
+        output = vr + ((vr == vm && (!accept_bounds || !vm_trailing_zeros)) || last_removed >= 5);
+    }
+    else
+    {
+        bool round_up = false;
+        if(vp / 100 > vm / 100)
+        {
+            round_up = vr % 100 >= 50;
+            vr /= 100; vp /= 100; vm /= 100;
+            removed += 2;
+        }
+        while(vp / 10 > vm / 10)
+        {
+            round_up = vr % 10 >= 5;
+            vr /= 10; vp /= 10; vm /= 10;
+            removed++;
+        }
+        output = vr + (vr == vm || round_up);
+    }
+    
+    *out_m = output;
+    *out_e = e10 + removed;
+}
+
+static void neat_f2d(uint32_t ieee_mantissa, uint32_t ieee_exponent, uint64_t *out_m, int32_t *out_e)
+{
+    int32_t e2;
+    uint32_t m2;
+    if(ieee_exponent == 0)
+    {
+        e2 = 1 - 127 - 23 - 2;
+        m2 = ieee_mantissa;
+    }
+    else
+    {
+        e2 = (int32_t) ieee_exponent - 127 - 23 - 2;
+        m2 = (1u << 23) | ieee_mantissa;
+    }
+    
+    bool accept_bounds = (m2 & 1) == 0;
+    uint32_t mv = 4 * m2;
+    uint32_t mp = 4 * m2 + 2;
+    uint32_t mm_shift = ieee_mantissa != 0 || ieee_exponent <= 1;
+    uint32_t mm = 4 * m2 - 1 - mm_shift;
+    
+    uint32_t vr, vp, vm;
+    int32_t e10;
+    bool vm_trailing_zeros = false, vr_trailing_zeros = false;
+    uint8_t last_removed = 0;
+    
+    if(e2 >= 0)
+    {
+        uint32_t q = neat_ryu_log10_pow2(e2);
+        e10 = (int32_t) q;
+        int32_t k = 59 + (int32_t) neat_ryu_pow5bits((int32_t) q) - 1;
+        int32_t i = -e2 + (int32_t) q + k;
+        uint64_t mul = neat_f2s_pow5_inv_split[q];
+        vr = neat_ryu_mul_shift32(mv, mul, i);
+        vp = neat_ryu_mul_shift32(mp, mul, i);
+        vm = neat_ryu_mul_shift32(mm, mul, i);
+        if(q != 0 && (vp - 1) / 10 <= vm / 10)
+        {
+            // the loop below won't run, but the last removed digit is still needed for rounding
+            int32_t l = 59 + (int32_t) neat_ryu_pow5bits((int32_t) q - 1) - 1;
+            last_removed = (uint8_t) (neat_ryu_mul_shift32(mv, neat_f2s_pow5_inv_split[q - 1], -e2 + (int32_t) q - 1 + l) % 10);
+        }
+        if(q <= 9)
+        {
+            if(mv % 5 == 0)
+                vr_trailing_zeros = neat_ryu_multiple_of_pow5(mv, q);
+            else if(accept_bounds)
+                vm_trailing_zeros = neat_ryu_multiple_of_pow5(mm, q);
+            else
+                vp -= neat_ryu_multiple_of_pow5(mp, q);
+        }
+    }
+    else
+    {
+        uint32_t q = neat_ryu_log10_pow5(-e2);
+        e10 = (int32_t) q + e2;
+        int32_t i = -e2 - (int32_t) q;
+        int32_t k = (int32_t) neat_ryu_pow5bits(i) - 61;
+        int32_t j = (int32_t) q - k;
+        uint64_t mul = neat_f2s_pow5_split[i];
+        vr = neat_ryu_mul_shift32(mv, mul, j);
+        vp = neat_ryu_mul_shift32(mp, mul, j);
+        vm = neat_ryu_mul_shift32(mm, mul, j);
+        if(q != 0 && (vp - 1) / 10 <= vm / 10)
+        {
+            j = (int32_t) q - 1 - ((int32_t) neat_ryu_pow5bits(i + 1) - 61);
+            last_removed = (uint8_t) (neat_ryu_mul_shift32(mv, neat_f2s_pow5_split[i + 1], j) % 10);
+        }
+        if(q <= 1)
+        {
+            vr_trailing_zeros = true;
+            if(accept_bounds)
+                vm_trailing_zeros = mm_shift == 1;
+            else
+                --vp;
+        }
+        else if(q < 31)
+        {
+            vr_trailing_zeros = neat_ryu_multiple_of_pow2(mv, q - 1);
+        }
+    }
+    
+    int32_t removed = 0;
+    uint32_t output;
+    if(vm_trailing_zeros || vr_trailing_zeros)
+    {
+        while(vp / 10 > vm / 10)
+        {
+            vm_trailing_zeros &= vm % 10 == 0;
+            vr_trailing_zeros &= last_removed == 0;
+            last_removed = (uint8_t) (vr % 10);
+            vr /= 10; vp /= 10; vm /= 10;
+            removed++;
+        }
+        if(vm_trailing_zeros)
+        {
+            while(vm % 10 == 0)
+            {
+                vr_trailing_zeros &= last_removed == 0;
+                last_removed = (uint8_t) (vr % 10);
+                vr /= 10; vp /= 10; vm /= 10;
+                removed++;
+            }
+        }
+        if(vr_trailing_zeros && last_removed == 5 && vr % 2 == 0)
+            last_removed = 4;
+        output = vr + ((vr == vm && (!accept_bounds || !vm_trailing_zeros)) || last_removed >= 5);
+    }
+    else
+    {
+        while(vp / 10 > vm / 10)
+        {
+            last_removed = (uint8_t) (vr % 10);
+            vr /= 10; vp /= 10; vm /= 10;
+            removed++;
+        }
+        output = vr + (vr == vm || last_removed >= 5);
+    }
+    
+    *out_m = output;
+    *out_e = e10 + removed;
+}
+
+/*
+    Lays out digits * 10^e10 like %g would, but with as many digits as
+    needed: plain notation when the decimal exponent is in [-4, 16),
+    scientific (1.5e+20, 1e-07) otherwise.
+*/
+static size_t neat_format_decimal(char *out, bool sign, uint64_t digits, int32_t e10)
+{
+    char *p = out;
+    if(sign) *p++ = '-';
+    
+    char d[NEAT_INT_MAX_CHARS];
+    int32_t len = (int32_t) neat_u64_to_dec(d, digits);
+    int32_t exp = e10 + len - 1;
+    
+    if(exp >= -4 && exp < 16)
+    {
+        if(exp < 0)
+        {
+            *p++ = '0';
+            *p++ = '.';
+            for(int32_t i = -1 ; i > exp ; i--) *p++ = '0';
+            memcpy(p, d, len); p += len;
+        }
+        else if(exp >= len - 1)
+        {
+            memcpy(p, d, len); p += len;
+            for(int32_t i = len - 1 ; i < exp ; i++) *p++ = '0';
+        }
+        else
+        {
+            memcpy(p, d, exp + 1); p += exp + 1;
+            *p++ = '.';
+            memcpy(p, d + exp + 1, len - exp - 1); p += len - exp - 1;
+        }
+    }
+    else
+    {
+        *p++ = d[0];
+        if(len > 1)
+        {
+            *p++ = '.';
+            memcpy(p, d + 1, len - 1); p += len - 1;
+        }
+        *p++ = 'e';
+        *p++ = exp < 0 ? '-' : '+';
+        uint32_t ae = exp < 0 ? (uint32_t) -exp : (uint32_t) exp;
+        if(ae >= 100)
+        {
+            *p++ = (char) ('0' + ae / 100);
+            ae %= 100;
+        }
+        *p++ = neat_digit_pairs[ae * 2];
+        *p++ = neat_digit_pairs[ae * 2 + 1];
+    }
+    return (size_t) (p - out);
+}
+
+static size_t neat_format_special(char *out, bool sign, bool nan)
+{
+    char *p = out;
+    if(sign) *p++ = '-';
+    memcpy(p, nan ? "nan" : "inf", 3);
+    return (size_t) (p - out) + 3;
+}
+
+size_t neat_double_to_shortest(char *out, double v)
+{
+    uint64_t bits;
+    memcpy(&bits, &v, sizeof(bits));
+    bool sign = bits >> 63;
+    uint64_t ieee_mantissa = bits & ((1ull << 52) - 1);
+    uint32_t ieee_exponent = (uint32_t) ((bits >> 52) & 0x7ff);
+    
+    if(ieee_exponent == 0x7ff)
+        return neat_format_special(out, sign, ieee_mantissa != 0);
+    if(ieee_exponent == 0 && ieee_mantissa == 0)
+    {
+        char *p = out;
+        if(sign) *p++ = '-';
+        *p++ = '0';
+        return (size_t) (p - out);
+    }
+    
+    uint64_t digits;
+    int32_t e10;
+    
+    // integers below 2^53 are already exact, only their trailing zeros need removing
+    uint64_t m2 = (1ull << 52) | ieee_mantissa;
+    int32_t e2 = (int32_t) ieee_exponent - 1023 - 52;
+    if(e2 <= 0 && e2 >= -52 && (m2 & ((1ull << -e2) - 1)) == 0)
+    {
+        digits = m2 >> -e2;
+        e10 = 0;
+        while(digits % 10 == 0)
+        {
+            digits /= 10;
+            e10++;
+        }
+    }
+    else
+    {
+        neat_d2d(ieee_mantissa, ieee_exponent, &digits, &e10);
+    }
+    
+    return neat_format_decimal(out, sign, digits, e10);
+}
+
+size_t neat_float_to_shortest(char *out, float v)
+{
+    uint32_t bits;
+    memcpy(&bits, &v, sizeof(bits));
+    bool sign = bits >> 31;
+    uint32_t ieee_mantissa = bits & ((1u << 23) - 1);
+    uint32_t ieee_exponent = (bits >> 23) & 0xff;
+    
+    if(ieee_exponent == 0xff)
+        return neat_format_special(out, sign, ieee_mantissa != 0);
+    if(ieee_exponent == 0 && ieee_mantissa == 0)
+    {
+        char *p = out;
+        if(sign) *p++ = '-';
+        *p++ = '0';
+        return (size_t) (p - out);
+    }
+    
+    uint64_t digits;
+    int32_t e10;
+    neat_f2d(ieee_mantissa, ieee_exponent, &digits, &e10);
+    return neat_format_decimal(out, sign, digits, e10);
+}
+
+static inline size_t neat_fmt_float(char *out, float v)
+{
+#ifdef NEAT_TOSTR_FLOAT_G
+    return (size_t) snprintf(out, NEAT_FLOAT_MAX_CHARS, "%g", v);
+#else
+    return neat_float_to_shortest(out, v);
+#endif
+}
+
+static inline size_t neat_fmt_double(char *out, double v)
+{
+#ifdef NEAT_TOSTR_FLOAT_G
+    return (size_t) snprintf(out, NEAT_FLOAT_MAX_CHARS, "%g", v);
+#else
+    return neat_double_to_shortest(out, v);
+#endif
+}
+
+// writer
+
+neat_writer neat_writer_file(FILE *file, char *buf, size_t cap)
+{
+    return (neat_writer){ .buf = buf, .cap = cap, .file = file, .fd = -1 };
+}
+
+neat_writer neat_writer_fd(int fd, char *buf, size_t cap)
+{
+    return (neat_writer){ .buf = buf, .cap = cap, .file = NULL, .fd = fd };
+}
+
+#ifdef NEAT_TOSTR_ASYNC
+static bool neat_async_push(neat_writer *w, const char *str, size_t len);
+#endif
+
+// writes all of str to file, or to fd if file is NULL. Returns false on error.
+static bool neat_write_all(FILE *file, int fd, const char *str, size_t len)
+{
+    if(file)
+        return fwrite(str, 1, len, file) == len;
+    
+    while(len > 0)
+    {
+        long n = (long) neat_sys_write(fd, str, len);
+        if(n <= 0) return false;
+        str += n;
+        len -= (size_t) n;
+    }
+    return true;
+}
+
+static void neat_writer_sink(neat_writer *w, const char *str, size_t len)
+{
+#ifdef NEAT_TOSTR_ASYNC
+    if(neat_async_push(w, str, len)) return;
+#endif
+    
+    if(!neat_write_all(w->file, w->fd, str, len)) w->error = true;
+}
+
+void neat_writer_flush(neat_writer *w)
+{
+    if(w->len > 0) neat_writer_sink(w, w->buf, w->len);
+    w->len = 0;
+}
+
+void neat_writer_write(neat_writer *w, const char *str, size_t len)
+{
+    if(len == 0) return;
+    if(len <= w->cap - w->len)
+    {
+        memcpy(w->buf + w->len, str, len);
+        w->len += len;
+        return;
+    }
+    
+    neat_writer_flush(w);
+    if(len < w->cap)
+    {
+        memcpy(w->buf, str, len);
+        w->len = len;
+    }
+    else
+    {
+        // too big to be worth copying
+        neat_writer_sink(w, str, len);
+    }
+}
+
+// len must be at most cap
+char *neat_writer_reserve(neat_writer *w, size_t len)
+{
+    if(len > w->cap - w->len) neat_writer_flush(w);
+    return w->buf + w->len;
+}
+
+// where to format up to len chars: in buf, or in tmp when buf is too small to ever hold them
+static inline char *neat_writer_room(neat_writer *w, size_t len, char *tmp)
+{
+    return len <= w->cap ? neat_writer_reserve(w, len) : tmp;
+}
+
+// takes the len chars formatted at out, which neat_writer_room returned
+static inline void neat_writer_commit(neat_writer *w, const char *out, size_t len)
+{
+    if(out == w->buf + w->len) w->len += len;
+    else                       neat_writer_write(w, out, len);
+}
+
+void neat_writer_put_str(neat_writer *w, const char *str)
+{
+    neat_writer_write(w, str, strlen(str));
+}
+
+void neat_writer_put_bool(neat_writer *w, bool b)
+{
+    if(b) neat_writer_write(w, "true", 4);
+    else  neat_writer_write(w, "false", 5);
+}
+
+void neat_writer_put_i64(neat_writer *w, int64_t v)
+{
+    char tmp[NEAT_INT_MAX_CHARS];
+    char *out = neat_writer_room(w, NEAT_INT_MAX_CHARS, tmp);
+    neat_writer_commit(w, out, neat_i64_to_dec(out, v));
+}
+
+void neat_writer_put_u64(neat_writer *w, uint64_t v)
+{
+    char tmp[NEAT_INT_MAX_CHARS];
+    char *out = neat_writer_room(w, NEAT_INT_MAX_CHARS, tmp);
+    neat_writer_commit(w, out, neat_u64_to_dec(out, v));
+}
+
+void neat_writer_put_float(neat_writer *w, float v)
+{
+    char tmp[NEAT_FLOAT_MAX_CHARS];
+    char *out = neat_writer_room(w, NEAT_FLOAT_MAX_CHARS, tmp);
+    neat_writer_commit(w, out, neat_fmt_float(out, v));
+}
+
+void neat_writer_put_double(neat_writer *w, double v)
+{
+    char tmp[NEAT_FLOAT_MAX_CHARS];
+    char *out = neat_writer_room(w, NEAT_FLOAT_MAX_CHARS, tmp);
+    neat_writer_commit(w, out, neat_fmt_double(out, v));
+}
+
+void neat_writer_put_strfn(neat_writer *w, neat_strfn fn, void *obj)
+{
+    if(fn.tochars)
+    {
+        // try the space that's left, then an empty buffer
+        size_t room = w->cap - w->len;
+        size_t len = fn.tochars(w->buf + w->len, room, obj);
+        if(len < room)
+        {
+            w->len += len;
+            return;
+        }
+        neat_writer_flush(w);
+        if(len < w->cap)
+        {
+            fn.tochars(w->buf, w->cap, obj);
+            w->len = len;
+            return;
+        }
+    }
+    
+    char *str = neat_strfn_to_string(fn, obj);
+    neat_writer_put_str(w, str);
+    free(str);
+}
+
+void neat_wprint_args(neat_writer *w, const neat_print_arg *args, size_t n)
+{
+    for(size_t i = 0 ; i < n ; i++)
+    {
+        const void *obj = args[i].obj;
+        switch(args[i].kind)
+        {
+            case NEAT_PRINT_STR:    neat_writer_put_str(w, obj); break;
+            case NEAT_PRINT_CHAR:   neat_writer_put_char(w, *(const char*) obj); break;
+            case NEAT_PRINT_BOOL:   neat_writer_put_bool(w, *(const bool*) obj); break;
+            case NEAT_PRINT_I8:     neat_writer_put_i64(w, *(const int8_t*) obj); break;
+            case NEAT_PRINT_I16:    neat_writer_put_i64(w, *(const int16_t*) obj); break;
+            case NEAT_PRINT_I32:    neat_writer_put_i64(w, *(const int32_t*) obj); break;
+            case NEAT_PRINT_I64:    neat_writer_put_i64(w, *(const int64_t*) obj); break;
+            case NEAT_PRINT_U8:     neat_writer_put_u64(w, *(const uint8_t*) obj); break;
+            case NEAT_PRINT_U16:    neat_writer_put_u64(w, *(const uint16_t*) obj); break;
+            case NEAT_PRINT_U32:    neat_writer_put_u64(w, *(const uint32_t*) obj); break;
+            case NEAT_PRINT_U64:    neat_writer_put_u64(w, *(const uint64_t*) obj); break;
+            case NEAT_PRINT_FLOAT:  neat_writer_put_float(w, *(const float*) obj); break;
+            case NEAT_PRINT_DOUBLE: neat_writer_put_double(w, *(const double*) obj); break;
+            case NEAT_PRINT_STRFN:  neat_writer_put_strfn(w, args[i].fn, (void*) obj); break;
+        }
+    }
+}
+
+// quoted strings
+
+// the longest escape, "\u001f"
+#define NEAT_ESCAPE_MAX 6
+
+static inline bool neat_needs_escape(char c)
+{
+    return (unsigned char) c < 0x20 || c == '"' || c == '\\';
+}
+
+/*
+    Returns the index of the first char of str that needs escaping, or
+    len. Checks 16 bytes at a time with SSE2 (a byte is below 0x20 when
+    min(byte, 0x1f) is itself), otherwise 8 at a time with the has-less
+    trick, which like in neat_find_sep can only report false positives
+    after a real hit.
+*/
+static inline size_t neat_escape_scan(const char *str, size_t len)
+{
+    size_t i = 0;
+#if defined(__SSE2__)
+    const __m128i quote = _mm_set1_epi8('"');
+    const __m128i bslash = _mm_set1_epi8('\\');
+    const __m128i ctrl = _mm_set1_epi8(0x1f);
+    for( ; len - i >= 16 ; i += 16)
+    {
+        __m128i v = _mm_loadu_si128((const __m128i *) (str + i));
+        __m128i hit = _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(v, quote), _mm_cmpeq_epi8(v, bslash)),
+                                   _mm_cmpeq_epi8(_mm_min_epu8(v, ctrl), v));
+        unsigned mask = (unsigned) _mm_movemask_epi8(hit);
+        if(mask)
+            return i + __builtin_ctz(mask);
+    }
+#else
+    const uint64_t ones = 0x0101010101010101ull;
+    const uint64_t quote = ones * '"';
+    const uint64_t bslash = ones * '\\';
+    for( ; len - i >= 8 ; i += 8)
+    {
+        uint64_t v;
+        memcpy(&v, str + i, 8);
+        uint64_t x = v ^ quote, y = v ^ bslash;
+        if((((x - ones) & ~x) | ((y - ones) & ~y) | ((v - ones * 0x20) & ~v)) & (ones << 7))
+            break;
+    }
+#endif
+    while(i < len && !neat_needs_escape(str[i])) i++;
+    return i;
+}
+
+// writes the escape of c, one that neat_needs_escape is true for, and returns its length
+static inline size_t neat_escape_char(char *out, char c)
+{
+    static const char hex[] = "0123456789abcdef";
+    out[0] = '\\';
+    switch(c)
+    {
+        case '"':  out[1] = '"';  return 2;
+        case '\\': out[1] = '\\'; return 2;
+        case '\b': out[1] = 'b';  return 2;
+        case '\f': out[1] = 'f';  return 2;
+        case '\n': out[1] = 'n';  return 2;
+        case '\r': out[1] = 'r';  return 2;
+        case '\t': out[1] = 't';  return 2;
+        default:
+            memcpy(out + 1, "u00", 3);
+            out[4] = hex[(unsigned char) c >> 4];
+            out[5] = hex[(unsigned char) c & 0xf];
+            return 6;
+    }
+}
+
+// the runs between escapes are written with neat_writer_write, so long ones go straight to the sink
+void neat_writer_put_quoted(neat_writer *w, const char *str, size_t len)
+{
+    neat_writer_put_char(w, '"');
+    size_t i = 0;
+    while(i < len)
+    {
+        size_t run = neat_escape_scan(str + i, len - i);
+        if(run > 0) neat_writer_write(w, str + i, run);
+        i += run;
+        if(i == len) break;
+        
+        char tmp[NEAT_ESCAPE_MAX];
+        char *out = neat_writer_room(w, NEAT_ESCAPE_MAX, tmp);
+        neat_writer_commit(w, out, neat_escape_char(out, str[i++]));
+    }
+    neat_writer_put_char(w, '"');
+}
+
+void neat_wprint_args_quoted(neat_writer *w, const neat_print_arg *args, size_t n)
+{
+    for(size_t i = 0 ; i < n ; i++)
+    {
+        if(args[i].kind == NEAT_PRINT_STR)
+            neat_writer_put_quoted(w, args[i].obj, strlen(args[i].obj));
+        else if(args[i].kind == NEAT_PRINT_CHAR)
+            neat_writer_put_quoted(w, args[i].obj, 1);
+        else
+            neat_wprint_args(w, &args[i], 1);
+    }
+}
+
+// batch array formatting
+
+// the most an element's kernel stores: a fixed precision double near DBL_MAX, plus the 16 byte digit stores past the end
+#define NEAT_BATCH_ELM_MAX 352
+
+#if defined(__SSE2__)
+
+/*
+    The 8 decimal digits of v < 10^8, as 16-bit lanes with the most
+    significant first (W. Mula's method). v is split into 4 digit halves,
+    each is broadcast to 4 lanes and divided by 1000, 100, 10 and 1 with
+    multiply-highs, then the digit above each lane is subtracted out.
+*/
+static inline __m128i neat_digits8_sse2(uint32_t v)
+{
+    const __m128i div10000 = _mm_set1_epi32((int) 0xd1b71759);
+    const __m128i mul10000 = _mm_set1_epi32(10000);
+    const __m128i div_powers = _mm_setr_epi16(8389, 5243, 13108, (short) 32768, 8389, 5243, 13108, (short) 32768);
+    const __m128i shift_powers = _mm_setr_epi16(1 << 7, 1 << 11, 1 << 13, (short) (1 << 15), 1 << 7, 1 << 11, 1 << 13, (short) (1 << 15));
+    
+    __m128i abcdefgh = _mm_cvtsi32_si128((int) v);
+    __m128i abcd = _mm_srli_epi64(_mm_mul_epu32(abcdefgh, div10000), 45);
+    __m128i efgh = _mm_sub_epi32(abcdefgh, _mm_mul_epu32(abcd, mul10000));
+    
+    __m128i v1 = _mm_slli_epi64(_mm_unpacklo_epi16(abcd, efgh), 2);
+    __m128i v2 = _mm_unpacklo_epi16(v1, v1);
+    v2 = _mm_unpacklo_epi32(v2, v2); // abcd*4 x4, efgh*4 x4
+    
+    __m128i prefixes = _mm_mulhi_epu16(_mm_mulhi_epu16(v2, div_powers), shift_powers); // a, ab, abc, abcd, e, ef, efg, efgh
+    __m128i tens = _mm_slli_epi64(_mm_mullo_epi16(prefixes, _mm_set1_epi16(10)), 16);  // 0, a0, ab0, abc0, 0, e0, ef0, efg0
+    return _mm_sub_epi16(prefixes, tens);
+}
+
+// writes the last len (1 to 16) digits of v < 10^16 padded with zeros. Always stores 16 bytes.
+static inline void neat_put_digits16(char *out, uint64_t v, size_t len)
+{
+    const __m128i zeros = _mm_set1_epi8('0');
+    uint64_t chars[2];
+    if(len <= 8)
+    {
+        __m128i d = neat_digits8_sse2((uint32_t) v);
+        _mm_storeu_si128((__m128i*) chars, _mm_add_epi8(_mm_packus_epi16(d, d), zeros));
+        chars[0] >>= 8 * (8 - len); // the chars are little endian, this drops the leading ones
+        memcpy(out, chars, 8);
+    }
+    else
+    {
+        __m128i hi = neat_digits8_sse2((uint32_t) (v / 100000000));
+        __m128i lo = neat_digits8_sse2((uint32_t) (v % 100000000));
+        _mm_storeu_si128((__m128i*) chars, _mm_add_epi8(_mm_packus_epi16(hi, lo), zeros));
+        unsigned shift = 8 * (unsigned) (16 - len);
+        if(shift)
+        {
+            chars[0] = (chars[0] >> shift) | (chars[1] << (64 - shift));
+            chars[1] >>= shift;
+        }
+        memcpy(out, chars, 16);
+    }
+}
+
+#else
+
+static inline void neat_put_digits16(char *out, uint64_t v, size_t len)
+{
+    char *p = out + len;
+    for(size_t i = 0 ; i + 1 < len ; i += 2)
+    {
+        const char *d = neat_digit_pairs + (v % 100) * 2;
+        v /= 100;
+        *--p = d[1];
+        *--p = d[0];
+    }
+    if(len & 1) *--p = (char) ('0' + v % 10);
+}
+
+#endif
+
+static inline size_t neat_batch_u64(char *out, uint64_t v)
+{
+    if(v < 10000000000000000ull)
+    {
+        size_t len = (size_t) neat_count_digits(v);
+        neat_put_digits16(out, v, len);
+        return len;
+    }
+    size_t top = neat_u64_to_dec(out, v / 10000000000000000ull);
+    neat_put_digits16(out + top, v % 10000000000000000ull, 16);
+    return top + 16;
+}
+
+static inline size_t neat_batch_i64(char *out, int64_t v)
+{
+    uint64_t u = (uint64_t) v;
+    if(v < 0)
+    {
+        *out = '-';
+        return 1 + neat_batch_u64(out + 1, 0 - u);
+    }
+    return neat_batch_u64(out, u);
+}
+
+// the rounding error of p = a * b, so a * b == p + err exactly
+static inline double neat_two_product_err(double a, double b, double p)
+{
+#if defined(__GNUC__) && defined(__FMA__)
+    return __builtin_fma(a, b, -p);
+#else
+    // Dekker's product: split both into 26 bit halves whose products are exact
+    double ca = 134217729.0 * a, cb = 134217729.0 * b;
+    double ah = ca - (ca - a), al = a - ah;
+    double bh = cb - (cb - b), bl = b - bh;
+    return ((ah * bh - p) + ah * bl + al * bh) + al * bl;
+#endif
+}
+
+/*
+    v with prec digits after the point, rounded like printf's "%.*f": to
+    nearest, ties to even on the exact binary value. While v * 10^prec
+    fits in 53 bits it's rounded as an integer, using the exact error of
+    the product to settle ties, and written with the digit kernels.
+    Bigger values go through snprintf.
+*/
+static size_t neat_batch_fixed(char *out, double v, int prec)
+{
+    uint64_t bits;
+    memcpy(&bits, &v, sizeof(bits));
+    bool sign = bits >> 63;
+    if(((bits >> 52) & 0x7ff) == 0x7ff)
+        return neat_format_special(out, sign, (bits & ((1ull << 52) - 1)) != 0);
+    
+    double a = sign ? -v : v;
+    double scale = (double) neat_pow10[prec];
+    double p = a * scale;
+    if(!(p < 9007199254740992.0))
+        return (size_t) snprintf(out, NEAT_BATCH_ELM_MAX, "%.*f", prec, v);
+    
+    uint64_t q = (uint64_t) p;
+    double frac = p - (double) q;
+    double err = neat_two_product_err(a, scale, p);
+    if(frac > 0.5 || (frac == 0.5 && (err > 0 || (err == 0 && (q & 1)))))
+        q++;
+    
+    char *o = out;
+    if(sign) *o++ = '-';
+    o += neat_batch_u64(o, q / neat_pow10[prec]);
+    if(prec > 0)
+    {
+        uint64_t f = q % neat_pow10[prec];
+        *o++ = '.';
+        if(prec > 16)
+        {
+            *o++ = (char) ('0' + f / 10000000000000000ull);
+            f %= 10000000000000000ull;
+        }
+        neat_put_digits16(o, f, prec > 16 ? 16 : (size_t) prec);
+        o += prec > 16 ? 16 : prec;
+    }
+    return (size_t) (o - out);
+}
+
+// formats arr[i], storing at most NEAT_BATCH_ELM_MAX bytes at out
+static inline size_t neat_batch_elm(char *out, const void *arr, size_t i, neat_print_kind kind, int prec)
+{
+    switch(kind)
+    {
+        case NEAT_PRINT_I8:     return neat_batch_i64(out, ((const int8_t*) arr)[i]);
+        case NEAT_PRINT_I16:    return neat_batch_i64(out, ((const int16_t*) arr)[i]);
+        case NEAT_PRINT_I32:    return neat_batch_i64(out, ((const int32_t*) arr)[i]);
+        case NEAT_PRINT_I64:    return neat_batch_i64(out, ((const int64_t*) arr)[i]);
+        case NEAT_PRINT_U8:     return neat_batch_u64(out, ((const uint8_t*) arr)[i]);
+        case NEAT_PRINT_U16:    return neat_batch_u64(out, ((const uint16_t*) arr)[i]);
+        case NEAT_PRINT_U32:    return neat_batch_u64(out, ((const uint32_t*) arr)[i]);
+        case NEAT_PRINT_U64:    return neat_batch_u64(out, ((const uint64_t*) arr)[i]);
+        case NEAT_PRINT_FLOAT:
+            return prec < 0 ? neat_fmt_float(out, ((const float*) arr)[i]) : neat_batch_fixed(out, ((const float*) arr)[i], prec);
+        case NEAT_PRINT_DOUBLE:
+            return prec < 0 ? neat_fmt_double(out, ((const double*) arr)[i]) : neat_batch_fixed(out, ((const double*) arr)[i], prec);
+        default:
+            return 0;
+    }
+}
+
+static inline bool neat_batch_kind(neat_print_kind kind)
+{
+    return kind >= NEAT_PRINT_I8 && kind <= NEAT_PRINT_DOUBLE;
+}
+
+// formats arr[*i ..] into out while there's room for one more separator and element, returns the length written
+static size_t neat_batch_fill(char *out, size_t room, const void *arr, size_t n, size_t *i, neat_print_kind kind, const neat_array_fmt *fmt, size_t sep_len)
+{
+    // short separators are stored 16 bytes at a time, the element overwrites the excess
+    char sep16[16] = {0};
+    bool short_sep = sep_len <= sizeof(sep16);
+    if(short_sep) memcpy(sep16, fmt->sep, sep_len);
+    
+    size_t need = sep_len + NEAT_BATCH_ELM_MAX;
+    size_t pos = 0;
+    for( ; *i < n && room - pos >= need ; (*i)++)
+    {
+        if(*i > 0)
+        {
+            if(short_sep) memcpy(out + pos, sep16, sizeof(sep16));
+            else memcpy(out + pos, fmt->sep, sep_len);
+            pos += sep_len;
+        }
+        pos += neat_batch_elm(out + pos, arr, *i, kind, fmt->precision);
+    }
+    return pos;
+}
+
+// copies what fits of str to buf + *pos, keeping a byte for the NUL, and always advances *pos by len
+static inline void neat_put_trunc(char *buf, size_t cap, size_t *pos, const char *str, size_t len)
+{
+    if(*pos + 1 < cap)
+    {
+        size_t room = cap - 1 - *pos;
+        memcpy(buf + *pos, str, len < room ? len : room);
+    }
+    *pos += len;
+}
+
+static inline neat_array_fmt neat_array_fmt_clamp(neat_array_fmt fmt)
+{
+    if(fmt.precision > NEAT_FIXED_MAX_PRECISION) fmt.precision = NEAT_FIXED_MAX_PRECISION;
+    return fmt;
+}
+
+size_t neat_array_to_chars_f(char *buf, size_t cap, const void *arr, size_t n, neat_print_kind kind, neat_array_fmt fmt)
+{
+    fmt = neat_array_fmt_clamp(fmt);
+    size_t sep_len = strlen(fmt.sep);
+    size_t pos = 0;
+    size_t i = 0;
+    
+    neat_put_trunc(buf, cap, &pos, fmt.open, strlen(fmt.open));
+    if(pos < cap)
+        pos += neat_batch_fill(buf + pos, cap - pos, arr, n, &i, kind, &fmt, sep_len);
+    
+    // the ones near the end go through a copy, so they can be cut off
+    for( ; i < n ; i++)
+    {
+        char tmp[NEAT_BATCH_ELM_MAX];
+        if(i > 0) neat_put_trunc(buf, cap, &pos, fmt.sep, sep_len);
+        neat_put_trunc(buf, cap, &pos, tmp, neat_batch_elm(tmp, arr, i, kind, fmt.precision));
+    }
+    
+    neat_put_trunc(buf, cap, &pos, fmt.close, strlen(fmt.close));
+    if(cap > 0) buf[pos < cap ? pos : cap - 1] = '\0';
+    return pos;
+}
+
+// a range of an array that's formatted on its own, into a 'malloc'ed string
+typedef struct neat_array_part
+{
+    const void *arr;
+    size_t lo, hi; // elements [lo, hi), with the separator before lo unless it's the first
+    size_t elm_size;
+    neat_print_kind kind;
+    neat_strfn fn;
+    const neat_array_fmt *fmt;
+    char *str;
+    size_t len;
+    size_t cap;
+    char *dst; // where str is moved to by neat_array_part_move
+} neat_array_part;
+
+static inline void neat_array_part_append(neat_array_part *part, const char *str, size_t len)
+{
+    if(len == 0) return;
+    neat_strbuf_reserve(&part->str, &part->cap, part->len + len);
+    memcpy(part->str + part->len, str, len);
+    part->len += len;
+}
+
+// like neat_writer_put_quoted
+static void neat_array_part_append_quoted(neat_array_part *part, const char *str, size_t len)
+{
+    neat_array_part_append(part, "\"", 1);
+    size_t i = 0;
+    while(i < len)
+    {
+        size_t run = neat_escape_scan(str + i, len - i);
+        neat_array_part_append(part, str + i, run);
+        i += run;
+        if(i == len) break;
+        
+        neat_strbuf_reserve(&part->str, &part->cap, part->len + NEAT_ESCAPE_MAX);
+        part->len += neat_escape_char(part->str + part->len, str[i++]);
+    }
+    neat_array_part_append(part, "\"", 1);
+}
+
+// formats the part's range after what's already in part->str. Gives the same text as neat_wprint_array_f
+static void *neat_array_part_format(void *arg)
+{
+    neat_array_part *part = arg;
+    const neat_array_fmt *fmt = part->fmt;
+    size_t sep_len = strlen(fmt->sep);
+    size_t i = part->lo;
+    
+    if(neat_batch_kind(part->kind))
+    {
+        size_t need = sep_len + NEAT_BATCH_ELM_MAX;
+        while(i < part->hi)
+        {
+            neat_strbuf_reserve(&part->str, &part->cap, part->len + need);
+            part->len += neat_batch_fill(part->str + part->len, part->cap - part->len, part->arr, part->hi, &i, part->kind, fmt, sep_len);
+        }
+        return NULL;
+    }
+    
+    const char *elm = (const char*) part->arr + i * part->elm_size;
+    for( ; i < part->hi ; i++, elm += part->elm_size)
+    {
+        if(i > 0) neat_array_part_append(part, fmt->sep, sep_len);
+        switch(part->kind)
+        {
+            case NEAT_PRINT_STR:
+            {
+                const char *str = *(char* const*) elm;
+                if(fmt->quote) neat_array_part_append_quoted(part, str, strlen(str));
+                else           neat_array_part_append(part, str, strlen(str));
+                break;
+            }
+            case NEAT_PRINT_CHAR:
+                if(fmt->quote) neat_array_part_append_quoted(part, elm, 1);
+                else           neat_array_part_append(part, elm, 1);
+                break;
+            case NEAT_PRINT_BOOL:
+                if(*(const bool*) elm) neat_array_part_append(part, "true", 4);
+                else                   neat_array_part_append(part, "false", 5);
+                break;
+            default:
+                if(part->fn.tochars)
+                {
+                    size_t room = part->cap - part->len;
+                    size_t len = part->fn.tochars(part->str + part->len, room, (void*) elm);
+                    if(len >= room)
+                    {
+                        neat_strbuf_reserve(&part->str, &part->cap, part->len + len + 1);
+                        part->fn.tochars(part->str + part->len, part->cap - part->len, (void*) elm);
+                    }
+                    part->len += len;
+                }
+                else
+                {
+                    char *str = part->fn.tostr((void*) elm);
+                    neat_array_part_append(part, str, strlen(str));
+                    free(str);
+                }
+                break;
+        }
+    }
+    return NULL;
+}
+
+static void *neat_array_part_move(void *arg)
+{
+    neat_array_part *part = arg;
+    if(part->len) memcpy(part->dst, part->str, part->len);
+    free(part->str);
+    return NULL;
+}
+
+// splits [lo, hi) evenly between nparts parts
+static void neat_array_parts_split(neat_array_part *parts, size_t nparts, const void *arr, size_t lo, size_t hi, size_t elm_size, neat_print_kind kind, neat_strfn fn, const neat_array_fmt *fmt)
+{
+    size_t n = hi - lo;
+    for(size_t i = 0 ; i < nparts ; i++)
+    {
+        parts[i] = (neat_array_part){
+            .arr = arr, .lo = lo + n / nparts * i, .hi = i == nparts - 1 ? hi : lo + n / nparts * (i + 1),
+            .elm_size = elm_size, .kind = kind, .fn = fn, .fmt = fmt
+        };
+    }
+}
+
+/*
+    Each part is formatted into its own buffer, then the final string is
+    allocated once its length is known, and every part is moved to its
+    offset in it (the sum of the lengths before it). With one part, the
+    part's buffer is the final string, sized up front from elm_max_chars
+    (or a guess when it's 0) so for the built-in types it's never grown,
+    only shrunk to fit at the end.
+*/
+char *neat_array_to_string_fmt_f(const void *arr, size_t n, size_t elm_size, neat_print_kind kind, neat_strfn fn, size_t elm_max_chars, neat_array_fmt fmt)
+{
+    fmt = neat_array_fmt_clamp(fmt);
+    size_t open_len = strlen(fmt.open);
+    size_t sep_len = strlen(fmt.sep);
+    size_t close_len = strlen(fmt.close);
+    size_t nparts = neat_count_parts(n, NEAT_ARRAY_PAR_CHUNK, fmt.nthreads);
+    
+    neat_array_part one;
+    neat_array_part *parts = nparts > 1 ? calloc(nparts, sizeof(*parts)) : NULL;
+    if(!parts)
+    {
+        nparts = 1;
+        parts = &one;
+    }
+    neat_array_parts_split(parts, nparts, arr, 0, n, elm_size, kind, fn, &fmt);
+    
+    if(nparts == 1)
+    {
+        // the batch kernels want room for a separator and NEAT_BATCH_ELM_MAX past the last element
+        size_t elm_chars = elm_max_chars ? elm_max_chars : 8;
+        neat_strbuf_reserve(&one.str, &one.cap, open_len + n * (elm_chars + sep_len) + sep_len + NEAT_BATCH_ELM_MAX + close_len + 1);
+        neat_array_part_append(&one, fmt.open, open_len);
+        neat_array_part_format(&one);
+        neat_array_part_append(&one, fmt.close, close_len + 1);
+        return realloc(one.str, one.len);
+    }
+    
+    neat_run_parts(neat_array_part_format, parts, sizeof(*parts), nparts);
+    
+    size_t len = open_len + close_len;
+    for(size_t i = 0 ; i < nparts ; i++)
+        len += parts[i].len;
+    
+    char *ret = malloc(len + 1);
+    memcpy(ret, fmt.open, open_len);
+    size_t pos = open_len;
+    for(size_t i = 0 ; i < nparts ; i++)
+    {
+        parts[i].dst = ret + pos;
+        pos += parts[i].len;
+    }
+    neat_run_parts(neat_array_part_move, parts, sizeof(*parts), nparts);
+    memcpy(ret + pos, fmt.close, close_len + 1);
+    
+    free(parts);
+    return ret;
+}
+
+// formats nparts * NEAT_ARRAY_PAR_CHUNK elements at a time in parallel, and writes the parts in order
+static bool neat_wprint_array_par(neat_writer *w, const void *arr, size_t n, size_t elm_size, neat_print_kind kind, neat_strfn fn, const neat_array_fmt *fmt, size_t nparts)
+{
+    neat_array_part *parts = calloc(nparts, sizeof(*parts));
+    if(!parts) return false;
+    
+    size_t round = nparts * NEAT_ARRAY_PAR_CHUNK;
+    for(size_t lo = 0 ; lo < n ; lo += round)
+    {
+        size_t hi = n - lo > round ? lo + round : n;
+        neat_array_parts_split(parts, nparts, arr, lo, hi, elm_size, kind, fn, fmt);
+        neat_run_parts(neat_array_part_format, parts, sizeof(*parts), nparts);
+        for(size_t i = 0 ; i < nparts ; i++)
+        {
+            if(parts[i].len) neat_writer_write(w, parts[i].str, parts[i].len);
+            free(parts[i].str);
+        }
+    }
+    
+    free(parts);
+    return true;
+}
+
+void neat_wprint_array_f(neat_writer *w, const void *arr, size_t n, size_t elm_size, neat_print_kind kind, neat_strfn fn, neat_array_fmt fmt)
+{
+    fmt = neat_array_fmt_clamp(fmt);
+    size_t sep_len = strlen(fmt.sep);
+    neat_writer_write(w, fmt.open, strlen(fmt.open));
+    
+    size_t nparts = neat_count_parts(n, NEAT_ARRAY_PAR_CHUNK, fmt.nthreads);
+    if(nparts > 1 && neat_wprint_array_par(w, arr, n, elm_size, kind, fn, &fmt, nparts))
+    {
+        neat_writer_write(w, fmt.close, strlen(fmt.close));
+        return;
+    }
+    
+    if(neat_batch_kind(kind))
+    {
+        size_t need = sep_len + NEAT_BATCH_ELM_MAX;
+        size_t i = 0;
+        while(i < n)
+        {
+            if(w->cap - w->len < need) neat_writer_flush(w);
+            if(w->cap - w->len >= need)
+            {
+                w->len += neat_batch_fill(w->buf + w->len, w->cap - w->len, arr, n, &i, kind, &fmt, sep_len);
+                continue;
+            }
+            
+            // the writer is too small to format into
+            char tmp[NEAT_BATCH_ELM_MAX];
+            if(i > 0) neat_writer_write(w, fmt.sep, sep_len);
+            neat_writer_write(w, tmp, neat_batch_elm(tmp, arr, i, kind, fmt.precision));
+            i++;
+        }
+    }
+    else
+    {
+        const char *elm = arr;
+        for(size_t i = 0 ; i < n ; i++, elm += elm_size)
+        {
+            if(i > 0) neat_writer_write(w, fmt.sep, sep_len);
+            neat_print_arg arg = { kind, kind == NEAT_PRINT_STR ? *(char* const*) elm : elm, fn };
+            if(fmt.quote) neat_wprint_args_quoted(w, &arg, 1);
+            else          neat_wprint_args(w, &arg, 1);
+        }
+    }
+    
+    neat_writer_write(w, fmt.close, strlen(fmt.close));
+}
+
+#ifdef NEAT_TOSTR_ASYNC
+
+#include <stdatomic.h>
+#include <pthread.h>
+#include <sched.h>
+#include <time.h>
+
+/*
+    Async output: every thread that prints gets its own ring buffer, and
+    pushes the bytes its writer would have written as [u32 len][bytes]
+    records. Each ring has a single producer (its thread) and a single
+    consumer (the background thread), so pushing is lock-free: only the
+    head and tail indices are shared. The background thread drains all
+    the rings into one buffer and writes it out with a single call.
+    The list of rings is behind a mutex, it only changes when a thread
+    prints for the first time or exits.
+*/
+
+#ifndef NEAT_ASYNC_IDLE_NS
+    #define NEAT_ASYNC_IDLE_NS 1000000 // how long the drain thread sleeps when there's nothing to write
+#endif
+
+typedef struct neat_async_ring
+{
+    _Atomic size_t head; // consumer position
+    _Atomic size_t tail; // producer position
+    size_t mask;
+    char *data;
+    _Atomic bool retired; // its thread exited
+    bool drained;         // seen retired by the drain thread, and emptied after that
+    struct neat_async_ring *next;
+} neat_async_ring;
+
+static struct
+{
+    _Atomic bool running;
+    _Atomic int pushing; // threads inside neat_async_push
+    FILE *file;
+    int fd;
+    size_t ring_size;
+    neat_async_policy policy;
+    _Atomic uint64_t dropped;
+    
+    pthread_t thread;
+    pthread_mutex_t mutex; // guards rings and the generations
+    pthread_cond_t wake;
+    pthread_cond_t done;
+    neat_async_ring *rings;
+    uint64_t flush_requested;
+    uint64_t flush_done;
+    bool stop;
+    
+    pthread_once_t once;
+    pthread_key_t key;
+} neat_async = { .once = PTHREAD_ONCE_INIT, .mutex = PTHREAD_MUTEX_INITIALIZER, .wake = PTHREAD_COND_INITIALIZER, .done = PTHREAD_COND_INITIALIZER };
+
+static _Thread_local neat_async_ring *neat_async_my_ring;
+
+static void neat_async_retire(void *ring)
+{
+    atomic_store_explicit(&((neat_async_ring *) ring)->retired, true, memory_order_release);
+}
+
+static void neat_async_make_key(void)
+{
+    pthread_key_create(&neat_async.key, neat_async_retire);
+}
+
+static neat_async_ring *neat_async_get_ring(void)
+{
+    neat_async_ring *mine = neat_async_my_ring;
+    if(mine && mine->mask + 1 != neat_async.ring_size)
+    {
+        // restarted with another size. The last stop emptied the ring, and
+        // the drain thread doesn't look at data or mask until tail moves
+        free(mine->data);
+        mine->data = malloc(neat_async.ring_size);
+        mine->mask = neat_async.ring_size - 1;
+    }
+    if(mine) return mine;
+    
+    neat_async_ring *ring = calloc(1, sizeof(neat_async_ring));
+    ring->data = malloc(neat_async.ring_size);
+    ring->mask = neat_async.ring_size - 1;
+    
+    pthread_once(&neat_async.once, neat_async_make_key);
+    pthread_setspecific(neat_async.key, ring);
+    
+    pthread_mutex_lock(&neat_async.mutex);
+    ring->next = neat_async.rings;
+    neat_async.rings = ring;
+    pthread_mutex_unlock(&neat_async.mutex);
+    
+    neat_async_my_ring = ring;
+    return ring;
+}
+
+static void neat_async_ring_copy_in(neat_async_ring *ring, size_t pos, const void *src, size_t len)
+{
+    size_t at = pos & ring->mask;
+    size_t first = ring->mask + 1 - at;
+    if(first > len) first = len;
+    memcpy(ring->data + at, src, first);
+    memcpy(ring->data, (const char *) src + first, len - first);
+}
+
+static void neat_async_ring_copy_out(neat_async_ring *ring, size_t pos, void *dst, size_t len)
+{
+    size_t at = pos & ring->mask;
+    size_t first = ring->mask + 1 - at;
+    if(first > len) first = len;
+    memcpy(dst, ring->data + at, first);
+    memcpy((char *) dst + first, ring->data, len - first);
+}
+
+static void neat_async_wake(void)
+{
+    pthread_mutex_lock(&neat_async.mutex);
+    pthread_cond_signal(&neat_async.wake);
+    pthread_mutex_unlock(&neat_async.mutex);
+}
+
+// pushes one record, returns false if it was dropped
+static bool neat_async_push_record(neat_async_ring *ring, const char *str, uint32_t len)
+{
+    size_t need = sizeof(len) + len;
+    size_t cap = ring->mask + 1;
+    size_t tail = atomic_load_explicit(&ring->tail, memory_order_relaxed);
+    
+    while(cap - (tail - atomic_load_explicit(&ring->head, memory_order_acquire)) < need)
+    {
+        if(neat_async.policy == NEAT_ASYNC_DROP)
+        {
+            atomic_fetch_add_explicit(&neat_async.dropped, len, memory_order_relaxed);
+            return false;
+        }
+        neat_async_wake();
+        sched_yield();
+    }
+    
+    neat_async_ring_copy_in(ring, tail, &len, sizeof(len));
+    neat_async_ring_copy_in(ring, tail + sizeof(len), str, len);
+    atomic_store_explicit(&ring->tail, tail + need, memory_order_release);
+    return true;
+}
+
+static bool neat_async_push(neat_writer *w, const char *str, size_t len)
+{
+    // announce the push before checking running, so neat_async_stop can wait for it to finish
+    atomic_fetch_add(&neat_async.pushing, 1);
+    if(!atomic_load(&neat_async.running) || (w->file ? w->file != neat_async.file : w->fd != neat_async.fd))
+    {
+        atomic_fetch_sub(&neat_async.pushing, 1);
+        return false;
+    }
+    
+    neat_async_ring *ring = neat_async_get_ring();
+    
+    // output bigger than half the ring is split up, so it can always fit eventually
+    size_t max_record = (ring->mask + 1) / 2 - sizeof(uint32_t);
+    while(len > 0)
+    {
+        size_t n = len < max_record ? len : max_record;
+        if(!neat_async_push_record(ring, str, (uint32_t) n))
+        {
+            // the rest of a dropped output is dropped too
+            atomic_fetch_add_explicit(&neat_async.dropped, len - n, memory_order_relaxed);
+            break;
+        }
+        str += n;
+        len -= n;
+    }
+    atomic_fetch_sub(&neat_async.pushing, 1);
+    return true;
+}
+
+static void neat_async_write_out(const char *str, size_t len)
+{
+    neat_write_all(neat_async.file, neat_async.fd, str, len);
+}
+
+// drains every ring once, returns how many bytes were written
+static size_t neat_async_drain(char *buf, size_t cap)
+{
+    size_t total = 0, len = 0;
+    bool any_retired = false;
+    
+    // only this thread unlinks rings, so the list can be walked without the lock
+    // (new rings are added in front of the head taken here), and nothing is
+    // written out while holding it
+    pthread_mutex_lock(&neat_async.mutex);
+    neat_async_ring *first = neat_async.rings;
+    pthread_mutex_unlock(&neat_async.mutex);
+    
+    for(neat_async_ring *ring = first ; ring ; ring = ring->next)
+    {
+        // read retired before the tail, so a ring seen retired and empty stays empty
+        ring->drained = atomic_load_explicit(&ring->retired, memory_order_acquire);
+        any_retired |= ring->drained;
+        size_t head = atomic_load_explicit(&ring->head, memory_order_relaxed);
+        size_t tail = atomic_load_explicit(&ring->tail, memory_order_acquire);
+        
+        while(head != tail)
+        {
+            uint32_t rec;
+            neat_async_ring_copy_out(ring, head, &rec, sizeof(rec));
+            if(len + rec > cap)
+            {
+                neat_async_write_out(buf, len);
+                total += len;
+                len = 0;
+            }
+            neat_async_ring_copy_out(ring, head + sizeof(rec), buf + len, rec);
+            len += rec;
+            head += sizeof(rec) + rec;
+            atomic_store_explicit(&ring->head, head, memory_order_release);
+        }
+    }
+    
+    if(len > 0) neat_async_write_out(buf, len);
+    total += len;
+    if(total > 0 && neat_async.file) fflush(neat_async.file);
+    
+    if(any_retired)
+    {
+        neat_async_ring *dead = NULL;
+        pthread_mutex_lock(&neat_async.mutex);
+        for(neat_async_ring **link = &neat_async.rings ; *link ; )
+        {
+            neat_async_ring *ring = *link;
+            if(ring->drained)
+            {
+                *link = ring->next;
+                ring->next = dead;
+                dead = ring;
+            }
+            else
+            {
+                link = &ring->next;
+            }
+        }
+        pthread_mutex_unlock(&neat_async.mutex);
+        
+        while(dead)
+        {
+            neat_async_ring *next = dead->next;
+            free(dead->data);
+            free(dead);
+            dead = next;
+        }
+    }
+    return total;
+}
+
+static void *neat_async_main(void *arg)
+{
+    (void) arg;
+    // records are at most half a ring, so this always fits one
+    size_t cap = neat_async.ring_size > 65536 ? neat_async.ring_size : 65536;
+    char *buf = malloc(cap);
+    
+    pthread_mutex_lock(&neat_async.mutex);
+    for(;;)
+    {
+        uint64_t requested = neat_async.flush_requested;
+        bool stop = neat_async.stop;
+        pthread_mutex_unlock(&neat_async.mutex);
+        
+        size_t written = neat_async_drain(buf, cap);
+        
+        pthread_mutex_lock(&neat_async.mutex);
+        neat_async.flush_done = requested;
+        pthread_cond_broadcast(&neat_async.done);
+        if(stop) break;
+        
+        if(written == 0 && neat_async.flush_requested == requested && !neat_async.stop)
+        {
+            struct timespec ts;
+            clock_gettime(CLOCK_REALTIME, &ts);
+            ts.tv_nsec += NEAT_ASYNC_IDLE_NS;
+            ts.tv_sec += ts.tv_nsec / 1000000000;
+            ts.tv_nsec %= 1000000000;
+            pthread_cond_timedwait(&neat_async.wake, &neat_async.mutex, &ts);
+        }
+    }
+    pthread_mutex_unlock(&neat_async.mutex);
+    
+    free(buf);
+    return NULL;
+}
+
+static int neat_async_start_impl(FILE *file, int fd, size_t ring_size, neat_async_policy policy)
+{
+    if(atomic_load(&neat_async.running)) return -1;
+    
+    // rings are indexed with a mask, so their size is a power of two. Rings
+    // of threads that printed before are resized on their next push
+    size_t size = 4096;
+    while(size < ring_size) size *= 2;
+    neat_async.ring_size = size;
+    
+    neat_async.file = file;
+    neat_async.fd = fd;
+    neat_async.policy = policy;
+    neat_async.stop = false;
+    
+    if(pthread_create(&neat_async.thread, NULL, neat_async_main, NULL) != 0)
+        return -1;
+    atomic_store_explicit(&neat_async.running, true, memory_order_release);
+    return 0;
+}
+
+int neat_async_start(FILE *file, size_t ring_size, neat_async_policy policy)
+{
+    return neat_async_start_impl(file, -1, ring_size, policy);
+}
+
+int neat_async_start_fd(int fd, size_t ring_size, neat_async_policy policy)
+{
+    return neat_async_start_impl(NULL, fd, ring_size, policy);
+}
+
+void neat_async_flush(void)
+{
+    if(!atomic_load_explicit(&neat_async.running, memory_order_acquire)) return;
+    
+    pthread_mutex_lock(&neat_async.mutex);
+    uint64_t gen = ++neat_async.flush_requested;
+    pthread_cond_signal(&neat_async.wake);
+    while(neat_async.flush_done < gen)
+        pthread_cond_wait(&neat_async.done, &neat_async.mutex);
+    pthread_mutex_unlock(&neat_async.mutex);
+}
+
+void neat_async_stop(void)
+{
+    if(!atomic_load(&neat_async.running)) return;
+    
+    // new output goes straight to the target from here on, and what's
+    // already being pushed is drained by the last pass
+    atomic_store(&neat_async.running, false);
+    while(atomic_load(&neat_async.pushing) > 0)
+        sched_yield();
+    
+    pthread_mutex_lock(&neat_async.mutex);
+    neat_async.stop = true;
+    pthread_cond_signal(&neat_async.wake);
+    pthread_mutex_unlock(&neat_async.mutex);
+    pthread_join(neat_async.thread, NULL);
+}
+
+uint64_t neat_async_dropped(void)
+{
+    return atomic_load_explicit(&neat_async.dropped, memory_order_relaxed);
+}
+
+#endif // NEAT_TOSTR_ASYNC
+
+// 2str functions definitions
+
+char *neat_char2str(char *obj) {
+    char *ret = malloc(2 * sizeof(char));
+    ret[0] = *obj;
+    ret[1] = 0;
+    return ret;
+}
+
+char *neat_str2str(char *obj) {
+    size_t len = strlen(obj);
+    char *ret = malloc(len + 1);
+    memcpy(ret, obj, len + 1);
+    return ret;
+}
+
+char *neat_str2str_dummy(char **obj) { return (char*)obj; };
+
+char *neat_bool2str(bool *obj) {
+    char *ret = malloc(6 * sizeof(char));
+    memcpy(ret, "false", 6);
+    if(*obj) memcpy(ret, "true", 5);
+    return ret;
+}
+
+char *neat_int8_t2str(int8_t *obj) {
+    char *ret = malloc(5 * sizeof(char));
+    ret[neat_i64_to_dec(ret, *obj)] = '\0';
+    return ret;
+}
+
+char *neat_int16_t2str(int16_t *obj) {
+    char *ret = malloc(7 * sizeof(char));
+    ret[neat_i64_to_dec(ret, *obj)] = '\0';
+    return ret;
+}
+
+char *neat_int32_t2str(int32_t *obj) {
+    char *ret = malloc(12 * sizeof(char));
+    ret[neat_i64_to_dec(ret, *obj)] = '\0';
+    return ret;
+}
+
+char *neat_int64_t2str(int64_t *obj) {
+    char *ret = malloc(21 * sizeof(char));
+    ret[neat_i64_to_dec(ret, *obj)] = '\0';
+    return ret;
+}
+
+char *neat_uint8_t2str(uint8_t *obj) {
+    char *ret = malloc(4 * sizeof(char));
+    ret[neat_u64_to_dec(ret, *obj)] = '\0';
+    return ret;
+}
+
+char *neat_uint16_t2str(uint16_t *obj) {
+    char *ret = malloc(6 * sizeof(char));
+    ret[neat_u64_to_dec(ret, *obj)] = '\0';
+    return ret;
+}
+
+char *neat_uint32_t2str(uint32_t *obj) {
+    char *ret = malloc(12 * sizeof(char));
+    ret[neat_u64_to_dec(ret, *obj)] = '\0';
+    return ret;
+}
+
+char *neat_uint64_t2str(uint64_t *obj) {
+    char *ret = malloc(21 * sizeof(char));
+    ret[neat_u64_to_dec(ret, *obj)] = '\0';
+    return ret;
+}
+
+char *neat_float2str(float *obj) {
+    char *ret = malloc(NEAT_FLOAT_MAX_CHARS * sizeof(char));
+    ret[neat_fmt_float(ret, *obj)] = '\0';
+    return ret;
+}
+
+char *neat_double2str(double *obj) {
+    char *ret = malloc(NEAT_FLOAT_MAX_CHARS * sizeof(char));
+    ret[neat_fmt_double(ret, *obj)] = '\0';
+    return ret;
+}
+
+// 2chars functions definitions
+
+size_t neat_char2chars(char *buf, size_t cap, char *obj) {
+    return neat_chars_copy(buf, cap, obj, 1);
+}
+
+size_t neat_str2chars(char *buf, size_t cap, char *obj) {
+    return neat_chars_copy(buf, cap, obj, strlen(obj));
+}
+
+size_t neat_str2chars_dummy(char *buf, size_t cap, char **obj) { return neat_str2chars(buf, cap, *obj); }
+
+size_t neat_bool2chars(char *buf, size_t cap, bool *obj) {
+    return *obj ? neat_chars_copy(buf, cap, "true", 4) : neat_chars_copy(buf, cap, "false", 5);
+}
+
+size_t neat_int8_t2chars(char *buf, size_t cap, int8_t *obj) {
+    return neat_int2chars(buf, cap, *obj);
+}
+
+size_t neat_int16_t2chars(char *buf, size_t cap, int16_t *obj) {
+    return neat_int2chars(buf, cap, *obj);
+}
+
+size_t neat_int32_t2chars(char *buf, size_t cap, int32_t *obj) {
+    return neat_int2chars(buf, cap, *obj);
+}
+
+size_t neat_int64_t2chars(char *buf, size_t cap, int64_t *obj) {
+    return neat_int2chars(buf, cap, *obj);
+}
+
+size_t neat_uint8_t2chars(char *buf, size_t cap, uint8_t *obj) {
+    return neat_uint2chars(buf, cap, *obj);
+}
+
+size_t neat_uint16_t2chars(char *buf, size_t cap, uint16_t *obj) {
+    return neat_uint2chars(buf, cap, *obj);
+}
+
+size_t neat_uint32_t2chars(char *buf, size_t cap, uint32_t *obj) {
+    return neat_uint2chars(buf, cap, *obj);
+}
+
+size_t neat_uint64_t2chars(char *buf, size_t cap, uint64_t *obj) {
+    return neat_uint2chars(buf, cap, *obj);
+}
+
+size_t neat_float2chars(char *buf, size_t cap, float *obj) {
+    char tmp[NEAT_FLOAT_MAX_CHARS];
+    return neat_chars_copy(buf, cap, tmp, neat_fmt_float(tmp, *obj));
+}
+
+size_t neat_double2chars(char *buf, size_t cap, double *obj) {
+    char tmp[NEAT_FLOAT_MAX_CHARS];
+    return neat_chars_copy(buf, cap, tmp, neat_fmt_double(tmp, *obj));
+}
+
+// integer parsing kernels
+
+static inline bool neat_is_space(char c)
+{
+    return c == ' ' || (c >= '\t' && c <= '\r');
+}
+
+static inline bool neat_is_digit(char c)
+{
+    return (unsigned char) (c - '0') < 10;
+}
+
+/*
+    Reads *p, or '\0' at lim. The kernels take lim as the end of a span,
+    or NULL for a NUL terminated string (p never equals NULL), so one
+    code path never reads past either.
+*/
+static inline char neat_peek(const char *p, const char *lim)
+{
+    return p != lim ? *p : '\0';
+}
+
+/*
+    Converts 8 ascii digits at once: subtract '0' from every byte, then
+    combine neighbouring digits, pairs, and quads with 3 multiplications.
+    The bytes are assembled little-endian by hand, so this doesn't depend
+    on the host byte order (and still compiles to a single load).
+*/
+static inline uint64_t neat_parse_8digits(const char *p)
+{
+    const unsigned char *u = (const unsigned char *) p;
+    uint64_t v = (uint64_t) u[0]       | (uint64_t) u[1] << 8  | (uint64_t) u[2] << 16 | (uint64_t) u[3] << 24 |
+                 (uint64_t) u[4] << 32 | (uint64_t) u[5] << 40 | (uint64_t) u[6] << 48 | (uint64_t) u[7] << 56;
+    v -= 0x3030303030303030ull;
+    v = (v * 10) + (v >> 8);
+    v = (((v & 0x000000FF000000FFull) * (100 + (1000000ull << 32))) +
+         (((v >> 16) & 0x000000FF000000FFull) * (1 + (10000ull << 32)))) >> 32;
+    return v;
+}
+
+/*
+    Parses the magnitude of an integer and its sign. Returns false if
+    there are no digits, otherwise sets *end_out past the last digit.
+*/
+static bool neat_parse_magnitude(const char *str, const char *lim, uint64_t *out, bool *neg, bool *overflow, const char **end_out, int *err)
+{
+    const char *p = str;
+    while(neat_is_space(neat_peek(p, lim))) p++;
+    
+    char c = neat_peek(p, lim);
+    if(c == '\0')
+    {
+        *err = NEAT_PARSE_EMPTY;
+        return false;
+    }
+    
+    *neg = c == '-';
+    if(c == '-' || c == '+') p++;
+    
+    const char *start = p;
+    while(neat_peek(p, lim) == '0') p++;
+    const char *digits = p;
+    while(neat_is_digit(neat_peek(p, lim))) p++;
+    
+    size_t n = (size_t) (p - digits);
+    if(n == 0 && digits == start)
+    {
+        *err = NEAT_PARSE_INVALID;
+        return false;
+    }
+    
+    // 19 digits always fit in 64 bits, only the 20th needs an overflow check
+    uint64_t v = 0;
+    size_t head = n < 19 ? n : 19;
+    size_t i = 0;
+    for( ; i + 8 <= head ; i += 8)
+        v = v * 100000000 + neat_parse_8digits(digits + i);
+    for( ; i < head ; i++)
+        v = v * 10 + (uint64_t) (digits[i] - '0');
+    
+    *overflow = false;
+    if(n == 20)
+    {
+        uint64_t d = (uint64_t) (digits[19] - '0');
+        *overflow = v > (UINT64_MAX - d) / 10;
+        v = v * 10 + d;
+    }
+    else if(n > 20)
+    {
+        *overflow = true;
+    }
+    
+    *out = v;
+    *end_out = p;
+    *err = NEAT_PARSE_OK;
+    return true;
+}
+
+static int64_t neat_parse_i64_lim(const char *str, const char *lim, const char **end, int64_t min, int64_t max, int *err)
+{
+    uint64_t v;
+    bool neg, overflow;
+    const char *p;
+    if(!neat_parse_magnitude(str, lim, &v, &neg, &overflow, &p, err))
+    {
+        *end = str;
+        return 0;
+    }
+    *end = p;
+    
+    // compare magnitudes as unsigned, so INT64_MIN doesn't overflow
+    if(neg)
+    {
+        uint64_t limit = (uint64_t) -(min + 1) + 1;
+        if(overflow || v > limit)
+        {
+            *err = NEAT_PARSE_RANGE;
+            return min;
+        }
+        return v == 0 ? 0 : -(int64_t) (v - 1) - 1;
+    }
+    if(overflow || v > (uint64_t) max)
+    {
+        *err = NEAT_PARSE_RANGE;
+        return max;
+    }
+    return (int64_t) v;
+}
+
+int64_t neat_parse_i64(const char *str, char **end, int64_t min, int64_t max, int *err)
+{
+    const char *p;
+    int64_t ret = neat_parse_i64_lim(str, NULL, &p, min, max, err);
+    if(end) *end = (char *) p;
+    return ret;
+}
+
+static uint64_t neat_parse_u64_lim(const char *str, const char *lim, const char **end, uint64_t max, int *err)
+{
+    uint64_t v;
+    bool neg, overflow;
+    const char *p;
+    if(!neat_parse_magnitude(str, lim, &v, &neg, &overflow, &p, err))
+    {
+        *end = str;
+        return 0;
+    }
+    *end = p;
+    
+    // "-0" is fine, any other negative number is out of range
+    if(neg && (overflow || v != 0))
+    {
+        *err = NEAT_PARSE_RANGE;
+        return 0;
+    }
+    if(overflow || v > max)
+    {
+        *err = NEAT_PARSE_RANGE;
+        return max;
+    }
+    return v;
+}
+
+uint64_t neat_parse_u64(const char *str, char **end, uint64_t max, int *err)
+{
+    const char *p;
+    uint64_t ret = neat_parse_u64_lim(str, NULL, &p, max, err);
+    if(end) *end = (char *) p;
+    return ret;
+}
+
+// float parsing kernels
+
+/*
+    Correctly rounded decimal to binary conversion. Up to 19 significant
+    digits are read into a 64 bit integer w, so the value is w * 10^q:
+    
+    1. if w and 10^q are both exact in the target type, one
+       multiplication or division is enough (Clinger's fast path).
+    2. otherwise w is multiplied with a 128 bit truncation of 5^q
+       (Eisel-Lemire), which is always enough to round correctly.
+    3. if there were more than 19 digits, w and w + 1 bracket the real
+       value, and when they round differently the digits are converted
+       exactly with a big decimal instead.
+*/
+
+typedef struct neat_float_info
+{
+    int mantissa_bits;
+    int exponent_bits;
+    int minimum_exponent;
+    int infinite_power;
+    int smallest_pow10;
+    int largest_pow10;
+    int min_round_to_even;
+    int max_round_to_even;
+} neat_float_info;
+
+static const neat_float_info neat_f64_info = { 52, 11, -1023, 0x7ff, -342, 308, -4, 23 };
+static const neat_float_info neat_f32_info = { 23, 8, -127, 0xff, -65, 38, -17, 10 };
+
+// 5^q for q in [-342, 308], normalized to 128 bits and stored as { high, low } pairs
+static const uint64_t neat_pow5_128[1302] = {
+    0xeef453d6923bd65au, 0x113faa2906a13b3fu, 0x9558b4661b6565f8u, 0x4ac7ca59a424c507u,
+    0xbaaee17fa23ebf76u, 0x5d79bcf00d2df649u, 0xe95a99df8ace6f53u, 0xf4d82c2c107973dcu,
+    0x91d8a02bb6c10594u, 0x79071b9b8a4be869u, 0xb64ec836a47146f9u, 0x9748e2826cdee284u,
+    0xe3e27a444d8d98b7u, 0xfd1b1b2308169b25u, 0x8e6d8c6ab0787f72u, 0xfe30f0f5e50e20f7u,
+    0xb208ef855c969f4fu, 0xbdbd2d335e51a935u, 0xde8b2b66b3bc4723u, 0xad2c788035e61382u,
+    0x8b16fb203055ac76u, 0x4c3bcb5021afcc31u, 0xaddcb9e83c6b1793u, 0xdf4abe242a1bbf3du,
+    0xd953e8624b85dd78u, 0xd71d6dad34a2af0du, 0x87d4713d6f33aa6bu, 0x8672648c40e5ad68u,
+    0xa9c98d8ccb009506u, 0x680efdaf511f18c2u, 0xd43bf0effdc0ba48u, 0x0212bd1b2566def2u,
+    0x84a57695fe98746du, 0x014bb630f7604b57u, 0xa5ced43b7e3e9188u, 0x419ea3bd35385e2du,
+    0xcf42894a5dce35eau, 0x52064cac828675b9u, 0x818995ce7aa0e1b2u, 0x7343efebd1940993u,
+    0xa1ebfb4219491a1fu, 0x1014ebe6c5f90bf8u, 0xca66fa129f9b60a6u, 0xd41a26e077774ef6u,
+    0xfd00b897478238d0u, 0x8920b098955522b4u, 0x9e20735e8cb16382u, 0x55b46e5f5d5535b0u,
+    0xc5a890362fddbc62u, 0xeb2189f734aa831du, 0xf712b443bbd52b7bu, 0xa5e9ec7501d523e4u,
+    0x9a6bb0aa55653b2du, 0x47b233c92125366eu, 0xc1069cd4eabe89f8u, 0x999ec0bb696e840au,
+    0xf148440a256e2c76u, 0xc00670ea43ca250du, 0x96cd2a865764dbcau, 0x380406926a5e5728u,
+    0xbc807527ed3e12bcu, 0xc605083704f5ecf2u, 0xeba09271e88d976bu, 0xf7864a44c633682eu,
+    0x93445b8731587ea3u, 0x7ab3ee6afbe0211du, 0xb8157268fdae9e4cu, 0x5960ea05bad82964u,
+    0xe61acf033d1a45dfu, 0x6fb92487298e33bdu, 0x8fd0c16206306babu, 0xa5d3b6d479f8e056u,
+    0xb3c4f1ba87bc8696u, 0x8f48a4899877186cu, 0xe0b62e2929aba83cu, 0x331acdabfe94de87u,
+    0x8c71dcd9ba0b4925u, 0x9ff0c08b7f1d0b14u, 0xaf8e5410288e1b6fu, 0x07ecf0ae5ee44dd9u,
+    0xdb71e91432b1a24au, 0xc9e82cd9f69d6150u, 0x892731ac9faf056eu, 0xbe311c083a225cd2u,
+    0xab70fe17c79ac6cau, 0x6dbd630a48aaf406u, 0xd64d3d9db981787du, 0x092cbbccdad5b108u,
+    0x85f0468293f0eb4eu, 0x25bbf56008c58ea5u, 0xa76c582338ed2621u, 0xaf2af2b80af6f24eu,
+    0xd1476e2c07286faau, 0x1af5af660db4aee1u, 0x82cca4db847945cau, 0x50d98d9fc890ed4du,
+    0xa37fce126597973cu, 0xe50ff107bab528a0u, 0xcc5fc196fefd7d0cu, 0x1e53ed49a96272c8u,
+    0xff77b1fcbebcdc4fu, 0x25e8e89c13bb0f7au, 0x9faacf3df73609b1u, 0x77b191618c54e9acu,
+    0xc795830d75038c1du, 0xd59df5b9ef6a2417u, 0xf97ae3d0d2446f25u, 0x4b0573286b44ad1du,
+    0x9becce62836ac577u, 0x4ee367f9430aec32u, 0xc2e801fb244576d5u, 0x229c41f793cda73fu,
+    0xf3a20279ed56d48au, 0x6b43527578c1110fu, 0x9845418c345644d6u, 0x830a13896b78aaa9u,
+    0xbe5691ef416bd60cu, 0x23cc986bc656d553u, 0xedec366b11c6cb8fu, 0x2cbfbe86b7ec8aa8u,
+    0x94b3a202eb1c3f39u, 0x7bf7d71432f3d6a9u, 0xb9e08a83a5e34f07u, 0xdaf5ccd93fb0cc53u,
+    0xe858ad248f5c22c9u, 0xd1b3400f8f9cff68u, 0x91376c36d99995beu, 0x23100809b9c21fa1u,
+    0xb58547448ffffb2du, 0xabd40a0c2832a78au, 0xe2e69915b3fff9f9u, 0x16c90c8f323f516cu,
+    0x8dd01fad907ffc3bu, 0xae3da7d97f6792e3u, 0xb1442798f49ffb4au, 0x99cd11cfdf41779cu,
+    0xdd95317f31c7fa1du, 0x40405643d711d583u, 0x8a7d3eef7f1cfc52u, 0x482835ea666b2572u,
+    0xad1c8eab5ee43b66u, 0xda3243650005eecfu, 0xd863b256369d4a40u, 0x90bed43e40076a82u,
+    0x873e4f75e2224e68u, 0x5a7744a6e804a291u, 0xa90de3535aaae202u, 0x711515d0a205cb36u,
+    0xd3515c2831559a83u, 0x0d5a5b44ca873e03u, 0x8412d9991ed58091u, 0xe858790afe9486c2u,
+    0xa5178fff668ae0b6u, 0x626e974dbe39a872u, 0xce5d73ff402d98e3u, 0xfb0a3d212dc8128fu,
+    0x80fa687f881c7f8eu, 0x7ce66634bc9d0b99u, 0xa139029f6a239f72u, 0x1c1fffc1ebc44e80u,
+    0xc987434744ac874eu, 0xa327ffb266b56220u, 0xfbe9141915d7a922u, 0x4bf1ff9f0062baa8u,
+    0x9d71ac8fada6c9b5u, 0x6f773fc3603db4a9u, 0xc4ce17b399107c22u, 0xcb550fb4384d21d3u,
+    0xf6019da07f549b2bu, 0x7e2a53a146606a48u, 0x99c102844f94e0fbu, 0x2eda7444cbfc426du,
+    0xc0314325637a1939u, 0xfa911155fefb5308u, 0xf03d93eebc589f88u, 0x793555ab7eba27cau,
+    0x96267c7535b763b5u, 0x4bc1558b2f3458deu, 0xbbb01b9283253ca2u, 0x9eb1aaedfb016f16u,
+    0xea9c227723ee8bcbu, 0x465e15a979c1cadcu, 0x92a1958a7675175fu, 0x0bfacd89ec191ec9u,
+    0xb749faed14125d36u, 0xcef980ec671f667bu, 0xe51c79a85916f484u, 0x82b7e12780e7401au,
+    0x8f31cc0937ae58d2u, 0xd1b2ecb8b0908810u, 0xb2fe3f0b8599ef07u, 0x861fa7e6dcb4aa15u,
+    0xdfbdcece67006ac9u, 0x67a791e093e1d49au, 0x8bd6a141006042bdu, 0xe0c8bb2c5c6d24e0u,
+    0xaecc49914078536du, 0x58fae9f773886e18u, 0xda7f5bf590966848u, 0xaf39a475506a899eu,
+    0x888f99797a5e012du, 0x6d8406c952429603u, 0xaab37fd7d8f58178u, 0xc8e5087ba6d33b83u,
+    0xd5605fcdcf32e1d6u, 0xfb1e4a9a90880a64u, 0x855c3be0a17fcd26u, 0x5cf2eea09a55067fu,
+    0xa6b34ad8c9dfc06fu, 0xf42faa48c0ea481eu, 0xd0601d8efc57b08bu, 0xf13b94daf124da26u,
+    0x823c12795db6ce57u, 0x76c53d08d6b70858u, 0xa2cb1717b52481edu, 0x54768c4b0c64ca6eu,
+    0xcb7ddcdda26da268u, 0xa9942f5dcf7dfd09u, 0xfe5d54150b090b02u, 0xd3f93b35435d7c4cu,
+    0x9efa548d26e5a6e1u, 0xc47bc5014a1a6dafu, 0xc6b8e9b0709f109au, 0x359ab6419ca1091bu,
+    0xf867241c8cc6d4c0u, 0xc30163d203c94b62u, 0x9b407691d7fc44f8u, 0x79e0de63425dcf1du,
+    0xc21094364dfb5636u, 0x985915fc12f542e4u, 0xf294b943e17a2bc4u, 0x3e6f5b7b17b2939du,
+    0x979cf3ca6cec5b5au, 0xa705992ceecf9c42u, 0xbd8430bd08277231u, 0x50c6ff782a838353u,
+    0xece53cec4a314ebdu, 0xa4f8bf5635246428u, 0x940f4613ae5ed136u, 0x871b7795e136be99u,
+    0xb913179899f68584u, 0x28e2557b59846e3fu, 0xe757dd7ec07426e5u, 0x331aeada2fe589cfu,
+    0x9096ea6f3848984fu, 0x3ff0d2c85def7621u, 0xb4bca50b065abe63u, 0x0fed077a756b53a9u,
+    0xe1ebce4dc7f16dfbu, 0xd3e8495912c62894u, 0x8d3360f09cf6e4bdu, 0x64712dd7abbbd95cu,
+    0xb080392cc4349decu, 0xbd8d794d96aacfb3u, 0xdca04777f541c567u, 0xecf0d7a0fc5583a0u,
+    0x89e42caaf9491b60u, 0xf41686c49db57244u, 0xac5d37d5b79b6239u, 0x311c2875c522ced5u,
+    0xd77485cb25823ac7u, 0x7d633293366b828bu, 0x86a8d39ef77164bcu, 0xae5dff9c02033197u,
+    0xa8530886b54dbdebu, 0xd9f57f830283fdfcu, 0xd267caa862a12d66u, 0xd072df63c324fd7bu,
+    0x8380dea93da4bc60u, 0x4247cb9e59f71e6du, 0xa46116538d0deb78u, 0x52d9be85f074e608u,
+    0xcd795be870516656u, 0x67902e276c921f8bu, 0x806bd9714632dff6u, 0x00ba1cd8a3db53b6u,
+    0xa086cfcd97bf97f3u, 0x80e8a40eccd228a4u, 0xc8a883c0fdaf7df0u, 0x6122cd128006b2cdu,
+    0xfad2a4b13d1b5d6cu, 0x796b805720085f81u, 0x9cc3a6eec6311a63u, 0xcbe3303674053bb0u,
+    0xc3f490aa77bd60fcu, 0xbedbfc4411068a9cu, 0xf4f1b4d515acb93bu, 0xee92fb5515482d44u,
+    0x991711052d8bf3c5u, 0x751bdd152d4d1c4au, 0xbf5cd54678eef0b6u, 0xd262d45a78a0635du,
+    0xef340a98172aace4u, 0x86fb897116c87c34u, 0x9580869f0e7aac0eu, 0xd45d35e6ae3d4da0u,
+    0xbae0a846d2195712u, 0x8974836059cca109u, 0xe998d258869facd7u, 0x2bd1a438703fc94bu,
+    0x91ff83775423cc06u, 0x7b6306a34627ddcfu, 0xb67f6455292cbf08u, 0x1a3bc84c17b1d542u,
+    0xe41f3d6a7377eecau, 0x20caba5f1d9e4a93u, 0x8e938662882af53eu, 0x547eb47b7282ee9cu,
+    0xb23867fb2a35b28du, 0xe99e619a4f23aa43u, 0xdec681f9f4c31f31u, 0x6405fa00e2ec94d4u,
+    0x8b3c113c38f9f37eu, 0xde83bc408dd3dd04u, 0xae0b158b4738705eu, 0x9624ab50b148d445u,
+    0xd98ddaee19068c76u, 0x3badd624dd9b0957u, 0x87f8a8d4cfa417c9u, 0xe54ca5d70a80e5d6u,
+    0xa9f6d30a038d1dbcu, 0x5e9fcf4ccd211f4cu, 0xd47487cc8470652bu, 0x7647c3200069671fu,
+    0x84c8d4dfd2c63f3bu, 0x29ecd9f40041e073u, 0xa5fb0a17c777cf09u, 0xf468107100525890u,
+    0xcf79cc9db955c2ccu, 0x7182148d4066eeb4u, 0x81ac1fe293d599bfu, 0xc6f14cd848405530u,
+    0xa21727db38cb002fu, 0xb8ada00e5a506a7cu, 0xca9cf1d206fdc03bu, 0xa6d90811f0e4851cu,
+    0xfd442e4688bd304au, 0x908f4a166d1da663u, 0x9e4a9cec15763e2eu, 0x9a598e4e043287feu,
+    0xc5dd44271ad3cdbau, 0x40eff1e1853f29fdu, 0xf7549530e188c128u, 0xd12bee59e68ef47cu,
+    0x9a94dd3e8cf578b9u, 0x82bb74f8301958ceu, 0xc13a148e3032d6e7u, 0xe36a52363c1faf01u,
+    0xf18899b1bc3f8ca1u, 0xdc44e6c3cb279ac1u, 0x96f5600f15a7b7e5u, 0x29ab103a5ef8c0b9u,
+    0xbcb2b812db11a5deu, 0x7415d448f6b6f0e7u, 0xebdf661791d60f56u, 0x111b495b3464ad21u,
+    0x936b9fcebb25c995u, 0xcab10dd900beec34u, 0xb84687c269ef3bfbu, 0x3d5d514f40eea742u,
+    0xe65829b3046b0afau, 0x0cb4a5a3112a5112u, 0x8ff71a0fe2c2e6dcu, 0x47f0e785eaba72abu,
+    0xb3f4e093db73a093u, 0x59ed216765690f56u, 0xe0f218b8d25088b8u, 0x306869c13ec3532cu,
+    0x8c974f7383725573u, 0x1e414218c73a13fbu, 0xafbd2350644eeacfu, 0xe5d1929ef90898fau,
+    0xdbac6c247d62a583u, 0xdf45f746b74abf39u, 0x894bc396ce5da772u, 0x6b8bba8c328eb783u,
+    0xab9eb47c81f5114fu, 0x066ea92f3f326564u, 0xd686619ba27255a2u, 0xc80a537b0efefebdu,
+    0x8613fd0145877585u, 0xbd06742ce95f5f36u, 0xa798fc4196e952e7u, 0x2c48113823b73704u,
+    0xd17f3b51fca3a7a0u, 0xf75a15862ca504c5u, 0x82ef85133de648c4u, 0x9a984d73dbe722fbu,
+    0xa3ab66580d5fdaf5u, 0xc13e60d0d2e0ebbau, 0xcc963fee10b7d1b3u, 0x318df905079926a8u,
+    0xffbbcfe994e5c61fu, 0xfdf17746497f7052u, 0x9fd561f1fd0f9bd3u, 0xfeb6ea8bedefa633u,
+    0xc7caba6e7c5382c8u, 0xfe64a52ee96b8fc0u, 0xf9bd690a1b68637bu, 0x3dfdce7aa3c673b0u,
+    0x9c1661a651213e2du, 0x06bea10ca65c084eu, 0xc31bfa0fe5698db8u, 0x486e494fcff30a62u,
+    0xf3e2f893dec3f126u, 0x5a89dba3c3efccfau, 0x986ddb5c6b3a76b7u, 0xf89629465a75e01cu,
+    0xbe89523386091465u, 0xf6bbb397f1135823u, 0xee2ba6c0678b597fu, 0x746aa07ded582e2cu,
+    0x94db483840b717efu, 0xa8c2a44eb4571cdcu, 0xba121a4650e4ddebu, 0x92f34d62616ce413u,
+    0xe896a0d7e51e1566u, 0x77b020baf9c81d17u, 0x915e2486ef32cd60u, 0x0ace1474dc1d122eu,
+    0xb5b5ada8aaff80b8u, 0x0d819992132456bau, 0xe3231912d5bf60e6u, 0x10e1fff697ed6c69u,
+    0x8df5efabc5979c8fu, 0xca8d3ffa1ef463c1u, 0xb1736b96b6fd83b3u, 0xbd308ff8a6b17cb2u,
+    0xddd0467c64bce4a0u, 0xac7cb3f6d05ddbdeu, 0x8aa22c0dbef60ee4u, 0x6bcdf07a423aa96bu,
+    0xad4ab7112eb3929du, 0x86c16c98d2c953c6u, 0xd89d64d57a607744u, 0xe871c7bf077ba8b7u,
+    0x87625f056c7c4a8bu, 0x11471cd764ad4972u, 0xa93af6c6c79b5d2du, 0xd598e40d3dd89bcfu,
+    0xd389b47879823479u, 0x4aff1d108d4ec2c3u, 0x843610cb4bf160cbu, 0xcedf722a585139bau,
+    0xa54394fe1eedb8feu, 0xc2974eb4ee658828u, 0xce947a3da6a9273eu, 0x733d226229feea32u,
+    0x811ccc668829b887u, 0x0806357d5a3f525fu, 0xa163ff802a3426a8u, 0xca07c2dcb0cf26f7u,
+    0xc9bcff6034c13052u, 0xfc89b393dd02f0b5u, 0xfc2c3f3841f17c67u, 0xbbac2078d443ace2u,
+    0x9d9ba7832936edc0u, 0xd54b944b84aa4c0du, 0xc5029163f384a931u, 0x0a9e795e65d4df11u,
+    0xf64335bcf065d37du, 0x4d4617b5ff4a16d5u, 0x99ea0196163fa42eu, 0x504bced1bf8e4e45u,
+    0xc06481fb9bcf8d39u, 0xe45ec2862f71e1d6u, 0xf07da27a82c37088u, 0x5d767327bb4e5a4cu,
+    0x964e858c91ba2655u, 0x3a6a07f8d510f86fu, 0xbbe226efb628afeau, 0x890489f70a55368bu,
+    0xeadab0aba3b2dbe5u, 0x2b45ac74ccea842eu, 0x92c8ae6b464fc96fu, 0x3b0b8bc90012929du,
+    0xb77ada0617e3bbcbu, 0x09ce6ebb40173744u, 0xe55990879ddcaabdu, 0xcc420a6a101d0515u,
+    0x8f57fa54c2a9eab6u, 0x9fa946824a12232du, 0xb32df8e9f3546564u, 0x47939822dc96abf9u,
+    0xdff9772470297ebdu, 0x59787e2b93bc56f7u, 0x8bfbea76c619ef36u, 0x57eb4edb3c55b65au,
+    0xaefae51477a06b03u, 0xede622920b6b23f1u, 0xdab99e59958885c4u, 0xe95fab368e45ecedu,
+    0x88b402f7fd75539bu, 0x11dbcb0218ebb414u, 0xaae103b5fcd2a881u, 0xd652bdc29f26a119u,
+    0xd59944a37c0752a2u, 0x4be76d3346f0495fu, 0x857fcae62d8493a5u, 0x6f70a4400c562ddbu,
+    0xa6dfbd9fb8e5b88eu, 0xcb4ccd500f6bb952u, 0xd097ad07a71f26b2u, 0x7e2000a41346a7a7u,
+    0x825ecc24c873782fu, 0x8ed400668c0c28c8u, 0xa2f67f2dfa90563bu, 0x728900802f0f32fau,
+    0xcbb41ef979346bcau, 0x4f2b40a03ad2ffb9u, 0xfea126b7d78186bcu, 0xe2f610c84987bfa8u,
+    0x9f24b832e6b0f436u, 0x0dd9ca7d2df4d7c9u, 0xc6ede63fa05d3143u, 0x91503d1c79720dbbu,
+    0xf8a95fcf88747d94u, 0x75a44c6397ce912au, 0x9b69dbe1b548ce7cu, 0xc986afbe3ee11abau,
+    0xc24452da229b021bu, 0xfbe85badce996168u, 0xf2d56790ab41c2a2u, 0xfae27299423fb9c3u,
+    0x97c560ba6b0919a5u, 0xdccd879fc967d41au, 0xbdb6b8e905cb600fu, 0x5400e987bbc1c920u,
+    0xed246723473e3813u, 0x290123e9aab23b68u, 0x9436c0760c86e30bu, 0xf9a0b6720aaf6521u,
+    0xb94470938fa89bceu, 0xf808e40e8d5b3e69u, 0xe7958cb87392c2c2u, 0xb60b1d1230b20e04u,
+    0x90bd77f3483bb9b9u, 0xb1c6f22b5e6f48c2u, 0xb4ecd5f01a4aa828u, 0x1e38aeb6360b1af3u,
+    0xe2280b6c20dd5232u, 0x25c6da63c38de1b0u, 0x8d590723948a535fu, 0x579c487e5a38ad0eu,
+    0xb0af48ec79ace837u, 0x2d835a9df0c6d851u, 0xdcdb1b2798182244u, 0xf8e431456cf88e65u,
+    0x8a08f0f8bf0f156bu, 0x1b8e9ecb641b58ffu, 0xac8b2d36eed2dac5u, 0xe272467e3d222f3fu,
+    0xd7adf884aa879177u, 0x5b0ed81dcc6abb0fu, 0x86ccbb52ea94baeau, 0x98e947129fc2b4e9u,
+    0xa87fea27a539e9a5u, 0x3f2398d747b36224u, 0xd29fe4b18e88640eu, 0x8eec7f0d19a03aadu,
+    0x83a3eeeef9153e89u, 0x1953cf68300424acu, 0xa48ceaaab75a8e2bu, 0x5fa8c3423c052dd7u,
+    0xcdb02555653131b6u, 0x3792f412cb06794du, 0x808e17555f3ebf11u, 0xe2bbd88bbee40bd0u,
+    0xa0b19d2ab70e6ed6u, 0x5b6aceaeae9d0ec4u, 0xc8de047564d20a8bu, 0xf245825a5a445275u,
+    0xfb158592be068d2eu, 0xeed6e2f0f0d56712u, 0x9ced737bb6c4183du, 0x55464dd69685606bu,
+    0xc428d05aa4751e4cu, 0xaa97e14c3c26b886u, 0xf53304714d9265dfu, 0xd53dd99f4b3066a8u,
+    0x993fe2c6d07b7fabu, 0xe546a8038efe4029u, 0xbf8fdb78849a5f96u, 0xde98520472bdd033u,
+    0xef73d256a5c0f77cu, 0x963e66858f6d4440u, 0x95a8637627989aadu, 0xdde7001379a44aa8u,
+    0xbb127c53b17ec159u, 0x5560c018580d5d52u, 0xe9d71b689dde71afu, 0xaab8f01e6e10b4a6u,
+    0x9226712162ab070du, 0xcab3961304ca70e8u, 0xb6b00d69bb55c8d1u, 0x3d607b97c5fd0d22u,
+    0xe45c10c42a2b3b05u, 0x8cb89a7db77c506au, 0x8eb98a7a9a5b04e3u, 0x77f3608e92adb242u,
+    0xb267ed1940f1c61cu, 0x55f038b237591ed3u, 0xdf01e85f912e37a3u, 0x6b6c46dec52f6688u,
+    0x8b61313bbabce2c6u, 0x2323ac4b3b3da015u, 0xae397d8aa96c1b77u, 0xabec975e0a0d081au,
+    0xd9c7dced53c72255u, 0x96e7bd358c904a21u, 0x881cea14545c7575u, 0x7e50d64177da2e54u,
+    0xaa242499697392d2u, 0xdde50bd1d5d0b9e9u, 0xd4ad2dbfc3d07787u, 0x955e4ec64b44e864u,
+    0x84ec3c97da624ab4u, 0xbd5af13bef0b113eu, 0xa6274bbdd0fadd61u, 0xecb1ad8aeacdd58eu,
+    0xcfb11ead453994bau, 0x67de18eda5814af2u, 0x81ceb32c4b43fcf4u, 0x80eacf948770ced7u,
+    0xa2425ff75e14fc31u, 0xa1258379a94d028du, 0xcad2f7f5359a3b3eu, 0x096ee45813a04330u,
+    0xfd87b5f28300ca0du, 0x8bca9d6e188853fcu, 0x9e74d1b791e07e48u, 0x775ea264cf55347eu,
+    0xc612062576589ddau, 0x95364afe032a819eu, 0xf79687aed3eec551u, 0x3a83ddbd83f52205u,
+    0x9abe14cd44753b52u, 0xc4926a9672793543u, 0xc16d9a0095928a27u, 0x75b7053c0f178294u,
+    0xf1c90080baf72cb1u, 0x5324c68b12dd6339u, 0x971da05074da7beeu, 0xd3f6fc16ebca5e04u,
+    0xbce5086492111aeau, 0x88f4bb1ca6bcf585u, 0xec1e4a7db69561a5u, 0x2b31e9e3d06c32e6u,
+    0x9392ee8e921d5d07u, 0x3aff322e62439fd0u, 0xb877aa3236a4b449u, 0x09befeb9fad487c3u,
+    0xe69594bec44de15bu, 0x4c2ebe687989a9b4u, 0x901d7cf73ab0acd9u, 0x0f9d37014bf60a11u,
+    0xb424dc35095cd80fu, 0x538484c19ef38c95u, 0xe12e13424bb40e13u, 0x2865a5f206b06fbau,
+    0x8cbccc096f5088cbu, 0xf93f87b7442e45d4u, 0xafebff0bcb24aafeu, 0xf78f69a51539d749u,
+    0xdbe6fecebdedd5beu, 0xb573440e5a884d1cu, 0x89705f4136b4a597u, 0x31680a88f8953031u,
+    0xabcc77118461cefcu, 0xfdc20d2b36ba7c3eu, 0xd6bf94d5e57a42bcu, 0x3d32907604691b4du,
+    0x8637bd05af6c69b5u, 0xa63f9a49c2c1b110u, 0xa7c5ac471b478423u, 0x0fcf80dc33721d54u,
+    0xd1b71758e219652bu, 0xd3c36113404ea4a9u, 0x83126e978d4fdf3bu, 0x645a1cac083126eau,
+    0xa3d70a3d70a3d70au, 0x3d70a3d70a3d70a4u, 0xccccccccccccccccu, 0xcccccccccccccccdu,
+    0x8000000000000000u, 0x0000000000000000u, 0xa000000000000000u, 0x0000000000000000u,
+    0xc800000000000000u, 0x0000000000000000u, 0xfa00000000000000u, 0x0000000000000000u,
+    0x9c40000000000000u, 0x0000000000000000u, 0xc350000000000000u, 0x0000000000000000u,
+    0xf424000000000000u, 0x0000000000000000u, 0x9896800000000000u, 0x0000000000000000u,
+    0xbebc200000000000u, 0x0000000000000000u, 0xee6b280000000000u, 0x0000000000000000u,
+    0x9502f90000000000u, 0x0000000000000000u, 0xba43b74000000000u, 0x0000000000000000u,
+    0xe8d4a51000000000u, 0x0000000000000000u, 0x9184e72a00000000u, 0x0000000000000000u,
+    0xb5e620f480000000u, 0x0000000000000000u, 0xe35fa931a0000000u, 0x0000000000000000u,
+    0x8e1bc9bf04000000u, 0x0000000000000000u, 0xb1a2bc2ec5000000u, 0x0000000000000000u,
+    0xde0b6b3a76400000u, 0x0000000000000000u, 0x8ac7230489e80000u, 0x0000000000000000u,
+    0xad78ebc5ac620000u, 0x0000000000000000u, 0xd8d726b7177a8000u, 0x0000000000000000u,
+    0x878678326eac9000u, 0x0000000000000000u, 0xa968163f0a57b400u, 0x0000000000000000u,
+    0xd3c21bcecceda100u, 0x0000000000000000u, 0x84595161401484a0u, 0x0000000000000000u,
+    0xa56fa5b99019a5c8u, 0x0000000000000000u, 0xcecb8f27f4200f3au, 0x0000000000000000u,
+    0x813f3978f8940984u, 0x4000000000000000u, 0xa18f07d736b90be5u, 0x5000000000000000u,
+    0xc9f2c9cd04674edeu, 0xa400000000000000u, 0xfc6f7c4045812296u, 0x4d00000000000000u,
+    0x9dc5ada82b70b59du, 0xf020000000000000u, 0xc5371912364ce305u, 0x6c28000000000000u,
+    0xf684df56c3e01bc6u, 0xc732000000000000u, 0x9a130b963a6c115cu, 0x3c7f400000000000u,
+    0xc097ce7bc90715b3u, 0x4b9f100000000000u, 0xf0bdc21abb48db20u, 0x1e86d40000000000u,
+    0x96769950b50d88f4u, 0x1314448000000000u, 0xbc143fa4e250eb31u, 0x17d955a000000000u,
+    0xeb194f8e1ae525fdu, 0x5dcfab0800000000u, 0x92efd1b8d0cf37beu, 0x5aa1cae500000000u,
+    0xb7abc627050305adu, 0xf14a3d9e40000000u, 0xe596b7b0c643c719u, 0x6d9ccd05d0000000u,
+    0x8f7e32ce7bea5c6fu, 0xe4820023a2000000u, 0xb35dbf821ae4f38bu, 0xdda2802c8a800000u,
+    0xe0352f62a19e306eu, 0xd50b2037ad200000u, 0x8c213d9da502de45u, 0x4526f422cc340000u,
+    0xaf298d050e4395d6u, 0x9670b12b7f410000u, 0xdaf3f04651d47b4cu, 0x3c0cdd765f114000u,
+    0x88d8762bf324cd0fu, 0xa5880a69fb6ac800u, 0xab0e93b6efee0053u, 0x8eea0d047a457a00u,
+    0xd5d238a4abe98068u, 0x72a4904598d6d880u, 0x85a36366eb71f041u, 0x47a6da2b7f864750u,
+    0xa70c3c40a64e6c51u, 0x999090b65f67d924u, 0xd0cf4b50cfe20765u, 0xfff4b4e3f741cf6du,
+    0x82818f1281ed449fu, 0xbff8f10e7a8921a4u, 0xa321f2d7226895c7u, 0xaff72d52192b6a0du,
+    0xcbea6f8ceb02bb39u, 0x9bf4f8a69f764490u, 0xfee50b7025c36a08u, 0x02f236d04753d5b4u,
+    0x9f4f2726179a2245u, 0x01d762422c946590u, 0xc722f0ef9d80aad6u, 0x424d3ad2b7b97ef5u,
+    0xf8ebad2b84e0d58bu, 0xd2e0898765a7deb2u, 0x9b934c3b330c8577u, 0x63cc55f49f88eb2fu,
+    0xc2781f49ffcfa6d5u, 0x3cbf6b71c76b25fbu, 0xf316271c7fc3908au, 0x8bef464e3945ef7au,
+    0x97edd871cfda3a56u, 0x97758bf0e3cbb5acu, 0xbde94e8e43d0c8ecu, 0x3d52eeed1cbea317u,
+    0xed63a231d4c4fb27u, 0x4ca7aaa863ee4bddu, 0x945e455f24fb1cf8u, 0x8fe8caa93e74ef6au,
+    0xb975d6b6ee39e436u, 0xb3e2fd538e122b44u, 0xe7d34c64a9c85d44u, 0x60dbbca87196b616u,
+    0x90e40fbeea1d3a4au, 0xbc8955e946fe31cdu, 0xb51d13aea4a488ddu, 0x6babab6398bdbe41u,
+    0xe264589a4dcdab14u, 0xc696963c7eed2dd1u, 0x8d7eb76070a08aecu, 0xfc1e1de5cf543ca2u,
+    0xb0de65388cc8ada8u, 0x3b25a55f43294bcbu, 0xdd15fe86affad912u, 0x49ef0eb713f39ebeu,
+    0x8a2dbf142dfcc7abu, 0x6e3569326c784337u, 0xacb92ed9397bf996u, 0x49c2c37f07965404u,
+    0xd7e77a8f87daf7fbu, 0xdc33745ec97be906u, 0x86f0ac99b4e8dafdu, 0x69a028bb3ded71a3u,
+    0xa8acd7c0222311bcu, 0xc40832ea0d68ce0cu, 0xd2d80db02aabd62bu, 0xf50a3fa490c30190u,
+    0x83c7088e1aab65dbu, 0x792667c6da79e0fau, 0xa4b8cab1a1563f52u, 0x577001b891185938u,
+    0xcde6fd5e09abcf26u, 0xed4c0226b55e6f86u, 0x80b05e5ac60b6178u, 0x544f8158315b05b4u,
+    0xa0dc75f1778e39d6u, 0x696361ae3db1c721u, 0xc913936dd571c84cu, 0x03bc3a19cd1e38e9u,
+    0xfb5878494ace3a5fu, 0x04ab48a04065c723u, 0x9d174b2dcec0e47bu, 0x62eb0d64283f9c76u,
+    0xc45d1df942711d9au, 0x3ba5d0bd324f8394u, 0xf5746577930d6500u, 0xca8f44ec7ee36479u,
+    0x9968bf6abbe85f20u, 0x7e998b13cf4e1ecbu, 0xbfc2ef456ae276e8u, 0x9e3fedd8c321a67eu,
+    0xefb3ab16c59b14a2u, 0xc5cfe94ef3ea101eu, 0x95d04aee3b80ece5u, 0xbba1f1d158724a12u,
+    0xbb445da9ca61281fu, 0x2a8a6e45ae8edc97u, 0xea1575143cf97226u, 0xf52d09d71a3293bdu,
+    0x924d692ca61be758u, 0x593c2626705f9c56u, 0xb6e0c377cfa2e12eu, 0x6f8b2fb00c77836cu,
+    0xe498f455c38b997au, 0x0b6dfb9c0f956447u, 0x8edf98b59a373fecu, 0x4724bd4189bd5eacu,
+    0xb2977ee300c50fe7u, 0x58edec91ec2cb657u, 0xdf3d5e9bc0f653e1u, 0x2f2967b66737e3edu,
+    0x8b865b215899f46cu, 0xbd79e0d20082ee74u, 0xae67f1e9aec07187u, 0xecd8590680a3aa11u,
+    0xda01ee641a708de9u, 0xe80e6f4820cc9495u, 0x884134fe908658b2u, 0x3109058d147fdcddu,
+    0xaa51823e34a7eedeu, 0xbd4b46f0599fd415u, 0xd4e5e2cdc1d1ea96u, 0x6c9e18ac7007c91au,
+    0x850fadc09923329eu, 0x03e2cf6bc604ddb0u, 0xa6539930bf6bff45u, 0x84db8346b786151cu,
+    0xcfe87f7cef46ff16u, 0xe612641865679a63u, 0x81f14fae158c5f6eu, 0x4fcb7e8f3f60c07eu,
+    0xa26da3999aef7749u, 0xe3be5e330f38f09du, 0xcb090c8001ab551cu, 0x5cadf5bfd3072cc5u,
+    0xfdcb4fa002162a63u, 0x73d9732fc7c8f7f6u, 0x9e9f11c4014dda7eu, 0x2867e7fddcdd9afau,
+    0xc646d63501a1511du, 0xb281e1fd541501b8u, 0xf7d88bc24209a565u, 0x1f225a7ca91a4226u,
+    0x9ae757596946075fu, 0x3375788de9b06958u, 0xc1a12d2fc3978937u, 0x0052d6b1641c83aeu,
+    0xf209787bb47d6b84u, 0xc0678c5dbd23a49au, 0x9745eb4d50ce6332u, 0xf840b7ba963646e0u,
+    0xbd176620a501fbffu, 0xb650e5a93bc3d898u, 0xec5d3fa8ce427affu, 0xa3e51f138ab4cebeu,
+    0x93ba47c980e98cdfu, 0xc66f336c36b10137u, 0xb8a8d9bbe123f017u, 0xb80b0047445d4184u,
+    0xe6d3102ad96cec1du, 0xa60dc059157491e5u, 0x9043ea1ac7e41392u, 0x87c89837ad68db2fu,
+    0xb454e4a179dd1877u, 0x29babe4598c311fbu, 0xe16a1dc9d8545e94u, 0xf4296dd6fef3d67au,
+    0x8ce2529e2734bb1du, 0x1899e4a65f58660cu, 0xb01ae745b101e9e4u, 0x5ec05dcff72e7f8fu,
+    0xdc21a1171d42645du, 0x76707543f4fa1f73u, 0x899504ae72497ebau, 0x6a06494a791c53a8u,
+    0xabfa45da0edbde69u, 0x0487db9d17636892u, 0xd6f8d7509292d603u, 0x45a9d2845d3c42b6u,
+    0x865b86925b9bc5c2u, 0x0b8a2392ba45a9b2u, 0xa7f26836f282b732u, 0x8e6cac7768d7141eu,
+    0xd1ef0244af2364ffu, 0x3207d795430cd926u, 0x8335616aed761f1fu, 0x7f44e6bd49e807b8u,
+    0xa402b9c5a8d3a6e7u, 0x5f16206c9c6209a6u, 0xcd036837130890a1u, 0x36dba887c37a8c0fu,
+    0x802221226be55a64u, 0xc2494954da2c9789u, 0xa02aa96b06deb0fdu, 0xf2db9baa10b7bd6cu,
+    0xc83553c5c8965d3du, 0x6f92829494e5acc7u, 0xfa42a8b73abbf48cu, 0xcb772339ba1f17f9u,
+    0x9c69a97284b578d7u, 0xff2a760414536efbu, 0xc38413cf25e2d70du, 0xfef5138519684abau,
+    0xf46518c2ef5b8cd1u, 0x7eb258665fc25d69u, 0x98bf2f79d5993802u, 0xef2f773ffbd97a61u,
+    0xbeeefb584aff8603u, 0xaafb550ffacfd8fau, 0xeeaaba2e5dbf6784u, 0x95ba2a53f983cf38u,
+    0x952ab45cfa97a0b2u, 0xdd945a747bf26183u, 0xba756174393d88dfu, 0x94f971119aeef9e4u,
+    0xe912b9d1478ceb17u, 0x7a37cd5601aab85du, 0x91abb422ccb812eeu, 0xac62e055c10ab33au,
+    0xb616a12b7fe617aau, 0x577b986b314d6009u, 0xe39c49765fdf9d94u, 0xed5a7e85fda0b80bu,
+    0x8e41ade9fbebc27du, 0x14588f13be847307u, 0xb1d219647ae6b31cu, 0x596eb2d8ae258fc8u,
+    0xde469fbd99a05fe3u, 0x6fca5f8ed9aef3bbu, 0x8aec23d680043beeu, 0x25de7bb9480d5854u,
+    0xada72ccc20054ae9u, 0xaf561aa79a10ae6au, 0xd910f7ff28069da4u, 0x1b2ba1518094da04u,
+    0x87aa9aff79042286u, 0x90fb44d2f05d0842u, 0xa99541bf57452b28u, 0x353a1607ac744a53u,
+    0xd3fa922f2d1675f2u, 0x42889b8997915ce8u, 0x847c9b5d7c2e09b7u, 0x69956135febada11u,
+    0xa59bc234db398c25u, 0x43fab9837e699095u, 0xcf02b2c21207ef2eu, 0x94f967e45e03f4bbu,
+    0x8161afb94b44f57du, 0x1d1be0eebac278f5u, 0xa1ba1ba79e1632dcu, 0x6462d92a69731732u,
+    0xca28a291859bbf93u, 0x7d7b8f7503cfdcfeu, 0xfcb2cb35e702af78u, 0x5cda735244c3d43eu,
+    0x9defbf01b061adabu, 0x3a0888136afa64a7u, 0xc56baec21c7a1916u, 0x088aaa1845b8fdd0u,
+    0xf6c69a72a3989f5bu, 0x8aad549e57273d45u, 0x9a3c2087a63f6399u, 0x36ac54e2f678864bu,
+    0xc0cb28a98fcf3c7fu, 0x84576a1bb416a7ddu, 0xf0fdf2d3f3c30b9fu, 0x656d44a2a11c51d5u,
+    0x969eb7c47859e743u, 0x9f644ae5a4b1b325u, 0xbc4665b596706114u, 0x873d5d9f0dde1feeu,
+    0xeb57ff22fc0c7959u, 0xa90cb506d155a7eau, 0x9316ff75dd87cbd8u, 0x09a7f12442d588f2u,
+    0xb7dcbf5354e9beceu, 0x0c11ed6d538aeb2fu, 0xe5d3ef282a242e81u, 0x8f1668c8a86da5fau,
+    0x8fa475791a569d10u, 0xf96e017d694487bcu, 0xb38d92d760ec4455u, 0x37c981dcc395a9acu,
+    0xe070f78d3927556au, 0x85bbe253f47b1417u, 0x8c469ab843b89562u, 0x93956d7478ccec8eu,
+    0xaf58416654a6babbu, 0x387ac8d1970027b2u, 0xdb2e51bfe9d0696au, 0x06997b05fcc0319eu,
+    0x88fcf317f22241e2u, 0x441fece3bdf81f03u, 0xab3c2fddeeaad25au, 0xd527e81cad7626c3u,
+    0xd60b3bd56a5586f1u, 0x8a71e223d8d3b074u, 0x85c7056562757456u, 0xf6872d5667844e49u,
+    0xa738c6bebb12d16cu, 0xb428f8ac016561dbu, 0xd106f86e69d785c7u, 0xe13336d701beba52u,
+    0x82a45b450226b39cu, 0xecc0024661173473u, 0xa34d721642b06084u, 0x27f002d7f95d0190u,
+    0xcc20ce9bd35c78a5u, 0x31ec038df7b441f4u, 0xff290242c83396ceu, 0x7e67047175a15271u,
+    0x9f79a169bd203e41u, 0x0f0062c6e984d386u, 0xc75809c42c684dd1u, 0x52c07b78a3e60868u,
+    0xf92e0c3537826145u, 0xa7709a56ccdf8a82u, 0x9bbcc7a142b17ccbu, 0x88a66076400bb691u,
+    0xc2abf989935ddbfeu, 0x6acff893d00ea435u, 0xf356f7ebf83552feu, 0x0583f6b8c4124d43u,
+    0x98165af37b2153deu, 0xc3727a337a8b704au, 0xbe1bf1b059e9a8d6u, 0x744f18c0592e4c5cu,
+    0xeda2ee1c7064130cu, 0x1162def06f79df73u, 0x9485d4d1c63e8be7u, 0x8addcb5645ac2ba8u,
+    0xb9a74a0637ce2ee1u, 0x6d953e2bd7173692u, 0xe8111c87c5c1ba99u, 0xc8fa8db6ccdd0437u,
+    0x910ab1d4db9914a0u, 0x1d9c9892400a22a2u, 0xb54d5e4a127f59c8u, 0x2503beb6d00cab4bu,
+    0xe2a0b5dc971f303au, 0x2e44ae64840fd61du, 0x8da471a9de737e24u, 0x5ceaecfed289e5d2u,
+    0xb10d8e1456105dadu, 0x7425a83e872c5f47u, 0xdd50f1996b947518u, 0xd12f124e28f77719u,
+    0x8a5296ffe33cc92fu, 0x82bd6b70d99aaa6fu, 0xace73cbfdc0bfb7bu, 0x636cc64d1001550bu,
+    0xd8210befd30efa5au, 0x3c47f7e05401aa4eu, 0x8714a775e3e95c78u, 0x65acfaec34810a71u,
+    0xa8d9d1535ce3b396u, 0x7f1839a741a14d0du, 0xd31045a8341ca07cu, 0x1ede48111209a050u,
+    0x83ea2b892091e44du, 0x934aed0aab460432u, 0xa4e4b66b68b65d60u, 0xf81da84d5617853fu,
+    0xce1de40642e3f4b9u, 0x36251260ab9d668eu, 0x80d2ae83e9ce78f3u, 0xc1d72b7c6b426019u,
+    0xa1075a24e4421730u, 0xb24cf65b8612f81fu, 0xc94930ae1d529cfcu, 0xdee033f26797b627u,
+    0xfb9b7cd9a4a7443cu, 0x169840ef017da3b1u, 0x9d412e0806e88aa5u, 0x8e1f289560ee864eu,
+    0xc491798a08a2ad4eu, 0xf1a6f2bab92a27e2u, 0xf5b5d7ec8acb58a2u, 0xae10af696774b1dbu,
+    0x9991a6f3d6bf1765u, 0xacca6da1e0a8ef29u, 0xbff610b0cc6edd3fu, 0x17fd090a58d32af3u,
+    0xeff394dcff8a948eu, 0xddfc4b4cef07f5b0u, 0x95f83d0a1fb69cd9u, 0x4abdaf101564f98eu,
+    0xbb764c4ca7a4440fu, 0x9d6d1ad41abe37f1u, 0xea53df5fd18d5513u, 0x84c86189216dc5edu,
+    0x92746b9be2f8552cu, 0x32fd3cf5b4e49bb4u, 0xb7118682dbb66a77u, 0x3fbc8c33221dc2a1u,
+    0xe4d5e82392a40515u, 0x0fabaf3feaa5334au, 0x8f05b1163ba6832du, 0x29cb4d87f2a7400eu,
+    0xb2c71d5bca9023f8u, 0x743e20e9ef511012u, 0xdf78e4b2bd342cf6u, 0x914da9246b255416u,
+    0x8bab8eefb6409c1au, 0x1ad089b6c2f7548eu, 0xae9672aba3d0c320u, 0xa184ac2473b529b1u,
+    0xda3c0f568cc4f3e8u, 0xc9e5d72d90a2741eu, 0x8865899617fb1871u, 0x7e2fa67c7a658892u,
+    0xaa7eebfb9df9de8du, 0xddbb901b98feeab7u, 0xd51ea6fa85785631u, 0x552a74227f3ea565u,
+    0x8533285c936b35deu, 0xd53a88958f87275fu, 0xa67ff273b8460356u, 0x8a892abaf368f137u,
+    0xd01fef10a657842cu, 0x2d2b7569b0432d85u, 0x8213f56a67f6b29bu, 0x9c3b29620e29fc73u,
+    0xa298f2c501f45f42u, 0x8349f3ba91b47b8fu, 0xcb3f2f7642717713u, 0x241c70a936219a73u,
+    0xfe0efb53d30dd4d7u, 0xed238cd383aa0110u, 0x9ec95d1463e8a506u, 0xf4363804324a40aau,
+    0xc67bb4597ce2ce48u, 0xb143c6053edcd0d5u, 0xf81aa16fdc1b81dau, 0xdd94b7868e94050au,
+    0x9b10a4e5e9913128u, 0xca7cf2b4191c8326u, 0xc1d4ce1f63f57d72u, 0xfd1c2f611f63a3f0u,
+    0xf24a01a73cf2dccfu, 0xbc633b39673c8cecu, 0x976e41088617ca01u, 0xd5be0503e085d813u,
+    0xbd49d14aa79dbc82u, 0x4b2d8644d8a74e18u, 0xec9c459d51852ba2u, 0xddf8e7d60ed1219eu,
+    0x93e1ab8252f33b45u, 0xcabb90e5c942b503u, 0xb8da1662e7b00a17u, 0x3d6a751f3b936243u,
+    0xe7109bfba19c0c9du, 0x0cc512670a783ad4u, 0x906a617d450187e2u, 0x27fb2b80668b24c5u,
+    0xb484f9dc9641e9dau, 0xb1f9f660802dedf6u, 0xe1a63853bbd26451u, 0x5e7873f8a0396973u,
+    0x8d07e33455637eb2u, 0xdb0b487b6423e1e8u, 0xb049dc016abc5e5fu, 0x91ce1a9a3d2cda62u,
+    0xdc5c5301c56b75f7u, 0x7641a140cc7810fbu, 0x89b9b3e11b6329bau, 0xa9e904c87fcb0a9du,
+    0xac2820d9623bf429u, 0x546345fa9fbdcd44u, 0xd732290fbacaf133u, 0xa97c177947ad4095u,
+    0x867f59a9d4bed6c0u, 0x49ed8eabcccc485du, 0xa81f301449ee8c70u, 0x5c68f256bfff5a74u,
+    0xd226fc195c6a2f8cu, 0x73832eec6fff3111u, 0x83585d8fd9c25db7u, 0xc831fd53c5ff7eabu,
+    0xa42e74f3d032f525u, 0xba3e7ca8b77f5e55u, 0xcd3a1230c43fb26fu, 0x28ce1bd2e55f35ebu,
+    0x80444b5e7aa7cf85u, 0x7980d163cf5b81b3u, 0xa0555e361951c366u, 0xd7e105bcc332621fu,
+    0xc86ab5c39fa63440u, 0x8dd9472bf3fefaa7u, 0xfa856334878fc150u, 0xb14f98f6f0feb951u,
+    0x9c935e00d4b9d8d2u, 0x6ed1bf9a569f33d3u, 0xc3b8358109e84f07u, 0x0a862f80ec4700c8u,
+    0xf4a642e14c6262c8u, 0xcd27bb612758c0fau, 0x98e7e9cccfbd7dbdu, 0x8038d51cb897789cu,
+    0xbf21e44003acdd2cu, 0xe0470a63e6bd56c3u, 0xeeea5d5004981478u, 0x1858ccfce06cac74u,
+    0x95527a5202df0ccbu, 0x0f37801e0c43ebc8u, 0xbaa718e68396cffdu, 0xd30560258f54e6bau,
+    0xe950df20247c83fdu, 0x47c6b82ef32a2069u, 0x91d28b7416cdd27eu, 0x4cdc331d57fa5441u,
+    0xb6472e511c81471du, 0xe0133fe4adf8e952u, 0xe3d8f9e563a198e5u, 0x58180fddd97723a6u,
+    0x8e679c2f5e44ff8fu, 0x570f09eaa7ea7648u
+};
+
+static inline uint64_t neat_mul128(uint64_t a, uint64_t b, uint64_t *hi)
+{
+#ifdef __SIZEOF_INT128__
+    unsigned __int128 r = (unsigned __int128) a * b;
+    *hi = (uint64_t) (r >> 64);
+    return (uint64_t) r;
+#else
+    uint64_t a_lo = (uint32_t) a, a_hi = a >> 32;
+    uint64_t b_lo = (uint32_t) b, b_hi = b >> 32;
+    uint64_t p00 = a_lo * b_lo, p01 = a_lo * b_hi;
+    uint64_t p10 = a_hi * b_lo, p11 = a_hi * b_hi;
+    uint64_t mid = (p00 >> 32) + (uint32_t) p01 + (uint32_t) p10;
+    *hi = p11 + (p01 >> 32) + (p10 >> 32) + (mid >> 32);
+    return (mid << 32) | (uint32_t) p00;
+#endif
+}
+
+// returns the biased exponent in *power2 (or -1 if it couldn't be computed) and the mantissa without the implicit bit
+static uint64_t neat_eisel_lemire(int64_t q, uint64_t w, const neat_float_info *info, int32_t *power2)
+{
+    if(w == 0 || q < info->smallest_pow10)
+    {
+        *power2 = 0;
+        return 0;
+    }
+    if(q > info->largest_pow10)
+    {
+        *power2 = info->infinite_power;
+        return 0;
+    }
+    
+    int lz = 64 - neat_bit_length(w);
+    w <<= lz;
+    
+    // only the bits needed for the mantissa, a rounding bit and a possible
+    // shift are required, the second half of 5^q is only used when they're all ones.
+    int index = 2 * (int) (q - (-342));
+    uint64_t hi;
+    uint64_t lo = neat_mul128(w, neat_pow5_128[index], &hi);
+    uint64_t precision_mask = UINT64_MAX >> (info->mantissa_bits + 3);
+    if((hi & precision_mask) == precision_mask)
+    {
+        uint64_t hi2;
+        neat_mul128(w, neat_pow5_128[index + 1], &hi2);
+        lo += hi2;
+        hi += hi2 > lo;
+    }
+    
+    int upperbit = (int) (hi >> 63);
+    int shift = upperbit + 64 - info->mantissa_bits - 3;
+    uint64_t mantissa = hi >> shift;
+    // floor(log2(10^q)) + 63
+    int32_t p2 = (int32_t) ((((152170 + 65536) * q) >> 16) + 63) + upperbit - lz - info->minimum_exponent;
+    
+    if(p2 <= 0)
+    {
+        // subnormal
+        if(-p2 + 1 >= 64)
+        {
+            *power2 = 0;
+            return 0;
+        }
+        mantissa >>= -p2 + 1;
+        mantissa += mantissa & 1;
+        mantissa >>= 1;
+        // rounding up might have made it a normal number
+        *power2 = mantissa < (1ull << info->mantissa_bits) ? 0 : 1;
+        return mantissa & ((1ull << info->mantissa_bits) - 1);
+    }
+    
+    // exactly halfway between two floats, round to even instead of up.
+    // only possible when 5^q fits in 64 bits.
+    if(lo <= 1 && q >= info->min_round_to_even && q <= info->max_round_to_even &&
+       (mantissa & 3) == 1 && (mantissa << shift) == hi)
+    {
+        mantissa &= ~1ull;
+    }
+    
+    mantissa += mantissa & 1;
+    mantissa >>= 1;
+    if(mantissa >= (2ull << info->mantissa_bits))
+    {
+        mantissa = 1ull << info->mantissa_bits;
+        p2++;
+    }
+    mantissa &= ~(1ull << info->mantissa_bits);
+    if(p2 >= info->infinite_power)
+    {
+        p2 = info->infinite_power;
+        mantissa = 0;
+    }
+    *power2 = p2;
+    return mantissa;
+}
+
+/*
+    Exact fallback: the digits are kept as a big decimal and scaled by
+    powers of two until the mantissa bits can be read off as an integer
+    (the same approach as Go's strconv). 800 digits are enough to decide
+    the rounding, anything past that is only remembered as nonzero.
+*/
+
+#define NEAT_DECIMAL_DIGITS 800
+#define NEAT_DECIMAL_MAX_SHIFT 60
+
+typedef struct neat_decimal
+{
+    uint8_t d[NEAT_DECIMAL_DIGITS];
+    int nd;     // number of digits used
+    int dp;     // position of the decimal point
+    bool trunc; // nonzero digits were dropped
+} neat_decimal;
+
+static void neat_decimal_trim(neat_decimal *a)
+{
+    while(a->nd > 0 && a->d[a->nd - 1] == 0) a->nd--;
+    if(a->nd == 0) a->dp = 0;
+}
+
+static void neat_decimal_lshift(neat_decimal *a, unsigned k)
+{
+    uint8_t tmp[NEAT_DECIMAL_DIGITS + 20];
+    int w = (int) sizeof(tmp);
+    uint64_t n = 0;
+    for(int r = a->nd - 1 ; r >= 0 ; r--)
+    {
+        n += (uint64_t) a->d[r] << k;
+        uint64_t quo = n / 10;
+        tmp[--w] = (uint8_t) (n - quo * 10);
+        n = quo;
+    }
+    while(n > 0)
+    {
+        uint64_t quo = n / 10;
+        tmp[--w] = (uint8_t) (n - quo * 10);
+        n = quo;
+    }
+    
+    int produced = (int) sizeof(tmp) - w;
+    a->dp += produced - a->nd;
+    int nd = produced < NEAT_DECIMAL_DIGITS ? produced : NEAT_DECIMAL_DIGITS;
+    for(int i = nd ; i < produced ; i++)
+        a->trunc |= tmp[w + i] != 0;
+    memcpy(a->d, tmp + w, nd);
+    a->nd = nd;
+    neat_decimal_trim(a);
+}
+
+static void neat_decimal_rshift(neat_decimal *a, unsigned k)
+{
+    int r = 0, w = 0;
+    uint64_t n = 0;
+    
+    // pick up enough leading digits to cover the first shift
+    for( ; (n >> k) == 0 ; r++)
+    {
+        if(r >= a->nd)
+        {
+            if(n == 0)
+            {
+                a->nd = 0;
+                return;
+            }
+            while((n >> k) == 0)
+            {
+                n *= 10;
+                r++;
+            }
+            break;
+        }
+        n = n * 10 + a->d[r];
+    }
+    a->dp -= r - 1;
+    
+    uint64_t mask = (1ull << k) - 1;
+    for( ; r < a->nd ; r++)
+    {
+        uint64_t c = a->d[r];
+        a->d[w++] = (uint8_t) (n >> k);
+        n = (n & mask) * 10 + c;
+    }
+    while(n > 0)
+    {
+        uint64_t dig = n >> k;
+        n &= mask;
+        if(w < NEAT_DECIMAL_DIGITS)
+            a->d[w++] = (uint8_t) dig;
+        else if(dig > 0)
+            a->trunc = true;
+        n *= 10;
+    }
+    a->nd = w;
+    neat_decimal_trim(a);
+}
+
+static void neat_decimal_shift(neat_decimal *a, int k)
+{
+    if(a->nd == 0) return;
+    for( ; k > NEAT_DECIMAL_MAX_SHIFT ; k -= NEAT_DECIMAL_MAX_SHIFT)
+        neat_decimal_lshift(a, NEAT_DECIMAL_MAX_SHIFT);
+    for( ; k < -NEAT_DECIMAL_MAX_SHIFT ; k += NEAT_DECIMAL_MAX_SHIFT)
+        neat_decimal_rshift(a, NEAT_DECIMAL_MAX_SHIFT);
+    if(k > 0) neat_decimal_lshift(a, (unsigned) k);
+    if(k < 0) neat_decimal_rshift(a, (unsigned) -k);
+}
+
+static uint64_t neat_decimal_rounded_integer(neat_decimal *a)
+{
+    if(a->dp > 20) return UINT64_MAX;
+    
+    uint64_t n = 0;
+    int i = 0;
+    for( ; i < a->dp && i < a->nd ; i++) n = n * 10 + a->d[i];
+    for( ; i < a->dp ; i++) n *= 10;
+    
+    int nd = a->dp;
+    if(nd >= 0 && nd < a->nd)
+    {
+        bool up;
+        if(a->d[nd] == 5 && nd + 1 == a->nd)
+            up = a->trunc || (nd > 0 && a->d[nd - 1] % 2 == 1); // halfway, round to even
+        else
+            up = a->d[nd] >= 5;
+        n += up;
+    }
+    return n;
+}
+
+// same contract as neat_eisel_lemire, digits are the chars of the number without sign
+static uint64_t neat_decimal_to_float(const char *digits, const char *lim, int64_t exp10, const neat_float_info *info, int32_t *power2)
+{
+    static const int powtab[] = { 1, 3, 6, 9, 13, 16, 19, 23, 26 };
+    int exp_bits = info->exponent_bits;
+    int bias = info->minimum_exponent;
+    
+    neat_decimal dec = { .nd = 0 };
+    neat_decimal *a = &dec;
+    bool dot = false;
+    for(const char *p = digits ; neat_is_digit(neat_peek(p, lim)) || (neat_peek(p, lim) == '.' && !dot) ; p++)
+    {
+        if(*p == '.')
+        {
+            dot = true;
+            a->dp = a->nd;
+            continue;
+        }
+        uint8_t c = (uint8_t) (*p - '0');
+        if(c == 0 && a->nd == 0)
+        {
+            a->dp--;
+            continue;
+        }
+        if(a->nd < NEAT_DECIMAL_DIGITS)
+            a->d[a->nd++] = c;
+        else if(c != 0)
+            a->trunc = true;
+    }
+    if(!dot) a->dp = a->nd;
+    neat_decimal_trim(a);
+    
+    if(a->nd == 0)
+    {
+        *power2 = 0;
+        return 0;
+    }
+    int64_t dp = a->dp + exp10;
+    if(dp > 310)
+    {
+        *power2 = info->infinite_power;
+        return 0;
+    }
+    if(dp < -330)
+    {
+        *power2 = 0;
+        return 0;
+    }
+    a->dp = (int) dp;
+    
+    // scale into [0.5, 1)
+    int exp = 0;
+    while(a->dp > 0)
+    {
+        int n = a->dp >= 9 ? 27 : powtab[a->dp];
+        neat_decimal_shift(a, -n);
+        exp += n;
+    }
+    while(a->dp < 0 || (a->dp == 0 && a->d[0] < 5))
+    {
+        int n = -a->dp >= 9 ? 27 : powtab[-a->dp];
+        neat_decimal_shift(a, n);
+        exp -= n;
+    }
+    exp--;
+    
+    if(exp < bias + 1)
+    {
+        int n = bias + 1 - exp;
+        neat_decimal_shift(a, -n);
+        exp += n;
+    }
+    if(exp - bias >= (1 << exp_bits) - 1)
+    {
+        *power2 = info->infinite_power;
+        return 0;
+    }
+    
+    neat_decimal_shift(a, 1 + info->mantissa_bits);
+    uint64_t mant = neat_decimal_rounded_integer(a);
+    if(mant == (2ull << info->mantissa_bits))
+    {
+        mant >>= 1;
+        exp++;
+        if(exp - bias >= (1 << exp_bits) - 1)
+        {
+            *power2 = info->infinite_power;
+            return 0;
+        }
+    }
+    if((mant & (1ull << info->mantissa_bits)) == 0)
+        exp = bias;
+    
+    *power2 = exp - bias;
+    return mant & ((1ull << info->mantissa_bits) - 1);
+}
+
+static bool neat_match_word(const char **p, const char *lim, const char *word)
+{
+    size_t i = 0;
+    for( ; word[i] ; i++)
+        if((neat_peek(*p + i, lim) | 0x20) != word[i]) return false;
+    *p += i;
+    return true;
+}
+
+/*
+    Parses a float into the bits of the type described by info. Returns
+    false if there's no number, otherwise sets *end_out past it.
+*/
+static bool neat_parse_float_bits(const char *str, const char *lim, const neat_float_info *info, uint64_t *bits, const char **end_out, int *err)
+{
+    const char *p = str;
+    while(neat_is_space(neat_peek(p, lim))) p++;
+    char c = neat_peek(p, lim);
+    if(c == '\0')
+    {
+        *err = NEAT_PARSE_EMPTY;
+        return false;
+    }
+    
+    bool neg = c == '-';
+    if(c == '-' || c == '+') p++;
+    uint64_t sign = (uint64_t) neg << (info->mantissa_bits + info->exponent_bits);
+    *err = NEAT_PARSE_OK;
+    
+    c = neat_peek(p, lim) | 0x20;
+    if(c == 'i' || c == 'n')
+    {
+        uint64_t inf = (uint64_t) info->infinite_power << info->mantissa_bits;
+        if(neat_match_word(&p, lim, "inf"))
+        {
+            neat_match_word(&p, lim, "inity");
+            *bits = sign | inf;
+            *end_out = p;
+            return true;
+        }
+        if(neat_match_word(&p, lim, "nan"))
+        {
+            // optional nan(chars)
+            if(neat_peek(p, lim) == '(')
+            {
+                const char *q = p + 1;
+                while(c = neat_peek(q, lim), neat_is_digit(c) || ((c | 0x20) >= 'a' && (c | 0x20) <= 'z') || c == '_') q++;
+                if(c == ')') p = q + 1;
+            }
+            *bits = sign | inf | 1ull << (info->mantissa_bits - 1);
+            *end_out = p;
+            return true;
+        }
+        *err = NEAT_PARSE_INVALID;
+        return false;
+    }
+    
+    const char *digits = p;
+    uint64_t w = 0;
+    int ndigits = 0;
+    int64_t exp10 = 0;
+    bool any = false, trunc = false;
+    
+    for( ; neat_is_digit(neat_peek(p, lim)) ; p++)
+    {
+        any = true;
+        if(w == 0 && *p == '0') continue;
+        if(ndigits < 19)
+        {
+            w = w * 10 + (uint64_t) (*p - '0');
+            ndigits++;
+        }
+        else
+        {
+            exp10++;
+            trunc |= *p != '0';
+        }
+    }
+    if(neat_peek(p, lim) == '.')
+    {
+        p++;
+        for( ; neat_is_digit(neat_peek(p, lim)) ; p++)
+        {
+            any = true;
+            if(w == 0 && *p == '0')
+            {
+                exp10--;
+                continue;
+            }
+            if(ndigits < 19)
+            {
+                w = w * 10 + (uint64_t) (*p - '0');
+                ndigits++;
+                exp10--;
+            }
+            else
+            {
+                trunc |= *p != '0';
+            }
+        }
+    }
+    if(!any)
+    {
+        *err = NEAT_PARSE_INVALID;
+        return false;
+    }
+    
+    // the exponent is only consumed if it has digits
+    int64_t explicit_exp = 0;
+    if((neat_peek(p, lim) | 0x20) == 'e')
+    {
+        const char *q = p + 1;
+        c = neat_peek(q, lim);
+        bool eneg = c == '-';
+        if(c == '-' || c == '+') q++;
+        if(neat_is_digit(neat_peek(q, lim)))
+        {
+            for( ; neat_is_digit(neat_peek(q, lim)) ; q++)
+                if(explicit_exp < 100000) explicit_exp = explicit_exp * 10 + (*q - '0');
+            if(eneg) explicit_exp = -explicit_exp;
+            p = q;
+        }
+    }
+    *end_out = p;
+    
+    int64_t q = exp10 + explicit_exp;
+    
+#if defined(FLT_EVAL_METHOD) && FLT_EVAL_METHOD == 0
+    static const double exact_pow10[] = {
+        1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+        1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+    };
+    if(info == &neat_f64_info && !trunc && w <= (1ull << 53) && q >= -22 && q <= 22)
+    {
+        double d = q < 0 ? (double) w / exact_pow10[-q] : (double) w * exact_pow10[q];
+        memcpy(bits, &d, sizeof(d));
+        *bits |= sign;
+        return true;
+    }
+    if(info == &neat_f32_info && !trunc && w <= (1ull << 24) && q >= -10 && q <= 10)
+    {
+        float f = q < 0 ? (float) w / (float) exact_pow10[-q] : (float) w * (float) exact_pow10[q];
+        uint32_t b;
+        memcpy(&b, &f, sizeof(f));
+        *bits = b | sign;
+        return true;
+    }
+#endif
+    
+    int32_t power2;
+    uint64_t mantissa = neat_eisel_lemire(q, w, info, &power2);
+    if(trunc)
+    {
+        int32_t power2_up;
+        uint64_t mantissa_up = neat_eisel_lemire(q, w + 1, info, &power2_up);
+        if(mantissa_up != mantissa || power2_up != power2)
+            mantissa = neat_decimal_to_float(digits, lim, explicit_exp, info, &power2);
+    }
+    if(power2 == info->infinite_power)
+        *err = NEAT_PARSE_RANGE;
+    
+    *bits = sign | (uint64_t) power2 << info->mantissa_bits | mantissa;
+    return true;
+}
+
+static double neat_parse_f64_lim(const char *str, const char *lim, const char **end, int *err)
+{
+    uint64_t bits = 0;
+    const char *p;
+    if(!neat_parse_float_bits(str, lim, &neat_f64_info, &bits, &p, err))
+        p = str;
+    *end = p;
+    
+    double ret;
+    memcpy(&ret, &bits, sizeof(ret));
+    return ret;
+}
+
+double neat_parse_f64(const char *str, char **end, int *err)
+{
+    const char *p;
+    double ret = neat_parse_f64_lim(str, NULL, &p, err);
+    if(end) *end = (char *) p;
+    return ret;
+}
+
+static float neat_parse_f32_lim(const char *str, const char *lim, const char **end, int *err)
+{
+    uint64_t bits = 0;
+    const char *p;
+    if(!neat_parse_float_bits(str, lim, &neat_f32_info, &bits, &p, err))
+        p = str;
+    *end = p;
+    
+    uint32_t b = (uint32_t) bits;
+    float ret;
+    memcpy(&ret, &b, sizeof(ret));
+    return ret;
+}
+
+float neat_parse_f32(const char *str, char **end, int *err)
+{
+    const char *p;
+    float ret = neat_parse_f32_lim(str, NULL, &p, err);
+    if(end) *end = (char *) p;
+    return ret;
+}
+
+// case sensitive like neat_parse_bool, lim can't be NULL here
+static bool neat_parse_bool_lim(const char *str, const char *lim, const char **end, int *err)
+{
+    size_t len = (size_t) (lim - str);
+    *err = NEAT_PARSE_OK;
+    if(len >= 4 && memcmp(str, "true", 4) == 0)
+    {
+        *end = str + 4;
+        return true;
+    }
+    if(len >= 5 && memcmp(str, "false", 5) == 0)
+    {
+        *end = str + 5;
+        return false;
+    }
+    *err = NEAT_PARSE_INVALID;
+    *end = str;
+    return false;
+}
+
+// span parse functions definitions
+
+char neat_parse_n_char(const char *str, size_t len, int *err)
+{
+    if(len == 0)
+    {
+        *err = NEAT_PARSE_EMPTY;
+        return '\0';
+    }
+    *err = NEAT_PARSE_OK;
+    return str[0];
+}
+
+bool neat_parse_n_bool(const char *str, size_t len, int *err)
+{
+    const char *end;
+    return neat_parse_bool_lim(str, str + len, &end, err);
+}
+
+int8_t neat_parse_n_int8_t(const char *str, size_t len, int *err)
+{
+    const char *end;
+    return (int8_t) neat_parse_i64_lim(str, str + len, &end, INT8_MIN, INT8_MAX, err);
+}
+
+int16_t neat_parse_n_int16_t(const char *str, size_t len, int *err)
+{
+    const char *end;
+    return (int16_t) neat_parse_i64_lim(str, str + len, &end, INT16_MIN, INT16_MAX, err);
+}
+
+int32_t neat_parse_n_int32_t(const char *str, size_t len, int *err)
+{
+    const char *end;
+    return (int32_t) neat_parse_i64_lim(str, str + len, &end, INT32_MIN, INT32_MAX, err);
+}
+
+int64_t neat_parse_n_int64_t(const char *str, size_t len, int *err)
+{
+    const char *end;
+    return neat_parse_i64_lim(str, str + len, &end, INT64_MIN, INT64_MAX, err);
+}
+
+uint8_t neat_parse_n_uint8_t(const char *str, size_t len, int *err)
+{
+    const char *end;
+    return (uint8_t) neat_parse_u64_lim(str, str + len, &end, UINT8_MAX, err);
+}
+
+uint16_t neat_parse_n_uint16_t(const char *str, size_t len, int *err)
+{
+    const char *end;
+    return (uint16_t) neat_parse_u64_lim(str, str + len, &end, UINT16_MAX, err);
+}
+
+uint32_t neat_parse_n_uint32_t(const char *str, size_t len, int *err)
+{
+    const char *end;
+    return (uint32_t) neat_parse_u64_lim(str, str + len, &end, UINT32_MAX, err);
+}
+
+uint64_t neat_parse_n_uint64_t(const char *str, size_t len, int *err)
+{
+    const char *end;
+    return neat_parse_u64_lim(str, str + len, &end, UINT64_MAX, err);
+}
+
+float neat_parse_n_float(const char *str, size_t len, int *err)
+{
+    const char *end;
+    return neat_parse_f32_lim(str, str + len, &end, err);
+}
+
+double neat_parse_n_double(const char *str, size_t len, int *err)
+{
+    const char *end;
+    return neat_parse_f64_lim(str, str + len, &end, err);
+}
+
+// parse functions definitions
+
+char neat_parse_char(char *str, int *err) {
+    *err = 0;
+    return str[0];
+}
+
+char *neat_parse_str(char *str, int *err) {
+    *err = 0;
+    return str;
+}
+
+bool neat_parse_bool(char *str, int *err) {
+    size_t len = strlen(str);
+    *err = 0;
+    if(len < 4) {
+        *err = -1;
+        return false;
+    }
+    if(strncmp(str, "true", 4) == 0) { // can actually replace this with memcmp since we know the size
+        return true;
+    }
+    else if(strncmp(str, "false", 5) == 0) {
+        return false;
+    }
+    *err = -1;
+    return false;
+}
+
+int8_t neat_parse_int8_t(char *str, int *err) {
+    return (int8_t) neat_parse_i64(str, NULL, INT8_MIN, INT8_MAX, err);
+}
+
+int16_t neat_parse_int16_t(char *str, int *err) {
+    return (int16_t) neat_parse_i64(str, NULL, INT16_MIN, INT16_MAX, err);
+}
+
+int32_t neat_parse_int32_t(char *str, int *err) {
+    return (int32_t) neat_parse_i64(str, NULL, INT32_MIN, INT32_MAX, err);
+}
+
+int64_t neat_parse_int64_t(char *str, int *err) {
+    return (int64_t) neat_parse_i64(str, NULL, INT64_MIN, INT64_MAX, err);
+}
+
+uint8_t neat_parse_uint8_t(char *str, int *err) {
+    return (uint8_t) neat_parse_u64(str, NULL, UINT8_MAX, err);
+}
+
+uint16_t neat_parse_uint16_t(char *str, int *err) {
+    return (uint16_t) neat_parse_u64(str, NULL, UINT16_MAX, err);
+}
+
+uint32_t neat_parse_uint32_t(char *str, int *err) {
+    return (uint32_t) neat_parse_u64(str, NULL, UINT32_MAX, err);
+}
+
+uint64_t neat_parse_uint64_t(char *str, int *err) {
+    return (uint64_t) neat_parse_u64(str, NULL, UINT64_MAX, err);
+}
+
+float neat_parse_float(char *str, int *err)
+{
+    return neat_parse_f32(str, NULL, err);
+}
+
+double neat_parse_double(char *str, int *err)
+{
+    return neat_parse_f64(str, NULL, err);
+}
+
+// bulk parsing
+
+/*
+    Returns the first delim or '\n' in [p, end), or end. Compares 16
+    bytes at a time with SSE2, otherwise 8 at a time with the
+    has-zero-byte trick (which can only report false positives after
+    a real match, so the exact position is found with the byte loop).
+*/
+static inline const char *neat_find_sep(const char *p, const char *end, char delim)
+{
+#if defined(__SSE2__)
+    const __m128i d = _mm_set1_epi8(delim);
+    const __m128i nl = _mm_set1_epi8('\n');
+    for( ; end - p >= 16 ; p += 16)
+    {
+        __m128i v = _mm_loadu_si128((const __m128i *) p);
+        unsigned mask = (unsigned) _mm_movemask_epi8(_mm_or_si128(_mm_cmpeq_epi8(v, d), _mm_cmpeq_epi8(v, nl)));
+        if(mask)
+            return p + __builtin_ctz(mask);
+    }
+#else
+    const uint64_t ones = 0x0101010101010101ull;
+    const uint64_t d = ones * (unsigned char) delim;
+    const uint64_t nl = ones * (unsigned char) '\n';
+    for( ; end - p >= 8 ; p += 8)
+    {
+        uint64_t v;
+        memcpy(&v, p, 8);
+        uint64_t x = v ^ d, y = v ^ nl;
+        if((((x - ones) & ~x) | ((y - ones) & ~y)) & (ones << 7))
+            break;
+    }
+#endif
+    while(p < end && *p != delim && *p != '\n') p++;
+    return p;
+}
+
+/*
+    Field parsers for neat_parse_array, the field is [s, e) and *end is
+    set past what was parsed.
+*/
+typedef void (*neat_field_parser)(const char *s, const char *e, const char **end, void *out, int *err);
+
+static void neat_field_bool(const char *s, const char *e, const char **end, void *out, int *err)
+{
+    *(bool *) out = neat_parse_bool_lim(s, e, end, err);
+}
+
+static void neat_field_int8_t(const char *s, const char *e, const char **end, void *out, int *err)
+{
+    *(int8_t *) out = (int8_t) neat_parse_i64_lim(s, e, end, INT8_MIN, INT8_MAX, err);
+}
+
+static void neat_field_int16_t(const char *s, const char *e, const char **end, void *out, int *err)
+{
+    *(int16_t *) out = (int16_t) neat_parse_i64_lim(s, e, end, INT16_MIN, INT16_MAX, err);
+}
+
+static void neat_field_int32_t(const char *s, const char *e, const char **end, void *out, int *err)
+{
+    *(int32_t *) out = (int32_t) neat_parse_i64_lim(s, e, end, INT32_MIN, INT32_MAX, err);
+}
+
+static void neat_field_int64_t(const char *s, const char *e, const char **end, void *out, int *err)
+{
+    *(int64_t *) out = neat_parse_i64_lim(s, e, end, INT64_MIN, INT64_MAX, err);
+}
+
+static void neat_field_uint8_t(const char *s, const char *e, const char **end, void *out, int *err)
+{
+    *(uint8_t *) out = (uint8_t) neat_parse_u64_lim(s, e, end, UINT8_MAX, err);
+}
+
+static void neat_field_uint16_t(const char *s, const char *e, const char **end, void *out, int *err)
+{
+    *(uint16_t *) out = (uint16_t) neat_parse_u64_lim(s, e, end, UINT16_MAX, err);
+}
+
+static void neat_field_uint32_t(const char *s, const char *e, const char **end, void *out, int *err)
+{
+    *(uint32_t *) out = (uint32_t) neat_parse_u64_lim(s, e, end, UINT32_MAX, err);
+}
+
+static void neat_field_uint64_t(const char *s, const char *e, const char **end, void *out, int *err)
+{
+    *(uint64_t *) out = neat_parse_u64_lim(s, e, end, UINT64_MAX, err);
+}
+
+static void neat_field_float(const char *s, const char *e, const char **end, void *out, int *err)
+{
+    *(float *) out = neat_parse_f32_lim(s, e, end, err);
+}
+
+static void neat_field_double(const char *s, const char *e, const char **end, void *out, int *err)
+{
+    *(double *) out = neat_parse_f64_lim(s, e, end, err);
+}
+
+/*
+    The rule for separators, shared by parse_array, parse_file and the
+    cursor: an empty field is only allowed as the last one of a line,
+    so blank lines and a delim at the end of a line are skipped, and
+    "1,,2" or ",1" are NEAT_PARSE_EMPTY. When delim is a space or a
+    tab, a run of them is a single separator.
+*/
+static inline bool neat_delim_is_blank(char delim)
+{
+    return delim == ' ' || delim == '\t';
+}
+
+// skips the rest of a run of blank delims, not the line break after it
+static inline const char *neat_skip_blank_delims(const char *p, const char *end, char delim)
+{
+    if(neat_delim_is_blank(delim))
+    {
+        while(p < end && (*p == ' ' || *p == '\t' || *p == '\r')) p++;
+    }
+    return p;
+}
+
+// an empty field is fine if nothing but the line break (or the end) comes after it
+static inline bool neat_empty_field_ok(const char *sep, const char *end)
+{
+    return sep == end || *sep == '\n';
+}
+
+/*
+    Splits [buf, buf + len) into fields and parses each one into out.
+    Surrounding whitespace is skipped, and the whole field has to be
+    consumed.
+*/
+static inline neat_parse_array_result neat_parse_array_fields(const char *buf, size_t len, char delim, void *out, size_t elm_size, size_t cap, neat_field_parser parse_field)
+{
+    neat_parse_array_result res = { .count = 0, .pos = 0, .err = NEAT_PARSE_OK };
+    const char *p = buf;
+    const char *end = buf + len;
+    char *dst = out;
+    
+    while(p < end && res.count < cap)
+    {
+        p = neat_skip_blank_delims(p, end, delim);
+        const char *sep = neat_find_sep(p, end, delim);
+        const char *s = p;
+        const char *e = sep;
+        while(s < e && neat_is_space(*s)) s++;
+        while(e > s && neat_is_space(e[-1])) e--;
+        
+        if(s == e)
+        {
+            if(!neat_empty_field_ok(sep, end))
+            {
+                res.err = NEAT_PARSE_EMPTY;
+                res.pos = (size_t) (p - buf);
+                return res;
+            }
+        }
+        else
+        {
+            const char *parsed;
+            int err;
+            parse_field(s, e, &parsed, dst, &err);
+            
+            if(err == NEAT_PARSE_OK && parsed != e)
+                err = NEAT_PARSE_INVALID;
+            if(err != NEAT_PARSE_OK)
+            {
+                res.err = err;
+                res.pos = (size_t) (p - buf);
+                return res;
+            }
+            dst += elm_size;
+            res.count++;
+        }
+        
+        p = sep < end ? sep + 1 : end;
+    }
+    
+    res.pos = (size_t) (p - buf);
+    return res;
+}
+
+neat_parse_array_result neat_parse_array_char(const char *buf, size_t len, char delim, char *out, size_t cap)
+{
+    neat_parse_array_result res = { .count = 0, .pos = 0, .err = NEAT_PARSE_OK };
+    const char *p = buf;
+    const char *end = buf + len;
+    
+    // chars are taken as is, only the '\r' of a "\r\n" is dropped
+    while(p < end && res.count < cap)
+    {
+        p = neat_skip_blank_delims(p, end, delim);
+        const char *sep = neat_find_sep(p, end, delim);
+        const char *e = sep;
+        if(sep < end && *sep == '\n' && e > p && e[-1] == '\r') e--;
+        
+        if(e - p == 1)
+        {
+            out[res.count++] = *p;
+        }
+        else if(!(e == p && neat_empty_field_ok(sep, end)))
+        {
+            res.err = e == p ? NEAT_PARSE_EMPTY : NEAT_PARSE_INVALID;
+            res.pos = (size_t) (p - buf);
+            return res;
+        }
+        
+        p = sep < end ? sep + 1 : end;
+    }
+    
+    res.pos = (size_t) (p - buf);
+    return res;
+}
+
+neat_parse_array_result neat_parse_array_str(char *buf, size_t len, char delim, char **out, size_t cap)
+{
+    neat_parse_array_result res = { .count = 0, .pos = 0, .err = NEAT_PARSE_OK };
+    char *p = buf;
+    char *end = buf + len;
+    
+    // the strings point into buf, every separator after one is overwritten with a '\0'
+    while(p < end && res.count < cap)
+    {
+        p = (char *) neat_skip_blank_delims(p, end, delim);
+        char *sep = (char *) neat_find_sep(p, end, delim);
+        char *e = sep;
+        if(sep < end && *sep == '\n' && e > p && e[-1] == '\r') e--;
+        
+        // an empty string is a value anywhere but at the end of a line
+        if(!(e == p && neat_empty_field_ok(sep, end)))
+        {
+            if(sep < end) *e = '\0';
+            out[res.count++] = p;
+        }
+        
+        p = sep < end ? sep + 1 : end;
+    }
+    
+    res.pos = (size_t) (p - buf);
+    return res;
+}
+
+neat_parse_array_result neat_parse_array_bool(const char *buf, size_t len, char delim, bool *out, size_t cap)
+{
+    return neat_parse_array_fields(buf, len, delim, out, sizeof(*out), cap, neat_field_bool);
+}
+
+neat_parse_array_result neat_parse_array_int8_t(const char *buf, size_t len, char delim, int8_t *out, size_t cap)
+{
+    return neat_parse_array_fields(buf, len, delim, out, sizeof(*out), cap, neat_field_int8_t);
+}
+
+neat_parse_array_result neat_parse_array_int16_t(const char *buf, size_t len, char delim, int16_t *out, size_t cap)
+{
+    return neat_parse_array_fields(buf, len, delim, out, sizeof(*out), cap, neat_field_int16_t);
+}
+
+neat_parse_array_result neat_parse_array_int32_t(const char *buf, size_t len, char delim, int32_t *out, size_t cap)
+{
+    return neat_parse_array_fields(buf, len, delim, out, sizeof(*out), cap, neat_field_int32_t);
+}
+
+neat_parse_array_result neat_parse_array_int64_t(const char *buf, size_t len, char delim, int64_t *out, size_t cap)
+{
+    return neat_parse_array_fields(buf, len, delim, out, sizeof(*out), cap, neat_field_int64_t);
+}
+
+neat_parse_array_result neat_parse_array_uint8_t(const char *buf, size_t len, char delim, uint8_t *out, size_t cap)
+{
+    return neat_parse_array_fields(buf, len, delim, out, sizeof(*out), cap, neat_field_uint8_t);
+}
+
+neat_parse_array_result neat_parse_array_uint16_t(const char *buf, size_t len, char delim, uint16_t *out, size_t cap)
+{
+    return neat_parse_array_fields(buf, len, delim, out, sizeof(*out), cap, neat_field_uint16_t);
+}
+
+neat_parse_array_result neat_parse_array_uint32_t(const char *buf, size_t len, char delim, uint32_t *out, size_t cap)
+{
+    return neat_parse_array_fields(buf, len, delim, out, sizeof(*out), cap, neat_field_uint32_t);
+}
+
+neat_parse_array_result neat_parse_array_uint64_t(const char *buf, size_t len, char delim, uint64_t *out, size_t cap)
+{
+    return neat_parse_array_fields(buf, len, delim, out, sizeof(*out), cap, neat_field_uint64_t);
+}
+
+neat_parse_array_result neat_parse_array_float(const char *buf, size_t len, char delim, float *out, size_t cap)
+{
+    return neat_parse_array_fields(buf, len, delim, out, sizeof(*out), cap, neat_field_float);
+}
+
+neat_parse_array_result neat_parse_array_double(const char *buf, size_t len, char delim, double *out, size_t cap)
+{
+    return neat_parse_array_fields(buf, len, delim, out, sizeof(*out), cap, neat_field_double);
+}
+
+// file parsing
+
+#ifdef _WIN32
+
+// no mmap here, the file is read into memory instead
+static char *neat_map_file(const char *path, size_t *size)
+{
+    FILE *f = fopen(path, "rb");
+    if(!f) return NULL;
+    
+    char *buf = NULL;
+    size_t len = 0, cap = 0;
+    for(;;)
+    {
+        if(len == cap)
+        {
+            cap = cap ? cap * 2 : 1 << 16;
+            char *grown = realloc(buf, cap);
+            if(!grown)
+            {
+                free(buf);
+                fclose(f);
+                return NULL;
+            }
+            buf = grown;
+        }
+        size_t n = fread(buf + len, 1, cap - len, f);
+        len += n;
+        if(n == 0) break;
+    }
+    bool failed = ferror(f);
+    fclose(f);
+    if(failed)
+    {
+        free(buf);
+        return NULL;
+    }
+    *size = len;
+    return buf;
+}
+
+static void neat_unmap_file(char *buf, size_t size)
+{
+    (void) size;
+    free(buf);
+}
+
+static size_t neat_page_size(void)
+{
+    return 0;
+}
+
+static void neat_advise(const char *p, size_t len, int advice, size_t page)
+{
+    (void) p; (void) len; (void) advice; (void) page;
+}
+
+#define NEAT_ADV_WILLNEED 0
+#define NEAT_ADV_DONTNEED 0
+
+#else
+
+static char *neat_map_file(const char *path, size_t *size)
+{
+    int fd = open(path, O_RDONLY);
+    if(fd < 0) return NULL;
+    
+    struct stat st;
+    if(fstat(fd, &st) != 0)
+    {
+        close(fd);
+        return NULL;
+    }
+    
+    *size = (size_t) st.st_size;
+    if(*size == 0)
+    {
+        close(fd);
+        return (char *) "";
+    }
+    
+    void *map = mmap(NULL, *size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if(map == MAP_FAILED) return NULL;
+    
+    madvise(map, *size, MADV_SEQUENTIAL);
+    return map;
+}
+
+static void neat_unmap_file(char *buf, size_t size)
+{
+    if(size) munmap(buf, size);
+}
+
+static size_t neat_page_size(void)
+{
+    return (size_t) sysconf(_SC_PAGESIZE);
+}
+
+/*
+    madvise wants page aligned ranges. WILLNEED is widened to whole
+    pages, DONTNEED is narrowed so it never touches a page that's still
+    being read. Both are only hints, so errors are ignored.
+*/
+static void neat_advise(const char *p, size_t len, int advice, size_t page)
+{
+    uintptr_t start = (uintptr_t) p;
+    uintptr_t end = start + len;
+    if(advice == MADV_DONTNEED)
+    {
+        start = (start + page - 1) & ~(uintptr_t) (page - 1);
+        end &= ~(uintptr_t) (page - 1);
+    }
+    else
+    {
+        start &= ~(uintptr_t) (page - 1);
+    }
+    if(end > start)
+        madvise((void *) start, end - start, advice);
+}
+
+#define NEAT_ADV_WILLNEED MADV_WILLNEED
+#define NEAT_ADV_DONTNEED MADV_DONTNEED
+
+#endif
+
+/*
+    Returns the offset just past the first line break at or after from,
+    so a part or chunk starts on a new line. A file that's one huge line
+    is split after a delim instead. Returns len if there's neither.
+*/
+static size_t neat_split_after(const char *buf, size_t from, size_t len, char delim)
+{
+    if(from >= len) return len;
+    
+    const char *nl = memchr(buf + from, '\n', len - from);
+    if(nl) return (size_t) (nl - buf) + 1;
+    
+    const char *d = memchr(buf + from, delim, len - from);
+    return d ? (size_t) (d - buf) + 1 : len;
+}
+
+// a range of the file, parsed by one thread into its own array
+typedef struct neat_parse_file_part
+{
+    const char *buf;
+    size_t len;
+    size_t offset; // of buf in the file
+    char delim;
+    size_t elm_size;
+    size_t page;   // looked up once, before the threads start
+    neat_parse_array_fn parse_fn;
+    char *vals;
+    neat_parse_array_result res;
+} neat_parse_file_part;
+
+static void *neat_parse_file_part_run(void *arg)
+{
+    neat_parse_file_part *part = arg;
+    size_t count = 0, cap = 0;
+    size_t done = 0;
+    
+    while(done < part->len)
+    {
+        // walk the part in chunks that end on a line break
+        size_t chunk = part->len - done;
+        if(chunk > NEAT_PARSE_FILE_CHUNK)
+            chunk = neat_split_after(part->buf + done, NEAT_PARSE_FILE_CHUNK, part->len - done, part->delim);
+        const char *buf = part->buf + done;
+        
+        if(done + chunk < part->len)
+        {
+            size_t next = part->len - done - chunk;
+            neat_advise(buf + chunk, next < NEAT_PARSE_FILE_CHUNK ? next : NEAT_PARSE_FILE_CHUNK, NEAT_ADV_WILLNEED, part->page);
+        }
+        
+        size_t pos = 0;
+        while(pos < chunk)
+        {
+            if(count == cap)
+            {
+                // guess a value every 8 bytes, and double from there
+                cap = cap ? cap * 2 : chunk / 8 + 16;
+                char *grown = realloc(part->vals, cap * part->elm_size);
+                if(!grown)
+                {
+                    part->res = (neat_parse_array_result){ .count = count, .pos = part->offset + done + pos, .err = NEAT_PARSE_IO };
+                    return NULL;
+                }
+                part->vals = grown;
+            }
+            
+            neat_parse_array_result r = part->parse_fn(buf + pos, chunk - pos, part->delim, part->vals + count * part->elm_size, cap - count);
+            count += r.count;
+            pos += r.pos;
+            if(r.err != NEAT_PARSE_OK)
+            {
+                part->res = (neat_parse_array_result){ .count = count, .pos = part->offset + done + pos, .err = r.err };
+                return NULL;
+            }
+        }
+        
+        neat_advise(buf, chunk, NEAT_ADV_DONTNEED, part->page);
+        done += chunk;
+    }
+    
+    part->res = (neat_parse_array_result){ .count = count, .pos = part->offset + part->len, .err = NEAT_PARSE_OK };
+    return NULL;
+}
+
+neat_parse_array_result neat_parse_file_f(const char *path, char delim, void **out, size_t elm_size, neat_parse_array_fn parse_fn, int nthreads)
+{
+    neat_parse_array_result res = { .count = 0, .pos = 0, .err = NEAT_PARSE_OK };
+    *out = NULL;
+    
+    size_t size;
+    char *buf = neat_map_file(path, &size);
+    if(!buf)
+    {
+        res.err = NEAT_PARSE_IO;
+        return res;
+    }
+    
+    size_t nparts = neat_count_parts(size, NEAT_PARSE_FILE_CHUNK, nthreads);
+    size_t page = neat_page_size();
+    
+    neat_parse_file_part *parts = calloc(nparts, sizeof(*parts));
+    if(!parts)
+    {
+        neat_unmap_file(buf, size);
+        res.err = NEAT_PARSE_IO;
+        return res;
+    }
+    
+    size_t start = 0;
+    for(size_t i = 0 ; i < nparts ; i++)
+    {
+        size_t end = i == nparts - 1 ? size : neat_split_after(buf, size / nparts * (i + 1), size, delim);
+        if(end < start) end = start;
+        parts[i] = (neat_parse_file_part){
+            .buf = buf + start, .len = end - start, .offset = start,
+            .delim = delim, .elm_size = elm_size, .page = page, .parse_fn = parse_fn
+        };
+        start = end;
+    }
+    
+    neat_run_parts(neat_parse_file_part_run, parts, sizeof(*parts), nparts);
+    
+    // values after the first error are dropped, like when parsing in one go
+    size_t total = 0, used = 0;
+    for( ; used < nparts ; used++)
+    {
+        total += parts[used].res.count;
+        res.pos = parts[used].res.pos;
+        res.err = parts[used].res.err;
+        if(res.err != NEAT_PARSE_OK)
+        {
+            used++;
+            break;
+        }
+    }
+    
+    if(nparts == 1)
+    {
+        *out = parts[0].vals;
+    }
+    else if(total)
+    {
+        char *vals = malloc(total * elm_size);
+        if(vals)
+        {
+            size_t at = 0;
+            for(size_t i = 0 ; i < used ; i++)
+            {
+                memcpy(vals + at, parts[i].vals, parts[i].res.count * elm_size);
+                at += parts[i].res.count * elm_size;
+            }
+        }
+        else
+        {
+            total = 0;
+            res.err = NEAT_PARSE_IO;
+        }
+        *out = vals;
+    }
+    res.count = total;
+    
+    if(nparts > 1)
+    {
+        for(size_t i = 0 ; i < nparts ; i++)
+            free(parts[i].vals);
+    }
+    free(parts);
+    neat_unmap_file(buf, size);
+    return res;
+}
+
+// cursor
+
+neat_cursor neat_cursor_buf(const char *buf, size_t len, char delim)
 {
-    return;
+    return (neat_cursor){ .p = buf, .end = buf + len, .delim = delim, .fd = -1, .eof = true };
 }
 
-#endif // NEAT_TOSTR_H
+neat_cursor neat_cursor_file(FILE *file, char *buf, size_t cap, char delim)
+{
+    return (neat_cursor){ .p = buf, .end = buf, .delim = delim, .buf = buf, .cap = cap, .file = file, .fd = -1 };
+}
 
-#ifdef NEAT_TOSTR_IMPLEMENTATION
+neat_cursor neat_cursor_fd(int fd, char *buf, size_t cap, char delim)
+{
+    return (neat_cursor){ .p = buf, .end = buf, .delim = delim, .buf = buf, .cap = cap, .file = NULL, .fd = fd };
+}
 
-char *neat_array_to_string_f(void *arr, size_t len, size_t elm_size, char*(*tostr)(void*))
+/*
+    Moves the unread [p, end) to the front of buf and reads more after
+    it. Returns false at the end of the input (or on a read error, which
+    also sets err), and when buf is full of one field without setting
+    eof, the caller skips that field.
+*/
+static bool neat_cursor_refill(neat_cursor *c)
 {
-    if(len == 0)
+    if(c->eof) return false;
+    
+    size_t keep = (size_t) (c->end - c->p);
+    if(keep == c->cap) return false;
+    memmove(c->buf, c->p, keep);
+    c->p = c->buf;
+    c->end = c->buf + keep;
+    
+    size_t n;
+    bool failed;
+    if(c->file)
     {
-        char *ret = malloc(3 * sizeof(char));
-        memcpy(ret, "{}", 3);
-        return ret;
+        n = fread(c->buf + keep, 1, c->cap - keep, c->file);
+        failed = n == 0 && ferror(c->file);
+    }
+    else
+    {
+        long r = (long) neat_sys_read(c->fd, c->buf + keep, c->cap - keep);
+        n = r > 0 ? (size_t) r : 0;
+        failed = r < 0;
     }
     
-    uint8_t *u8arr = arr;
-    
-    char **strings = malloc(len * sizeof(char*));
-    for(size_t i = 0 ; i < len ; i++)
+    if(n == 0)
+    {
+        c->eof = true;
+        if(failed && c->err == NEAT_PARSE_OK) c->err = NEAT_PARSE_IO;
+        return false;
+    }
+    c->end += n;
+    return true;
+}
+
+// skips whitespace and blank lines, refilling as needed. Returns false at the end of the input
+static bool neat_cursor_skip_space(neat_cursor *c)
+{
+    for(;;)
+    {
+        while(c->p < c->end && neat_is_space(*c->p)) c->p++;
+        if(c->p < c->end) return true;
+        if(!neat_cursor_refill(c)) return false;
+    }
+}
+
+// drops the rest of a field that doesn't fit in buf, and the separator after it
+static void neat_cursor_skip_field(neat_cursor *c)
+{
+    for(;;)
+    {
+        const char *sep = neat_find_sep(c->p, c->end, c->delim);
+        if(sep < c->end)
+        {
+            c->p = sep + 1;
+            return;
+        }
+        c->p = c->end;
+        if(!neat_cursor_refill(c)) return;
+    }
+}
+
+bool neat_cursor_eof(neat_cursor *c)
+{
+    return !neat_cursor_skip_space(c);
+}
+
+/*
+    Parses the next value, then skips spaces and the separator after
+    it. The value is parsed straight out of buf, and is only parsed
+    again when there's no separator after it before the end of buf,
+    since it may continue after a refill.
+*/
+static void neat_cursor_field(neat_cursor *c, void *out, neat_field_parser parse_field, int *err)
+{
+    if(!neat_cursor_skip_space(c))
     {
-        strings[i] = tostr(u8arr + (i * elm_size));
+        *err = NEAT_PARSE_EMPTY;
+        if(c->err == NEAT_PARSE_OK) c->err = *err;
+        return;
+    }
+    if(*c->p == c->delim)
+    {
+        *err = NEAT_PARSE_EMPTY;
+        if(c->err == NEAT_PARSE_OK) c->err = *err;
+        c->p++;
+        return;
     }
     
-    size_t final_str_len = 1;
-    for(size_t i = 0 ; i < len ; i++) {
-        final_str_len += strlen(strings[i]) + 2;
+    // a refill moves the unread part of buf, so the field is parsed again after any of them
+    const char *stop;
+    for(;;)
+    {
+        parse_field(c->p, c->end, &stop, out, err);
+        if(neat_find_sep(stop, c->end, c->delim) < c->end || c->eof) break;
+        if(!neat_cursor_refill(c) && !c->eof)
+        {
+            *err = NEAT_PARSE_INVALID;
+            if(c->err == NEAT_PARSE_OK) c->err = *err;
+            neat_cursor_skip_field(c);
+            return;
+        }
     }
     
-    char *ret = calloc(final_str_len, sizeof(char));
-    ret[0] = '{';
-    for(size_t i = 0 ; i < len - 1; i++) {
-        strcat(ret, strings[i]);
-        strcat(ret, ", ");
+    // with a blank delim, a run of spaces holding one is the separator
+    const char *q = stop;
+    while(q < c->end && (*q == ' ' || *q == '\t' || *q == '\r')) q++;
+    bool sep_found = q == c->end || *q == c->delim || *q == '\n' ||
+                     (neat_delim_is_blank(c->delim) && memchr(stop, c->delim, (size_t) (q - stop)));
+    if(*err == NEAT_PARSE_OK && !sep_found)
+        *err = NEAT_PARSE_INVALID;
+    
+    // on an error, the rest of the field is skipped so the next value can be read
+    if(*err != NEAT_PARSE_OK)
+    {
+        q = neat_find_sep(q, c->end, c->delim);
+        if(c->err == NEAT_PARSE_OK) c->err = *err;
+    }
+    c->p = q < c->end && (*q == c->delim || *q == '\n') ? q + 1 : q;
+}
+
+const char *neat_cursor_next_str(neat_cursor *c, size_t *len)
+{
+    *len = 0;
+    if(!neat_cursor_skip_space(c))
+    {
+        if(c->err == NEAT_PARSE_OK) c->err = NEAT_PARSE_EMPTY;
+        return c->p;
     }
-    strcat(ret, strings[len - 1]);
-    ret[final_str_len - 2] = '}';
     
-    for(size_t i = 0 ; i < len ; i++)
+    const char *sep;
+    size_t scanned = 0;
+    for(;;)
     {
-        free(strings[i]);
+        // only the part read since the last refill is scanned again
+        sep = neat_find_sep(c->p + scanned, c->end, c->delim);
+        if(sep < c->end || c->eof) break;
+        scanned = (size_t) (c->end - c->p);
+        if(!neat_cursor_refill(c))
+        {
+            if(!c->eof)
+            {
+                if(c->err == NEAT_PARSE_OK) c->err = NEAT_PARSE_INVALID;
+                neat_cursor_skip_field(c);
+                return c->p;
+            }
+            sep = c->end;
+            break;
+        }
     }
-    free(strings);
     
-    return ret;
+    const char *str = c->p;
+    const char *e = sep;
+    while(e > str && (e[-1] == ' ' || e[-1] == '\t' || e[-1] == '\r')) e--;
+    *len = (size_t) (e - str);
+    c->p = sep < c->end ? sep + 1 : sep;
+    return str;
 }
 
-// 2str functions definitions
-
-char *neat_char2str(char *obj) {
-    char *ret = malloc(2 * sizeof(char));
-    ret[0] = *obj;
-    ret[1] = 0;
+bool neat_cursor_next_bool(neat_cursor *c, int *err)
+{
+    bool ret = false;
+    neat_cursor_field(c, &ret, neat_field_bool, err);
     return ret;
 }
 
-char *neat_str2str(char *obj) {
-    size_t len = strlen(obj);
-    char *ret = malloc(len + 1);
-    memcpy(ret, obj, len + 1);
+int8_t neat_cursor_next_int8_t(neat_cursor *c, int *err)
+{
+    int8_t ret = 0;
+    neat_cursor_field(c, &ret, neat_field_int8_t, err);
     return ret;
 }
 
-char *neat_str2str_dummy(char **obj) { return (char*)obj; };
-
-char *neat_bool2str(bool *obj) {
-    char *ret = malloc(6 * sizeof(char));
-    memcpy(ret, "false", 6);
-    if(*obj) memcpy(ret, "true", 5);
+int16_t neat_cursor_next_int16_t(neat_cursor *c, int *err)
+{
+    int16_t ret = 0;
+    neat_cursor_field(c, &ret, neat_field_int16_t, err);
     return ret;
 }
 
-char *neat_int8_t2str(int8_t *obj) {
-    char *ret = malloc(5 * sizeof(char));
-    sprintf(ret, "%" PRId8, *obj);
+int32_t neat_cursor_next_int32_t(neat_cursor *c, int *err)
+{
+    int32_t ret = 0;
+    neat_cursor_field(c, &ret, neat_field_int32_t, err);
     return ret;
 }
 
-char *neat_int16_t2str(int16_t *obj) {
-    char *ret = malloc(7 * sizeof(char));
-    sprintf(ret, "%" PRId16, *obj);
+int64_t neat_cursor_next_int64_t(neat_cursor *c, int *err)
+{
+    int64_t ret = 0;
+    neat_cursor_field(c, &ret, neat_field_int64_t, err);
     return ret;
 }
 
-char *neat_int32_t2str(int32_t *obj) {
-    char *ret = malloc(12 * sizeof(char));
-    sprintf(ret, "%" PRId32, *obj);
+uint8_t neat_cursor_next_uint8_t(neat_cursor *c, int *err)
+{
+    uint8_t ret = 0;
+    neat_cursor_field(c, &ret, neat_field_uint8_t, err);
     return ret;
 }
 
-char *neat_int64_t2str(int64_t *obj) {
-    char *ret = malloc(21 * sizeof(char));
-    sprintf(ret, "%" PRId64, *obj);
+uint16_t neat_cursor_next_uint16_t(neat_cursor *c, int *err)
+{
+    uint16_t ret = 0;
+    neat_cursor_field(c, &ret, neat_field_uint16_t, err);
     return ret;
 }
 
-char *neat_uint8_t2str(uint8_t *obj) {
-    char *ret = malloc(4 * sizeof(char));
-    sprintf(ret, "%" PRIu8, *obj);
+uint32_t neat_cursor_next_uint32_t(neat_cursor *c, int *err)
+{
+    uint32_t ret = 0;
+    neat_cursor_field(c, &ret, neat_field_uint32_t, err);
     return ret;
 }
 
-char *neat_uint16_t2str(uint16_t *obj) {
-    char *ret = malloc(6 * sizeof(char));
-    sprintf(ret, "%" PRIu16, *obj);
+uint64_t neat_cursor_next_uint64_t(neat_cursor *c, int *err)
+{
+    uint64_t ret = 0;
+    neat_cursor_field(c, &ret, neat_field_uint64_t, err);
     return ret;
 }
 
-char *neat_uint32_t2str(uint32_t *obj) {
-    char *ret = malloc(12 * sizeof(char));
-    sprintf(ret, "%" PRIu32, *obj);
+float neat_cursor_next_float(neat_cursor *c, int *err)
+{
+    float ret = 0;
+    neat_cursor_field(c, &ret, neat_field_float, err);
     return ret;
 }
 
-char *neat_uint64_t2str(uint64_t *obj) {
-    char *ret = malloc(21 * sizeof(char));
-    sprintf(ret, "%" PRIu64, *obj);
+double neat_cursor_next_double(neat_cursor *c, int *err)
+{
+    double ret = 0;
+    neat_cursor_field(c, &ret, neat_field_double, err);
     return ret;
 }
 
-char *neat_float2str(float *obj) {
-    int len = snprintf(NULL, 0, "%g", *obj);
-    char *ret = calloc(sizeof(char), len + 1);
-    
-    sprintf(ret, "%g", *obj);
-    
-    return ret;
+// binary serialization
+
+// integers are LEB128 varints: 7 bits per byte, low bits first, the high bit set on all but the last byte.
+// signed ones are zigzagged first (0, -1, 1, -2 ... -> 0, 1, 2, 3 ...), so small negatives stay small.
+#define NEAT_VARINT_MAX_BYTES 10
+
+static inline size_t neat_varint_len(uint64_t v)
+{
+    size_t len = 1;
+    while(v >= 0x80)
+    {
+        v >>= 7;
+        len++;
+    }
+    return len;
 }
 
-char *neat_double2str(double *obj) {
-    int len = snprintf(NULL, 0, "%g", *obj);
-    char *ret = calloc(sizeof(char), len + 1);
-    
-    sprintf(ret, "%lg", *obj);
+static inline size_t neat_put_varint(unsigned char *out, uint64_t v)
+{
+    size_t i = 0;
+    while(v >= 0x80)
+    {
+        out[i++] = (unsigned char) (v | 0x80);
+        v >>= 7;
+    }
+    out[i++] = (unsigned char) v;
+    return i;
+}
+
+// 0 if it's truncated, or doesn't fit in 64 bits
+static inline size_t neat_get_varint(const unsigned char *in, size_t len, uint64_t *v)
+{
+    if(len > NEAT_VARINT_MAX_BYTES) len = NEAT_VARINT_MAX_BYTES;
+    uint64_t ret = 0;
+    for(size_t i = 0 ; i < len ; i++)
+    {
+        ret |= (uint64_t) (in[i] & 0x7f) << (7 * i);
+        if(in[i] < 0x80)
+        {
+            if(i == NEAT_VARINT_MAX_BYTES - 1 && in[i] > 1) return 0;
+            *v = ret;
+            return i + 1;
+        }
+    }
+    return 0;
+}
+
+static inline uint64_t neat_zigzag(int64_t v)
+{
+    return ((uint64_t) v << 1) ^ (uint64_t) (v >> 63);
+}
+
+static inline int64_t neat_unzigzag(uint64_t v)
+{
+    return (int64_t) (v >> 1) ^ -(int64_t) (v & 1);
+}
+
+static size_t neat_uint2bytes(void *buf, size_t cap, uint64_t v)
+{
+    if(cap >= NEAT_VARINT_MAX_BYTES) return neat_put_varint(buf, v);
     
-    return ret;
+    size_t len = neat_varint_len(v);
+    if(len <= cap) neat_put_varint(buf, v);
+    return len;
 }
 
-// parse functions definitions
+static size_t neat_bytes2uint(const void *buf, size_t len, uint64_t max, uint64_t *out)
+{
+    uint64_t v;
+    size_t n = neat_get_varint(buf, len, &v);
+    if(n == 0 || v > max) return 0;
+    *out = v;
+    return n;
+}
 
-char neat_parse_char(char *str, int *err) {
-    *err = 0;
-    return str[0];
+static size_t neat_bytes2int(const void *buf, size_t len, int64_t min, int64_t max, int64_t *out)
+{
+    uint64_t u;
+    size_t n = neat_get_varint(buf, len, &u);
+    if(n == 0) return 0;
+    int64_t v = neat_unzigzag(u);
+    if(v < min || v > max) return 0;
+    *out = v;
+    return n;
 }
 
-char *neat_parse_str(char *str, int *err) {
-    *err = 0;
-    return str;
+static inline void neat_store_le(unsigned char *out, uint64_t v, size_t size)
+{
+    for(size_t i = 0 ; i < size ; i++)
+        out[i] = (unsigned char) (v >> (8 * i));
 }
 
-bool neat_parse_bool(char *str, int *err) {
+static inline uint64_t neat_load_le(const unsigned char *in, size_t size)
+{
+    uint64_t v = 0;
+    for(size_t i = 0 ; i < size ; i++)
+        v |= (uint64_t) in[i] << (8 * i);
+    return v;
+}
+
+size_t neat_str2bytes(void *buf, size_t cap, const char *str)
+{
     size_t len = strlen(str);
-    *err = 0;
-    if(len < 4) {
-        *err = -1;
-        return false;
-    }
-    if(strncmp(str, "true", 4) == 0) { // can actually replace this with memcmp since we know the size
-        return true;
-    }
-    else if(strncmp(str, "false", 5) == 0) {
-        return false;
+    size_t prefix = neat_varint_len(len);
+    if(prefix + len <= cap)
+    {
+        neat_put_varint(buf, len);
+        memcpy((unsigned char*) buf + prefix, str, len);
     }
-    *err = -1;
-    return false;
+    return prefix + len;
 }
 
-int8_t neat_parse_int8_t(char *str, int *err) {
-    int8_t ret;
-    *err = sscanf(str, "%" SCNd8, &ret) - 1;
-    return ret;
+size_t neat_char2bytes(void *buf, size_t cap, char *obj)
+{
+    if(cap >= 1) *(unsigned char*) buf = (unsigned char) *obj;
+    return 1;
 }
 
-int16_t neat_parse_int16_t(char *str, int *err) {
-    int16_t ret;
-    *err = sscanf(str, "%" SCNd16, &ret) - 1;
-    return ret;
+size_t neat_str2bytes_dummy(void *buf, size_t cap, char **obj) { return neat_str2bytes(buf, cap, *obj); }
+
+size_t neat_bool2bytes(void *buf, size_t cap, bool *obj)
+{
+    if(cap >= 1) *(unsigned char*) buf = *obj;
+    return 1;
 }
 
-int32_t neat_parse_int32_t(char *str, int *err) {
-    int32_t ret;
-    *err = sscanf(str, "%" SCNd32, &ret) - 1;
-    return ret;
+size_t neat_int8_t2bytes(void *buf, size_t cap, int8_t *obj)
+{
+    return neat_uint2bytes(buf, cap, neat_zigzag(*obj));
 }
 
-int64_t neat_parse_int64_t(char *str, int *err) {
-    int64_t ret;
-    *err = sscanf(str, "%" SCNd64, &ret) - 1;
-    return ret;
+size_t neat_int16_t2bytes(void *buf, size_t cap, int16_t *obj)
+{
+    return neat_uint2bytes(buf, cap, neat_zigzag(*obj));
 }
 
-uint8_t neat_parse_uint8_t(char *str, int *err) {
-    uint8_t ret;
-    *err = sscanf(str, "%" SCNu8, &ret) - 1;
-    return ret;
+size_t neat_int32_t2bytes(void *buf, size_t cap, int32_t *obj)
+{
+    return neat_uint2bytes(buf, cap, neat_zigzag(*obj));
 }
 
-uint16_t neat_parse_uint16_t(char *str, int *err) {
-    uint16_t ret;
-    *err = sscanf(str, "%" SCNu16, &ret) - 1;
-    return ret;
+size_t neat_int64_t2bytes(void *buf, size_t cap, int64_t *obj)
+{
+    return neat_uint2bytes(buf, cap, neat_zigzag(*obj));
 }
 
-uint32_t neat_parse_uint32_t(char *str, int *err) {
-    uint32_t ret;
-    *err = sscanf(str, "%" SCNu32, &ret) - 1;
-    return ret;
+size_t neat_uint8_t2bytes(void *buf, size_t cap, uint8_t *obj)
+{
+    return neat_uint2bytes(buf, cap, *obj);
 }
 
-uint64_t neat_parse_uint64_t(char *str, int *err) {
-    uint64_t ret;
-    *err = sscanf(str, "%" SCNu64, &ret) - 1;
-    return ret;
+size_t neat_uint16_t2bytes(void *buf, size_t cap, uint16_t *obj)
+{
+    return neat_uint2bytes(buf, cap, *obj);
 }
 
-float neat_parse_float(char *str, int *err)
+size_t neat_uint32_t2bytes(void *buf, size_t cap, uint32_t *obj)
 {
-    float ret;
-    *err = sscanf(str, "%g", &ret) - 1;
-    return ret;
+    return neat_uint2bytes(buf, cap, *obj);
 }
 
-double neat_parse_double(char *str, int *err)
+size_t neat_uint64_t2bytes(void *buf, size_t cap, uint64_t *obj)
 {
-    double ret;
-    *err = sscanf(str, "%lg", &ret) - 1;
-    return ret;
+    return neat_uint2bytes(buf, cap, *obj);
+}
+
+size_t neat_float2bytes(void *buf, size_t cap, float *obj)
+{
+    uint32_t bits;
+    memcpy(&bits, obj, sizeof(bits));
+    if(cap >= sizeof(bits)) neat_store_le(buf, bits, sizeof(bits));
+    return sizeof(bits);
+}
+
+size_t neat_double2bytes(void *buf, size_t cap, double *obj)
+{
+    uint64_t bits;
+    memcpy(&bits, obj, sizeof(bits));
+    if(cap >= sizeof(bits)) neat_store_le(buf, bits, sizeof(bits));
+    return sizeof(bits);
+}
+
+size_t neat_bytes2char(const void *buf, size_t len, char *out)
+{
+    if(len < 1) return 0;
+    *out = (char) *(const unsigned char*) buf;
+    return 1;
+}
+
+// the string is 'malloc'ed
+size_t neat_bytes2str(const void *buf, size_t len, char **out)
+{
+    uint64_t str_len;
+    size_t prefix = neat_get_varint(buf, len, &str_len);
+    if(prefix == 0 || str_len > len - prefix) return 0;
+    
+    char *str = malloc(str_len + 1);
+    if(str == NULL) return 0;
+    memcpy(str, (const unsigned char*) buf + prefix, str_len);
+    str[str_len] = '\0';
+    *out = str;
+    return prefix + str_len;
+}
+
+size_t neat_bytes2bool(const void *buf, size_t len, bool *out)
+{
+    if(len < 1 || *(const unsigned char*) buf > 1) return 0;
+    *out = *(const unsigned char*) buf;
+    return 1;
+}
+
+size_t neat_bytes2int8_t(const void *buf, size_t len, int8_t *out)
+{
+    int64_t v;
+    size_t n = neat_bytes2int(buf, len, INT8_MIN, INT8_MAX, &v);
+    if(n) *out = (int8_t) v;
+    return n;
+}
+
+size_t neat_bytes2int16_t(const void *buf, size_t len, int16_t *out)
+{
+    int64_t v;
+    size_t n = neat_bytes2int(buf, len, INT16_MIN, INT16_MAX, &v);
+    if(n) *out = (int16_t) v;
+    return n;
+}
+
+size_t neat_bytes2int32_t(const void *buf, size_t len, int32_t *out)
+{
+    int64_t v;
+    size_t n = neat_bytes2int(buf, len, INT32_MIN, INT32_MAX, &v);
+    if(n) *out = (int32_t) v;
+    return n;
+}
+
+size_t neat_bytes2int64_t(const void *buf, size_t len, int64_t *out)
+{
+    return neat_bytes2int(buf, len, INT64_MIN, INT64_MAX, out);
+}
+
+size_t neat_bytes2uint8_t(const void *buf, size_t len, uint8_t *out)
+{
+    uint64_t v;
+    size_t n = neat_bytes2uint(buf, len, UINT8_MAX, &v);
+    if(n) *out = (uint8_t) v;
+    return n;
+}
+
+size_t neat_bytes2uint16_t(const void *buf, size_t len, uint16_t *out)
+{
+    uint64_t v;
+    size_t n = neat_bytes2uint(buf, len, UINT16_MAX, &v);
+    if(n) *out = (uint16_t) v;
+    return n;
+}
+
+size_t neat_bytes2uint32_t(const void *buf, size_t len, uint32_t *out)
+{
+    uint64_t v;
+    size_t n = neat_bytes2uint(buf, len, UINT32_MAX, &v);
+    if(n) *out = (uint32_t) v;
+    return n;
+}
+
+size_t neat_bytes2uint64_t(const void *buf, size_t len, uint64_t *out)
+{
+    return neat_bytes2uint(buf, len, UINT64_MAX, out);
+}
+
+size_t neat_bytes2float(const void *buf, size_t len, float *out)
+{
+    if(len < sizeof(uint32_t)) return 0;
+    uint32_t bits = (uint32_t) neat_load_le(buf, sizeof(bits));
+    memcpy(out, &bits, sizeof(bits));
+    return sizeof(bits);
+}
+
+size_t neat_bytes2double(const void *buf, size_t len, double *out)
+{
+    if(len < sizeof(uint64_t)) return 0;
+    uint64_t bits = neat_load_le(buf, sizeof(bits));
+    memcpy(out, &bits, sizeof(bits));
+    return sizeof(bits);
+}
+
+size_t neat_array_to_bytes_f(void *buf, size_t cap, const void *arr, size_t n, size_t elm_size, neat_serfn fn)
+{
+    if(fn.raw)
+    {
+        size_t size = n * elm_size;
+        if(size <= cap) memcpy(buf, arr, size);
+        return size;
+    }
+    
+    unsigned char *out = buf;
+    const unsigned char *elm = arr;
+    size_t pos = 0;
+    for(size_t i = 0 ; i < n ; i++, elm += elm_size)
+    {
+        // once an element doesn't fit, the rest are only measured
+        size_t at = pos < cap ? pos : cap;
+        pos += fn.tobytes(out + at, cap - at, (void*) elm);
+    }
+    return pos;
+}
+
+size_t neat_array_from_bytes_f(const void *buf, size_t len, void *out, size_t n, size_t elm_size, neat_serfn fn)
+{
+    if(fn.raw)
+    {
+        size_t size = n * elm_size;
+        if(size > len) return 0;
+        memcpy(out, buf, size);
+        return size;
+    }
+    
+    const unsigned char *in = buf;
+    unsigned char *elm = out;
+    size_t pos = 0;
+    for(size_t i = 0 ; i < n ; i++, elm += elm_size)
+    {
+        size_t read = fn.frombytes(in + pos, len - pos, elm);
+        if(read == 0) return 0;
+        pos += read;
+    }
+    return pos;
 }
 
 #endif // NEAT_TOSTR_IMPLEMENTATION
@@ -0,0 +1,171 @@
+// sh tests/run.sh cc array_to_chars
+
+#define NEAT_TOSTR_IMPLEMENTATION
+#include "neat_tostr.h"
+#include "test.h"
+
+#include <inttypes.h>
+#include <math.h>
+
+#define N 2000
+
+static char got[1 << 20], want[1 << 20];
+
+// got holds array_to_chars output of length len
+static void check_output(size_t len, const char *expected)
+{
+    CHECK(len == strlen(expected));
+    CHECK_STR(got, expected);
+}
+
+#define check_ints(arr, fmt_str, fmt) do { \
+    size_t check_len = (size_t) sprintf(want, "%s", (fmt).open); \
+    for(size_t check_i = 0 ; check_i < N ; check_i++) \
+        check_len += (size_t) sprintf(want + check_len, "%s" fmt_str, check_i ? (fmt).sep : "", (arr)[check_i]); \
+    sprintf(want + check_len, "%s", (fmt).close); \
+    check_output(array_to_chars(got, sizeof(got), arr, N, fmt), want); \
+} while(0)
+
+static void test_ints(void)
+{
+    static int8_t i8[N]; static int16_t i16[N]; static int32_t i32[N]; static int64_t i64[N];
+    static uint8_t u8[N]; static uint16_t u16[N]; static uint32_t u32[N]; static uint64_t u64[N];
+    neat_array_fmt fmts[] = {
+        NEAT_ARRAY_FMT_DEFAULT,
+        { .open = "", .sep = "\n", .close = "", .precision = -1 },
+        { .open = "[", .sep = " -- a separator longer than sixteen bytes -- ", .close = "]", .precision = -1 },
+    };
+    for(int r = 0 ; r < 20 ; r++)
+    {
+        for(size_t i = 0 ; i < N ; i++)
+        {
+            // every digit count, and the 16 digit split of the kernel
+            uint64_t v = test_rand() >> (test_rand() % 64);
+            if(i % 7 == 0) v = (uint64_t) 10000000000000000ull * (test_rand() % 1845) + (test_rand() % 3) - 1;
+            i8[i] = (int8_t) v; i16[i] = (int16_t) v; i32[i] = (int32_t) v; i64[i] = (int64_t) v;
+            u8[i] = (uint8_t) v; u16[i] = (uint16_t) v; u32[i] = (uint32_t) v; u64[i] = v;
+        }
+        i64[0] = INT64_MIN;
+        u64[1] = UINT64_MAX;
+        neat_array_fmt fmt = fmts[r % TEST_LEN(fmts)];
+        check_ints(i8, "%d", fmt);
+        check_ints(i16, "%d", fmt);
+        check_ints(i32, "%" PRId32, fmt);
+        check_ints(i64, "%" PRId64, fmt);
+        check_ints(u8, "%u", fmt);
+        check_ints(u16, "%u", fmt);
+        check_ints(u32, "%" PRIu32, fmt);
+        check_ints(u64, "%" PRIu64, fmt);
+    }
+}
+
+// "%.*f" of every element, precisions past the max clamped to it
+static void fixed_want(const double *arr, size_t n, int prec)
+{
+    size_t len = 0;
+    int p = prec > NEAT_FIXED_MAX_PRECISION ? NEAT_FIXED_MAX_PRECISION : prec;
+    for(size_t i = 0 ; i < n ; i++)
+        len += (size_t) sprintf(want + len, "%s%.*f", i ? "," : "", p, arr[i]);
+}
+
+static void test_fixed(void)
+{
+    static double d[N];
+    static float f[N];
+    for(int prec = 0 ; prec <= NEAT_FIXED_MAX_PRECISION + 2 ; prec++)
+    {
+        for(size_t i = 0 ; i < N ; i++)
+        {
+            uint64_t r = test_rand();
+            switch(i % 5)
+            {
+                // any magnitude, around where v * 10^prec stops fitting in 53 bits, and exact ties
+                case 0: d[i] = ldexp((double) (r >> 11), (int) (test_rand() % 140) - 110); break;
+                case 1: d[i] = (double) (r >> 11) / (double) neat_pow10[prec < 17 ? prec : 17]; break;
+                case 2: d[i] = (double) (int64_t) (r % 2000001 - 1000000) / 8.0; break;
+                case 3: d[i] = (double) (r % 100000) / 1000.0; break;
+                case 4: memcpy(&d[i], &r, sizeof(d[i])); break;
+            }
+            if(r & 1) d[i] = -d[i];
+        }
+        d[0] = -0.0;
+        d[1] = 0.5;
+        d[2] = 2.5;
+        d[3] = DBL_MAX;
+        d[4] = 5e-324;
+        d[5] = INFINITY;
+        d[6] = -0.004;
+        neat_array_fmt fmt = { .open = "", .sep = ",", .close = "", .precision = prec };
+        fixed_want(d, N, prec);
+        check_output(array_to_chars(got, sizeof(got), d, N, fmt), want);
+
+        // floats are formatted as their double value
+        for(size_t i = 0 ; i < N ; i++)
+        {
+            f[i] = (float) d[i];
+            d[i] = f[i];
+        }
+        fixed_want(d, N, prec);
+        check_output(array_to_chars(got, sizeof(got), f, N, fmt), want);
+    }
+}
+
+static void test_shortest(void)
+{
+    static double d[N];
+    static float f[N];
+    for(size_t i = 0 ; i < N ; i++)
+    {
+        uint64_t r = test_rand();
+        memcpy(&d[i], &r, sizeof(d[i]));
+        f[i] = (float) d[i];
+    }
+    size_t len = 1;
+    strcpy(want, "{");
+    for(size_t i = 0 ; i < N ; i++)
+    {
+        if(i) len += (size_t) sprintf(want + len, ", ");
+        len += to_chars(want + len, sizeof(want) - len, d[i]);
+    }
+    strcpy(want + len, "}");
+    check_output(array_to_chars(got, sizeof(got), d, N), want);
+
+    len = 1;
+    for(size_t i = 0 ; i < N ; i++)
+    {
+        if(i) len += (size_t) sprintf(want + len, ", ");
+        len += to_chars(want + len, sizeof(want) - len, f[i]);
+    }
+    strcpy(want + len, "}");
+    check_output(array_to_chars(got, sizeof(got), f, N), want);
+}
+
+// every cap gives a NUL terminated prefix, and the full length
+static void test_truncation(void)
+{
+    int64_t arr[50];
+    for(size_t i = 0 ; i < TEST_LEN(arr) ; i++) arr[i] = (int64_t) test_rand() >> (i % 64);
+    size_t full = array_to_chars(want, sizeof(want), arr, TEST_LEN(arr));
+    CHECK(array_to_chars(NULL, 0, arr, TEST_LEN(arr)) == full);
+    for(size_t cap = 1 ; cap <= full + 1 ; cap++)
+    {
+        memset(got, '#', full + 2);
+        CHECK(array_to_chars(got, cap, arr, TEST_LEN(arr)) == full);
+        CHECK(strlen(got) == (cap - 1 < full ? cap - 1 : full));
+        CHECK(strncmp(got, want, cap - 1) == 0);
+        CHECK(got[cap] == '#');
+    }
+
+    int32_t none[1];
+    CHECK(array_to_chars(got, sizeof(got), none, 0) == 2);
+    CHECK_STR(got, "{}");
+}
+
+int main(void)
+{
+    test_ints();
+    test_fixed();
+    test_shortest();
+    test_truncation();
+    return TEST_DONE();
+}
@@ -0,0 +1,133 @@
+// sh tests/run.sh cc array_to_string
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+typedef struct { int x, y; } point;
+typedef struct { const char *name; } tag;
+
+static size_t point2chars(char *buf, size_t cap, point *p)
+{
+    return (size_t) snprintf(buf, cap, "(%d, %d)", p->x, p->y);
+}
+
+static char *tag2str(tag *t)
+{
+    size_t len = strlen(t->name);
+    char *s = malloc(len + 3);
+    snprintf(s, len + 3, "<%s>", t->name);
+    return s;
+}
+
+#define STRINGABLE_TYPES ADD_STRINGABLE_BUF(point, point2chars), ADD_STRINGABLE(tag, tag2str)
+#define NEAT_TOSTR_IMPLEMENTATION
+#include "neat_tostr.h"
+#include "test.h"
+
+#include <math.h>
+
+#define N 3000
+
+static char want[1 << 20];
+
+// the array joined from to_chars of every element, the way the docs describe it
+#define check_array(arr, n, fmt) do { \
+    neat_array_fmt check_fmt = (fmt); \
+    size_t check_len = (size_t) sprintf(want, "%s", check_fmt.open); \
+    for(size_t check_i = 0 ; check_i < (size_t) (n) ; check_i++) \
+    { \
+        if(check_i) check_len += (size_t) sprintf(want + check_len, "%s", check_fmt.sep); \
+        check_len += to_chars(want + check_len, sizeof(want) - check_len, (arr)[check_i]); \
+    } \
+    sprintf(want + check_len, "%s", check_fmt.close); \
+    char *check_got = array_to_string(arr, n, check_fmt); \
+    CHECK_STR(check_got, want); \
+    free(check_got); \
+} while(0)
+
+static const neat_array_fmt fmts[] = {
+    { .open = "{", .sep = ", ", .close = "}", .precision = -1 },
+    { .open = "", .sep = "", .close = "", .precision = -1 },
+    { .open = "<<<", .sep = " | ", .close = ">>>\n", .precision = -1 },
+};
+
+static void test_numbers(void)
+{
+    static int8_t i8[N]; static int16_t i16[N]; static int32_t i32[N]; static int64_t i64[N];
+    static uint8_t u8[N]; static uint16_t u16[N]; static uint32_t u32[N]; static uint64_t u64[N];
+    static float f[N]; static double d[N];
+    for(size_t i = 0 ; i < N ; i++)
+    {
+        uint64_t r = test_rand() >> (test_rand() % 64);
+        i8[i] = (int8_t) r; i16[i] = (int16_t) r; i32[i] = (int32_t) r; i64[i] = (int64_t) r;
+        u8[i] = (uint8_t) r; u16[i] = (uint16_t) r; u32[i] = (uint32_t) r; u64[i] = r;
+        uint64_t bits = test_rand();
+        memcpy(&d[i], &bits, sizeof(d[i]));
+        if(isnan(d[i])) d[i] = (double) r;
+        f[i] = (float) d[i];
+    }
+
+    size_t sizes[] = { 0, 1, 2, 17, N };
+    for(size_t s = 0 ; s < TEST_LEN(sizes) ; s++)
+    {
+        for(size_t k = 0 ; k < TEST_LEN(fmts) ; k++)
+        {
+            size_t n = sizes[s];
+            check_array(i8, n, fmts[k]); check_array(i16, n, fmts[k]);
+            check_array(i32, n, fmts[k]); check_array(i64, n, fmts[k]);
+            check_array(u8, n, fmts[k]); check_array(u16, n, fmts[k]);
+            check_array(u32, n, fmts[k]); check_array(u64, n, fmts[k]);
+            check_array(f, n, fmts[k]); check_array(d, n, fmts[k]);
+        }
+    }
+
+    // the default fmt, when none is passed
+    int32_t small[] = { 1, -20, 300 };
+    char *str = array_to_string(small, 3);
+    CHECK_STR(str, "{1, -20, 300}");
+    free(str);
+    str = array_to_string(small, 0);
+    CHECK_STR(str, "{}");
+    free(str);
+
+    // fixed precision rounds like printf's %.*f
+    double prices[] = { 1.005, 2.5, -0.125, 1e10, 0 };
+    neat_array_fmt fixed = { .open = "", .sep = ",", .close = "", .precision = 2 };
+    str = array_to_string(prices, 5, fixed);
+    snprintf(want, sizeof(want), "%.2f,%.2f,%.2f,%.2f,%.2f", prices[0], prices[1], prices[2], prices[3], prices[4]);
+    CHECK_STR(str, want);
+    free(str);
+}
+
+static void test_others(void)
+{
+    char *strs[] = { "a", "", "long string with spaces", "x" };
+    bool bools[] = { true, false, true };
+    char chars[] = { 'a', ' ', 'z' };
+    point pts[] = { { 1, 2 }, { -3, 4 }, { 0, 0 } };
+    tag tags[] = { { "x" }, { "" }, { "abc" } };
+    for(size_t k = 0 ; k < TEST_LEN(fmts) ; k++)
+    {
+        for(size_t n = 0 ; n <= 3 ; n++)
+        {
+            check_array(strs, n + 1, fmts[k]);
+            check_array(bools, n, fmts[k]);
+            check_array(chars, n, fmts[k]);
+            check_array(pts, n, fmts[k]);
+            check_array(tags, n, fmts[k]);
+        }
+    }
+
+    // a user type whose strings are longer than any guess
+    static point many[N];
+    for(size_t i = 0 ; i < N ; i++) many[i] = (point){ (int) test_rand(), (int) test_rand() };
+    check_array(many, N, fmts[0]);
+}
+
+int main(void)
+{
+    test_numbers();
+    test_others();
+    return TEST_DONE();
+}
@@ -0,0 +1,128 @@
+// sh tests/run.sh cc async
+
+#define NEAT_TOSTR_ASYNC
+#define NEAT_TOSTR_IMPLEMENTATION
+#include "neat_tostr.h"
+#include "test.h"
+
+#include <stdlib.h>
+#include <pthread.h>
+#include <unistd.h>
+
+enum { THREADS = 4, LINES = 5000 };
+
+static FILE *target;
+
+static void *printer(void *arg)
+{
+    size_t t = (size_t) arg;
+    for(size_t i = 0 ; i < LINES ; i++)
+        fprintln(target, "t", t, " line ", i, " ", i * 0.25, " and some padding");
+    return NULL;
+}
+
+// the printers 0..threads-1 must each have all their lines there once, in order
+static void check_output(size_t threads)
+{
+    fflush(target);
+    rewind(target);
+    size_t next[THREADS + 1] = { 0 }, lines = 0, bad = 0;
+    char line[256];
+    while(fgets(line, sizeof(line), target))
+    {
+        size_t t, i;
+        double d;
+        int end = 0;
+        if(sscanf(line, "t%zu line %zu %lf and some padding\n%n", &t, &i, &d, &end) != 3 || t >= threads || line[end] != '\0')
+        {
+            bad++;
+            continue;
+        }
+        bad += i != next[t]++ || d != i * 0.25;
+        lines++;
+    }
+    CHECK(bad == 0);
+    CHECK(lines == threads * LINES);
+}
+
+static void run_threads(size_t threads)
+{
+    pthread_t th[THREADS];
+    for(size_t t = 0 ; t < threads ; t++) pthread_create(&th[t], NULL, printer, (void *) t);
+    for(size_t t = 0 ; t < threads ; t++) pthread_join(th[t], NULL);
+}
+
+static void test_block(size_t ring_size)
+{
+    target = tmpfile();
+    CHECK(neat_async_start(target, ring_size, NEAT_ASYNC_BLOCK) == 0);
+    CHECK(neat_async_start(target, ring_size, NEAT_ASYNC_BLOCK) == -1);
+    run_threads(THREADS);
+    printer((void *) THREADS); // the main thread's ring outlives every start
+    neat_async_stop();
+    check_output(THREADS + 1);
+    CHECK(neat_async_dropped() == 0);
+    fclose(target);
+}
+
+static void test_flush(void)
+{
+    target = tmpfile();
+    CHECK(neat_async_start(target, 0, NEAT_ASYNC_BLOCK) == 0);
+    run_threads(2);
+    neat_async_flush();
+    check_output(2);
+    neat_async_stop();
+    fclose(target);
+}
+
+static void *read_pipe(void *fd)
+{
+    static size_t total;
+    char buf[4096];
+    long n;
+    while((n = read(*(int *) fd, buf, sizeof(buf))) > 0) total += (size_t) n;
+    return &total;
+}
+
+// with nobody reading the target, DROP loses output but counts every byte of it
+static void test_drop(void)
+{
+    int fds[2];
+    CHECK(pipe(fds) == 0);
+    CHECK(neat_async_start_fd(fds[1], 4096, NEAT_ASYNC_DROP) == 0);
+    
+    enum { N = 4000 };
+    char line[100];
+    memset(line, 'x', sizeof(line));
+    line[sizeof(line) - 1] = '\n';
+    char buf[256];
+    neat_writer w = neat_writer_fd(fds[1], buf, sizeof(buf));
+    for(size_t i = 0 ; i < N ; i++)
+    {
+        neat_writer_write(&w, line, sizeof(line));
+        neat_writer_flush(&w);
+    }
+    CHECK(neat_async_dropped() > 0);
+    
+    pthread_t reader;
+    pthread_create(&reader, NULL, read_pipe, &fds[0]);
+    neat_async_stop();
+    close(fds[1]);
+    size_t *read_total;
+    pthread_join(reader, (void **) &read_total);
+    close(fds[0]);
+    
+    CHECK(*read_total + neat_async_dropped() == N * sizeof(line));
+    CHECK(*read_total % sizeof(line) == 0); // whole flushes are dropped
+}
+
+int main(void)
+{
+    test_block(0);
+    test_block(1 << 16); // restarted with a bigger ring
+    test_block(5000);    // and a smaller one, rounded up
+    test_flush();
+    test_drop();
+    return TEST_DONE();
+}
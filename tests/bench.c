@@ -0,0 +1,134 @@
+// sh tests/run.sh cc bench
+
+// runs the benchmark on a few values, and checks its rows and allocation counts
+#define main bench_main
+#include "../bench/bench.c"
+#undef main
+#undef malloc
+#undef calloc
+#undef realloc
+
+#include "test.h"
+
+enum { MAX_ROWS = 1000 };
+
+typedef struct { char function[32], type[16], dist[16]; double ns, mbs, allocs; } row;
+
+static row rows[MAX_ROWS];
+static size_t nrows;
+
+// bench_main with args, its stdout put in a 'malloc'ed string
+static char *run(char **args, int nargs)
+{
+    bench_first_row = true;
+    FILE *out = tmpfile();
+    fflush(stdout);
+    int saved = dup(1);
+    dup2(fileno(out), 1);
+    char *argv[8] = { "bench" };
+    memcpy(argv + 1, args, (size_t) nargs * sizeof(*args));
+    CHECK(bench_main(nargs + 1, argv) == 0);
+    fflush(stdout);
+    dup2(saved, 1);
+    close(saved);
+
+    long len = ftell(out);
+    rewind(out);
+    char *s = malloc((size_t) len + 1);
+    CHECK(fread(s, 1, (size_t) len, out) == (size_t) len);
+    s[len] = '\0';
+    fclose(out);
+    return s;
+}
+
+static void read_csv(char *csv)
+{
+    char *line = strtok(csv, "\n");
+    CHECK(line && strcmp(line, "function,type,dist,ns_per_op,mb_per_s,allocs_per_op") == 0);
+    nrows = 0;
+    while((line = strtok(NULL, "\n")) && nrows < MAX_ROWS)
+    {
+        row *r = &rows[nrows++];
+        int end = 0;
+        CHECK(sscanf(line, "%31[^,],%15[^,],%15[^,],%lf,%lf,%lf%n", r->function, r->type, r->dist, &r->ns, &r->mbs, &r->allocs, &end) == 6);
+        CHECK(line[end] == '\0');
+        CHECK(r->ns > 0 && r->mbs >= 0);
+    }
+}
+
+static bool starts_with(const char *s, const char *prefix)
+{
+    return strncmp(s, prefix, strlen(prefix)) == 0;
+}
+
+static bool ends_with(const char *s, const char *suffix)
+{
+    size_t len = strlen(s), n = strlen(suffix);
+    return len >= n && strcmp(s + len - n, suffix) == 0;
+}
+
+static size_t count_rows(const char *function, const char *type)
+{
+    size_t n = 0;
+    for(size_t i = 0 ; i < nrows ; i++)
+        n += strcmp(rows[i].function, function) == 0 && (!type || strcmp(rows[i].type, type) == 0);
+    return n;
+}
+
+int main(void)
+{
+    char *csv = run((char *[]){ "-csv", "-n", "64" }, 3);
+    read_csv(csv);
+    free(csv);
+
+    // every type's formatter and parsers, for each of its distributions
+    const char *int_types[] = { "int8_t", "int16_t", "uint8_t", "uint16_t", "int32_t", "int64_t", "uint32_t", "uint64_t" };
+    for(size_t t = 0 ; t < TEST_LEN(int_types) ; t++)
+    {
+        size_t dists = t < 4 ? 2 : 3;
+        char name[64];
+        snprintf(name, sizeof(name), "neat_%s2str", int_types[t]);
+        CHECK(count_rows(name, int_types[t]) == dists);
+        snprintf(name, sizeof(name), "neat_parse_n_%s", int_types[t]);
+        CHECK(count_rows(name, int_types[t]) == dists);
+        CHECK(count_rows("snprintf", int_types[t]) == dists);
+        CHECK(count_rows("sscanf", int_types[t]) == dists);
+    }
+    CHECK(count_rows("neat_double2str", "double") == 4);
+    CHECK(count_rows("strtod", "double") == 4);
+    CHECK(count_rows("neat_parse_f32", "float") == 4);
+    CHECK(count_rows("array_to_string", NULL) == 2);
+    CHECK(count_rows("fprintln mixed", "mixed") == 1);
+
+    // what each row allocates per value
+    for(size_t i = 0 ; i < nrows ; i++)
+    {
+        const char *f = rows[i].function;
+        if(ends_with(f, "2str"))
+            CHECK(rows[i].allocs == 1);
+        else if(ends_with(f, "2chars") || starts_with(f, "neat_parse") || strcmp(f, "array_to_chars") == 0
+             || strcmp(f, "fprint_array") == 0 || strcmp(f, "fprintln mixed") == 0)
+            CHECK(rows[i].allocs == 0);
+        else if(starts_with(f, "array_to_string"))
+            CHECK(rows[i].allocs > 0 && rows[i].allocs < 1);
+    }
+
+    // the JSON output has the same rows
+    size_t csv_rows = nrows;
+    char *json = run((char *[]){ "-json", "-n", "64" }, 3);
+    CHECK(json[0] == '[' && ends_with(json, "\n]\n"));
+    size_t objects = 0;
+    for(char *p = json ; (p = strchr(p, '{')) ; p++) objects++;
+    CHECK(objects == csv_rows);
+    free(json);
+
+    // only the filtered rows
+    csv = run((char *[]){ "-csv", "-n", "10", "-filter", "neat_parse_n_" }, 5);
+    read_csv(csv);
+    free(csv);
+    CHECK(nrows == 4 * 2 + 4 * 3 + 2 * 4); // 8 and 16 bit ints, 32 and 64 bit ints, float and double
+    for(size_t i = 0 ; i < nrows ; i++)
+        CHECK(starts_with(rows[i].function, "neat_parse_n_"));
+
+    return TEST_DONE();
+}
@@ -0,0 +1,195 @@
+// sh tests/run.sh cc bytes
+
+#include <stddef.h>
+#include <string.h>
+
+typedef struct { unsigned short id; unsigned char level; } item;
+
+static size_t item2bytes(unsigned char *buf, size_t cap, item *it)
+{
+    if(cap >= 3)
+    {
+        buf[0] = (unsigned char) it->id;
+        buf[1] = (unsigned char) (it->id >> 8);
+        buf[2] = it->level;
+    }
+    return 3;
+}
+
+static size_t bytes2item(const unsigned char *buf, size_t len, item *it)
+{
+    if(len < 3) return 0;
+    it->id = (unsigned short) (buf[0] | buf[1] << 8);
+    it->level = buf[2];
+    return 3;
+}
+
+#define SERIALIZABLE_TYPES ADD_SERIALIZABLE(item, item2bytes, bytes2item)
+#define NEAT_TOSTR_IMPLEMENTATION
+#include "neat_tostr.h"
+#include "test.h"
+
+#include <math.h>
+
+// round trip, the size, nothing written when it doesn't fit, and every truncation rejected
+#define check_round_trip(type, v) do { \
+    type check_v = (v), check_back; \
+    unsigned char check_buf[64]; \
+    size_t check_size = to_bytes(check_buf, sizeof(check_buf), check_v); \
+    CHECK(check_size > 0 && check_size <= sizeof(check_buf)); \
+    CHECK(from_bytes(check_buf, check_size, &check_back) == check_size); \
+    CHECK(memcmp(&check_back, &check_v, sizeof(type)) == 0); \
+    for(size_t check_len = 0 ; check_len < check_size ; check_len++) \
+    { \
+        unsigned char check_small[64]; \
+        memset(check_small, 0xAA, sizeof(check_small)); \
+        CHECK(to_bytes(check_small, check_len, check_v) == check_size); \
+        for(size_t check_i = 0 ; check_i < sizeof(check_small) ; check_i++) CHECK(check_small[check_i] == 0xAA); \
+        CHECK(from_bytes(check_buf, check_len, &check_back) == 0); \
+    } \
+} while(0)
+
+static size_t encoded_size(int64_t v)
+{
+    unsigned char buf[16];
+    return to_bytes(buf, sizeof(buf), v);
+}
+
+static void test_numbers(void)
+{
+    for(int r = 0 ; r < 20000 ; r++)
+    {
+        uint64_t u = test_rand() >> (test_rand() % 64);
+        int64_t i = (int64_t) u * (r % 2 ? -1 : 1);
+        check_round_trip(int8_t, (int8_t) i);
+        check_round_trip(int16_t, (int16_t) i);
+        check_round_trip(int32_t, (int32_t) i);
+        check_round_trip(int64_t, i);
+        check_round_trip(uint8_t, (uint8_t) u);
+        check_round_trip(uint16_t, (uint16_t) u);
+        check_round_trip(uint32_t, (uint32_t) u);
+        check_round_trip(uint64_t, u);
+
+        uint64_t bits = test_rand();
+        double d;
+        memcpy(&d, &bits, sizeof(d));
+        check_round_trip(double, d);
+        float f;
+        uint32_t fbits = (uint32_t) bits;
+        memcpy(&f, &fbits, sizeof(f));
+        check_round_trip(float, f);
+    }
+    check_round_trip(int64_t, INT64_MIN);
+    check_round_trip(int64_t, INT64_MAX);
+    check_round_trip(uint64_t, UINT64_MAX);
+    check_round_trip(char, '\0');
+    check_round_trip(char, (char) 0xff);
+    check_round_trip(bool, true);
+    check_round_trip(bool, false);
+
+    // zigzag varints: small values of either sign are one byte
+    CHECK(encoded_size(0) == 1);
+    CHECK(encoded_size(-1) == 1);
+    CHECK(encoded_size(63) == 1);
+    CHECK(encoded_size(-64) == 1);
+    CHECK(encoded_size(64) == 2);
+    CHECK(encoded_size(INT64_MIN) == 10);
+    unsigned char buf[16];
+    CHECK(to_bytes(buf, sizeof(buf), (uint64_t) 300) == 2 && buf[0] == 0xac && buf[1] == 0x02);
+
+    // floats are their little endian bits
+    CHECK(to_bytes(buf, sizeof(buf), 1.0f) == 4);
+    CHECK(buf[0] == 0 && buf[1] == 0 && buf[2] == 0x80 && buf[3] == 0x3f);
+
+    // values that don't fit the type they're read as, and malformed input
+    uint8_t u8;
+    int8_t i8;
+    bool b;
+    to_bytes(buf, sizeof(buf), (uint64_t) 300);
+    CHECK(from_bytes(buf, sizeof(buf), &u8) == 0);
+    to_bytes(buf, sizeof(buf), (int64_t) -200);
+    CHECK(from_bytes(buf, sizeof(buf), &i8) == 0);
+    buf[0] = 2;
+    CHECK(from_bytes(buf, 1, &b) == 0);
+    uint64_t u64;
+    memset(buf, 0xff, 10);
+    buf[9] = 0x01;
+    CHECK(from_bytes(buf, 10, &u64) == 10 && u64 == UINT64_MAX);
+    buf[9] = 0x02; // an 11th bit past 64
+    CHECK(from_bytes(buf, 10, &u64) == 0);
+    buf[9] = 0x80; // more than 10 bytes
+    CHECK(from_bytes(buf, 16, &u64) == 0);
+}
+
+static void test_strings(void)
+{
+    char long_str[300];
+    memset(long_str, 'x', sizeof(long_str) - 1);
+    long_str[sizeof(long_str) - 1] = '\0';
+    char *strs[] = { "", "a", "tab\there", long_str };
+    for(size_t k = 0 ; k < TEST_LEN(strs) ; k++)
+    {
+        unsigned char buf[512];
+        char *s = strs[k];
+        size_t len = strlen(s);
+        size_t size = to_bytes(buf, sizeof(buf), s);
+        CHECK(size == len + (len < 128 ? 1 : 2));
+        char *back = NULL;
+        CHECK(from_bytes(buf, size, &back) == size);
+        CHECK(back && strcmp(back, s) == 0);
+        free(back);
+        for(size_t cut = 0 ; cut < size ; cut++)
+        {
+            back = NULL;
+            CHECK(from_bytes(buf, cut, &back) == 0 && back == NULL);
+            CHECK(to_bytes(buf, cut, s) == size);
+        }
+    }
+}
+
+static void test_arrays(void)
+{
+    enum { N = 500 };
+    static int32_t ints[N], ints_back[N];
+    static double ds[N], ds_back[N];
+    static char chars[N], chars_back[N];
+    static item items[N], items_back[N];
+    static unsigned char buf[N * 16];
+    for(size_t i = 0 ; i < N ; i++)
+    {
+        ints[i] = (int32_t) test_rand() >> (test_rand() % 32);
+        ds[i] = (double) test_rand() / 3.0;
+        chars[i] = (char) test_rand();
+        items[i] = (item){ (unsigned short) test_rand(), (unsigned char) test_rand() };
+    }
+
+#define check_array(arr, back) do { \
+    size_t check_size = array_to_bytes(buf, sizeof(buf), arr, N); \
+    CHECK(check_size > 0 && check_size <= sizeof(buf)); \
+    CHECK(array_from_bytes(buf, check_size, back, N) == check_size); \
+    CHECK(memcmp(arr, back, sizeof(arr)) == 0); \
+    CHECK(array_from_bytes(buf, check_size - 1, back, N) == 0); \
+    CHECK(array_to_bytes(buf, check_size - 1, arr, N) == check_size); \
+} while(0)
+
+    check_array(ints, ints_back);
+    check_array(ds, ds_back);
+    check_array(chars, chars_back);
+    check_array(items, items_back);
+    CHECK(array_to_bytes(buf, sizeof(buf), ds, N) == N * sizeof(double));
+
+    // each element is the same as on its own
+    size_t pos = 0;
+    for(size_t i = 0 ; i < N ; i++) pos += to_bytes(buf + pos, sizeof(buf) - pos, ints[i]);
+    static unsigned char whole[N * 16];
+    CHECK(array_to_bytes(whole, sizeof(whole), ints, N) == pos);
+    CHECK(memcmp(whole, buf, pos) == 0);
+}
+
+int main(void)
+{
+    test_numbers();
+    test_strings();
+    test_arrays();
+    return TEST_DONE();
+}
@@ -0,0 +1,183 @@
+// sh tests/run.sh cc cursor
+
+#define NEAT_TOSTR_IMPLEMENTATION
+#include "neat_tostr.h"
+#include "test.h"
+
+#include <unistd.h>
+#include <inttypes.h>
+
+// reads every int64_t of c, errors are kept as INT64_MIN
+static size_t read_all(neat_cursor *c, int64_t *out, size_t cap)
+{
+    size_t n = 0;
+    while(!neat_cursor_eof(c) && n < cap)
+    {
+        int err;
+        int64_t v = neat_cursor_next(c, int64_t, &err);
+        out[n++] = err == NEAT_PARSE_OK ? v : INT64_MIN;
+    }
+    return n;
+}
+
+// a cursor over a FILE must read the same values as one over the whole buffer, for any cap that fits the fields
+static void test_chunks(void)
+{
+    static const struct { const char *in; char delim; } cases[] = {
+        { "1,2,3", ',' },
+        { "1,2,3\n", ',' },
+        { " 10 , -20 ,30 \r\n\n\n 40,", ',' },
+        { "7,8,\n9", ',' },
+        { "1,,2,x,3", ',' },
+        { "1  22   333  \n4444\n\n", ' ' },
+        { "5\t\t6\t \t7\t", '\t' },
+        { "1 2\t3", ' ' },
+        { "123456789012,1,99999999999999999999,2", ',' },
+    };
+    
+    for(size_t i = 0 ; i < TEST_LEN(cases) ; i++)
+    {
+        const char *in = cases[i].in;
+        size_t len = strlen(in);
+        int64_t want[32], got[32];
+        neat_cursor bc = neat_cursor_buf(in, len, cases[i].delim);
+        size_t n = read_all(&bc, want, 32);
+        
+        // the longest field, with the spaces around it and its separator
+        size_t longest = 0, run = 0;
+        for(size_t j = 0 ; j < len ; j++)
+        {
+            run = in[j] == '\n' || (in[j] == cases[i].delim && !neat_delim_is_blank(cases[i].delim)) ? 0 : run + 1;
+            if(run > longest) longest = run;
+        }
+        
+        for(size_t cap = longest + 1 ; cap <= len + 1 ; cap++)
+        {
+            char buf[64];
+            FILE *f = fmemopen((void *) in, len, "r");
+            neat_cursor fc = neat_cursor_file(f, buf, cap, cases[i].delim);
+            size_t m = read_all(&fc, got, 32);
+            CHECK(m == n && memcmp(got, want, n * sizeof(*got)) == 0);
+            CHECK(fc.err == bc.err);
+            if(m != n || fc.err != bc.err) fprintf(stderr, "  \"%s\" with cap %zu\n", in, cap);
+            fclose(f);
+        }
+    }
+}
+
+// a field that doesn't fit is skipped as one bad value, the ones after it are still read
+static void test_oversized(void)
+{
+    const char in[] = "1,123456789,2\n3,abcdefghijk,4,99999999999999999999999999\n5";
+    int64_t got[16];
+    
+    for(size_t cap = 4 ; cap <= 8 ; cap++)
+    {
+        char buf[8];
+        FILE *f = fmemopen((void *) in, sizeof(in) - 1, "r");
+        neat_cursor c = neat_cursor_file(f, buf, cap, ',');
+        size_t n = read_all(&c, got, 16);
+        int64_t want[] = { 1, INT64_MIN, 2, 3, INT64_MIN, 4, INT64_MIN, 5 };
+        CHECK(n == TEST_LEN(want) && memcmp(got, want, sizeof(want)) == 0);
+        CHECK(c.err == NEAT_PARSE_INVALID);
+        fclose(f);
+    }
+    
+    // and the same for strings
+    const char strs[] = "ab,a_long_name,cd\n";
+    char buf[6];
+    FILE *f = fmemopen((void *) strs, sizeof(strs) - 1, "r");
+    neat_cursor c = neat_cursor_file(f, buf, sizeof(buf), ',');
+    size_t len;
+    const char *s = neat_cursor_next_str(&c, &len);
+    CHECK(len == 2 && memcmp(s, "ab", 2) == 0);
+    s = neat_cursor_next_str(&c, &len);
+    CHECK(len == 0 && c.err == NEAT_PARSE_INVALID);
+    s = neat_cursor_next_str(&c, &len);
+    CHECK(len == 2 && memcmp(s, "cd", 2) == 0);
+    CHECK(neat_cursor_eof(&c));
+    fclose(f);
+}
+
+// records of mixed types through a pipe, written with snprintf
+static void test_records(void)
+{
+    enum { N = 3000 };
+    static int64_t ids[N];
+    static double prices[N];
+    static uint16_t qtys[N];
+    static char text[N * 80];
+    char *p = text;
+    for(size_t i = 0 ; i < N ; i++)
+    {
+        uint64_t r = test_rand();
+        ids[i] = (int64_t) r;
+        prices[i] = (double) (r % 100000) / 100;
+        qtys[i] = (uint16_t) (r >> 40);
+        p += sprintf(p, "%" PRId64 ",name %zu,%.2f, %u%s", ids[i], i, prices[i], (unsigned) qtys[i], i % 10 == 9 ? "\r\n\n" : "\n");
+    }
+    size_t len = (size_t) (p - text);
+    
+    int fds[2];
+    CHECK(pipe(fds) == 0);
+    FILE *w = fdopen(fds[1], "w");
+    pid_t pid = fork();
+    if(pid == 0)
+    {
+        close(fds[0]);
+        fwrite(text, 1, len, w);
+        fclose(w);
+        _exit(0);
+    }
+    fclose(w);
+    
+    char buf[100];
+    neat_cursor c = neat_cursor_fd(fds[0], buf, sizeof(buf), ',');
+    size_t n = 0, bad = 0;
+    while(!neat_cursor_eof(&c) && n < N)
+    {
+        int64_t id = neat_cursor_next(&c, int64_t);
+        size_t name_len;
+        const char *name = neat_cursor_next_str(&c, &name_len);
+        char want_name[32];
+        int want_len = snprintf(want_name, sizeof(want_name), "name %zu", n);
+        bad += name_len != (size_t) want_len || memcmp(name, want_name, name_len) != 0;
+        double price = neat_cursor_next(&c, double);
+        uint16_t qty = neat_cursor_next(&c, uint16_t);
+        bad += id != ids[n] || price != prices[n] || qty != qtys[n];
+        n++;
+    }
+    CHECK(n == N && bad == 0);
+    CHECK(c.err == NEAT_PARSE_OK);
+    CHECK(neat_cursor_eof(&c));
+    close(fds[0]);
+}
+
+static void test_errors(void)
+{
+    const char in[] = "true,x,300,-1.5e3,";
+    neat_cursor c = neat_cursor_buf(in, sizeof(in) - 1, ',');
+    int err;
+    CHECK(neat_cursor_next(&c, bool, &err) && err == NEAT_PARSE_OK);
+    neat_cursor_next(&c, int32_t, &err);
+    CHECK(err == NEAT_PARSE_INVALID && c.err == NEAT_PARSE_INVALID);
+    uint8_t u = neat_cursor_next(&c, uint8_t, &err);
+    CHECK(err == NEAT_PARSE_RANGE && u == UINT8_MAX);
+    CHECK(neat_cursor_next(&c, float, &err) == -1500.0f && err == NEAT_PARSE_OK);
+    CHECK(neat_cursor_eof(&c));
+    neat_cursor_next(&c, int32_t, &err);
+    CHECK(err == NEAT_PARSE_EMPTY);
+    CHECK(c.err == NEAT_PARSE_INVALID); // the first error is kept
+    
+    neat_cursor e = neat_cursor_fd(-1, (char[8]){0}, 8, ',');
+    CHECK(neat_cursor_eof(&e) && e.err == NEAT_PARSE_IO);
+}
+
+int main(void)
+{
+    test_chunks();
+    test_oversized();
+    test_records();
+    test_errors();
+    return TEST_DONE();
+}
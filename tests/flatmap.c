@@ -0,0 +1,158 @@
+// sh tests/run.sh cc flatmap
+
+typedef struct { int hi, lo; } pair;
+static int pair_cmp(const pair *a, const pair *b)
+{
+    if(a->hi != b->hi) return (a->hi > b->hi) - (a->hi < b->hi);
+    return (a->lo > b->lo) - (a->lo < b->lo);
+}
+
+#define SORTABLE_TYPES ADD_SORTABLE(pair, pair_cmp)
+
+#define NEAT_SORT_IMPLEMENTATION
+#include "neat_sort.h"
+#include "test.h"
+
+#include <stdbool.h>
+
+#define NKEYS 500
+
+typedef neat_flatmap(int32_t, int) int_map;
+
+// ref[k] is the value of key k - NKEYS / 2, if has[k]
+typedef struct { int val[NKEYS]; bool has[NKEYS]; } ref_map;
+
+static void check_map(int_map *m, ref_map *ref)
+{
+    size_t n = 0;
+    for(int k = 0 ; k < NKEYS ; k++) n += ref->has[k];
+    CHECK(m->len == n);
+    for(size_t i = 1 ; i < m->len ; i++) CHECK(m->keys[i - 1] < m->keys[i]);
+
+    for(int k = -2 ; k < NKEYS + 2 ; k++)
+    {
+        int32_t key = k - NKEYS / 2;
+        bool has = k >= 0 && k < NKEYS && ref->has[k];
+        int *v = FLATMAP_FIND(*m, key);
+        CHECK((v != NULL) == has);
+        if(v && has) CHECK(*v == ref->val[k]);
+
+        size_t lb = 0, ub = 0;
+        for(size_t i = 0 ; i < m->len ; i++)
+        {
+            lb += m->keys[i] < key;
+            ub += m->keys[i] <= key;
+        }
+        CHECK(FLATMAP_LOWER_BOUND(*m, key) == lb);
+        CHECK(FLATMAP_UPPER_BOUND(*m, key) == ub);
+    }
+}
+
+static void rand_pairs(int32_t *keys, int *vals, size_t n, ref_map *ref)
+{
+    for(size_t i = 0 ; i < n ; i++)
+    {
+        int k = (int) (test_rand() % NKEYS);
+        keys[i] = k - NKEYS / 2;
+        vals[i] = (int) (test_rand() % 1000);
+        ref->has[k] = true;
+        ref->val[k] = vals[i];
+    }
+}
+
+static void test_ints(void)
+{
+    static int32_t keys[2 * NKEYS];
+    static int vals[2 * NKEYS];
+    size_t sizes[] = { 0, 1, 7, 300, 2 * NKEYS };
+
+    for(size_t s = 0 ; s < TEST_LEN(sizes) ; s++)
+    {
+        // build, with repeated keys where the last one wins
+        ref_map ref = {0};
+        int_map m = {0};
+        rand_pairs(keys, vals, sizes[s], &ref);
+        FLATMAP_BUILD(m, keys, vals, sizes[s]);
+        check_map(&m, &ref);
+
+        // insert new keys and overwrite existing ones
+        for(int r = 0 ; r < 200 ; r++)
+        {
+            int k = (int) (test_rand() % NKEYS);
+            int v = (int) (test_rand() % 1000);
+            FLATMAP_INSERT(m, k - NKEYS / 2, v);
+            ref.has[k] = true;
+            ref.val[k] = v;
+        }
+        check_map(&m, &ref);
+
+        // merge into a new map, and in place into either side
+        for(int into = 0 ; into < 3 ; into++)
+        {
+            ref_map ref_b = {0};
+            int_map b = {0};
+            size_t nb = (size_t) test_rand() % (2 * NKEYS);
+            rand_pairs(keys, vals, nb, &ref_b);
+            FLATMAP_BUILD(b, keys, vals, nb);
+
+            for(int k = 0 ; k < NKEYS ; k++)
+            {
+                if(!ref_b.has[k]) continue;
+                ref.has[k] = true;
+                ref.val[k] = ref_b.val[k];
+            }
+
+            if(into == 0)
+            {
+                int_map dst = {0};
+                FLATMAP_MERGE(dst, m, b);
+                check_map(&dst, &ref);
+                FLATMAP_FREE(m);
+                m = dst;
+            }
+            else if(into == 1)
+            {
+                FLATMAP_MERGE(m, m, b);
+                check_map(&m, &ref);
+            }
+            else
+            {
+                FLATMAP_MERGE(b, m, b);
+                check_map(&b, &ref);
+                FLATMAP_FREE(m);
+                m = b;
+                b = (int_map){0};
+            }
+            FLATMAP_FREE(b);
+        }
+        FLATMAP_FREE(m);
+        CHECK(m.len == 0 && m.keys == NULL);
+    }
+}
+
+// keys that go through the generic compare function
+static void test_struct_keys(void)
+{
+    pair keys[] = { { 2, 1 }, { 1, 5 }, { 2, 0 }, { 1, 5 }, { 0, 9 } };
+    double vals[] = { 2.1, 1.5, 2.0, 1.55, 0.9 };
+    neat_flatmap(pair, double) m = {0};
+    FLATMAP_BUILD(m, keys, vals, TEST_LEN(keys));
+
+    CHECK(m.len == 4);
+    double *v = FLATMAP_FIND(m, ((pair){ 1, 5 }));
+    CHECK(v && *v == 1.55);
+    CHECK(FLATMAP_FIND(m, ((pair){ 1, 4 })) == NULL);
+    CHECK(FLATMAP_LOWER_BOUND(m, ((pair){ 2, 0 })) == 2);
+    CHECK(FLATMAP_UPPER_BOUND(m, ((pair){ 2, 0 })) == 3);
+
+    FLATMAP_INSERT(m, ((pair){ 1, 6 }), 1.6);
+    CHECK(m.len == 5 && m.keys[2].lo == 6 && m.vals[2] == 1.6);
+    FLATMAP_FREE(m);
+}
+
+int main(void)
+{
+    test_ints();
+    test_struct_keys();
+    return TEST_DONE();
+}
@@ -0,0 +1,156 @@
+// sh tests/run.sh cc float2str
+
+#define NEAT_TOSTR_IMPLEMENTATION
+#include "neat_tostr.h"
+#include "test.h"
+
+#include <math.h>
+#include <ctype.h>
+
+// the significant digits of s (no sign, point, leading or trailing zeros or exponent), and its decimal exponent
+static int sig_digits(const char *s, char *digits, int *exp10)
+{
+    int n = 0, point = -1, first = -1, pos = 0;
+    if(*s == '-') s++;
+    for( ; *s && *s != 'e' ; s++)
+    {
+        if(*s == '.') { point = pos; continue; }
+        if(first < 0 && *s != '0') first = pos;
+        if(first >= 0) digits[n++] = *s;
+        pos++;
+    }
+    while(n > 0 && digits[n - 1] == '0') n--; // 1000 has one significant digit
+    digits[n] = '\0';
+    if(point < 0) point = pos;
+    *exp10 = *s == 'e' ? atoi(s + 1) : point - first - 1;
+    return n;
+}
+
+static void check_layout(const char *s)
+{
+    char digits[40];
+    int exp10;
+    int n = sig_digits(s, digits, &exp10);
+    CHECK(n > 0 || strcmp(s, "0") == 0 || strcmp(s, "-0") == 0);
+    bool sci = strchr(s, 'e') != NULL;
+    const char *end = sci ? strchr(s, 'e') : s + strlen(s);
+    if(strchr(s, '.')) CHECK(end[-1] != '0' && end[-1] != '.');
+    CHECK(sci == (exp10 < -4 || exp10 >= 16));
+    if(sci)
+    {
+        // d.ddde+XX, at least two exponent digits
+        const char *e = strchr(s, 'e');
+        CHECK(e[1] == '+' || e[1] == '-');
+        CHECK(strlen(e + 2) >= 2 && isdigit((unsigned char) e[2]));
+    }
+}
+
+static void check_double(double v)
+{
+    char s[NEAT_FLOAT_MAX_CHARS + 1];
+    size_t len = neat_double_to_shortest(s, v);
+    CHECK(len < NEAT_FLOAT_MAX_CHARS);
+    s[len] = '\0';
+    double back = strtod(s, NULL);
+    CHECK(memcmp(&back, &v, sizeof(v)) == 0);
+    check_layout(s);
+
+    // one digit less never round-trips
+    char digits[40];
+    int exp10;
+    int n = sig_digits(s, digits, &exp10);
+    if(n > 1)
+    {
+        char shorter[64];
+        snprintf(shorter, sizeof(shorter), "%.*e", n - 2, v);
+        CHECK(strtod(shorter, NULL) != v);
+    }
+}
+
+static void check_float(float v)
+{
+    char s[NEAT_FLOAT_MAX_CHARS + 1];
+    size_t len = neat_float_to_shortest(s, v);
+    CHECK(len < NEAT_FLOAT_MAX_CHARS);
+    s[len] = '\0';
+    float back = strtof(s, NULL);
+    CHECK(memcmp(&back, &v, sizeof(v)) == 0);
+    check_layout(s);
+
+    char digits[40];
+    int exp10;
+    int n = sig_digits(s, digits, &exp10);
+    if(n > 1)
+    {
+        char shorter[64];
+        snprintf(shorter, sizeof(shorter), "%.*e", n - 2, (double) v);
+        CHECK(strtof(shorter, NULL) != v);
+    }
+}
+
+static void check_exact(double v, const char *want)
+{
+    char *s = to_string(v);
+    CHECK_STR(s, want);
+    free(s);
+}
+
+static void check_exact_f(float v, const char *want)
+{
+    char *s = to_string(v);
+    CHECK_STR(s, want);
+    free(s);
+}
+
+int main(void)
+{
+    for(int r = 0 ; r < 200000 ; r++)
+    {
+        uint64_t bits = test_rand();
+        double d;
+        memcpy(&d, &bits, sizeof(d));
+        if(isfinite(d)) check_double(d);
+
+        float f;
+        uint32_t fbits = (uint32_t) bits;
+        memcpy(&f, &fbits, sizeof(f));
+        if(isfinite(f)) check_float(f);
+
+        // integers, short decimals and subnormals are where the special cases are
+        check_double((double) (int64_t) (bits >> (r % 64)));
+        check_double((double) (r % 100000) / 1000.0);
+        check_double((double) (bits >> 12) * 4.9406564584124654e-324);
+        check_float((float) (r % 100000) / 100.0f);
+    }
+    for(int e = -1100 ; e <= 1023 ; e++)
+    {
+        check_double(ldexp(1.0, e));
+        check_double(nextafter(ldexp(1.0, e), 0));
+        check_float(ldexpf(1.0f, e / 8));
+    }
+
+    check_exact(0.1, "0.1");
+    check_exact(0.3, "0.3");
+    check_exact(1.0 / 3.0, "0.3333333333333333");
+    check_exact(123456.789, "123456.789");
+    check_exact(1e15, "1000000000000000");
+    check_exact(1e16, "1e+16");
+    check_exact(1e21, "1e+21");
+    check_exact(0.0001, "0.0001");
+    check_exact(0.00001, "1e-05");
+    check_exact(5e-324, "5e-324");
+    check_exact(DBL_MAX, "1.7976931348623157e+308");
+    check_exact(-0.0, "-0");
+    check_exact(0.0, "0");
+    check_exact(INFINITY, "inf");
+    check_exact(-INFINITY, "-inf");
+    check_exact(NAN, "nan");
+    check_exact(9007199254740993.0, "9007199254740992");
+    check_exact_f(0.1f, "0.1");
+    check_exact_f(16777216.0f, "16777216");
+    check_exact_f(FLT_MAX, "3.4028235e+38");
+    check_exact_f(FLT_MIN, "1.1754944e-38");
+    check_exact_f(1.4e-45f, "1e-45");
+
+    return TEST_DONE();
+}
@@ -0,0 +1,208 @@
+// sh tests/run.sh cc heap
+
+typedef struct { char name[100]; int prio; } big;
+static int big_cmp(const big *a, const big *b) { return (a->prio > b->prio) - (a->prio < b->prio); }
+
+#define SORTABLE_TYPES ADD_SORTABLE(big, big_cmp)
+
+#define NEAT_SORT_IMPLEMENTATION
+#include "neat_sort.h"
+#include "test.h"
+
+#include <stdlib.h>
+
+typedef neat_heap(int) int_heap;
+
+// every parent must not come after its children, and every tracked id must point at its slot
+static int heap_ok(int_heap *h)
+{
+    size_t arity = h->st.arity ? h->st.arity : 2;
+    for(size_t i = 1 ; i < h->st.len ; i++)
+    {
+        int p = h->items[(i - 1) / arity];
+        if(h->st.desc ? p < h->items[i] : p > h->items[i]) return 0;
+    }
+    for(size_t i = 0 ; h->st.ids && i < h->st.len ; i++)
+    {
+        size_t id = h->st.ids[i];
+        if(id != NEAT_HEAP_NO_ID && h->st.pos[id] != i + 1) return 0;
+    }
+    size_t tracked = 0;
+    for(size_t id = 0 ; id < h->st.npos ; id++)
+    {
+        if(h->st.pos[id] == 0) continue;
+        if(h->st.pos[id] > h->st.len || h->st.ids[h->st.pos[id] - 1] != id) return 0;
+        tracked++;
+    }
+    return tracked <= h->st.len;
+}
+
+static int cmp_int(const void *a, const void *b)
+{
+    return (*(const int*)a > *(const int*)b) - (*(const int*)a < *(const int*)b);
+}
+
+static void test_order(unsigned arity, bool desc)
+{
+    enum { N = 1000 };
+    int vals[N], out[N];
+    int_heap h = HEAP_INIT(arity, desc);
+    
+    for(int i = 0 ; i < N ; i++)
+    {
+        vals[i] = (int)(test_rand() % 300) - 150;
+        HEAP_PUSH(h, vals[i]);
+    }
+    CHECK(HEAP_LEN(h) == N);
+    CHECK(heap_ok(&h));
+    
+    for(int i = 0 ; i < N ; i++) out[i] = HEAP_POP(h);
+    CHECK(HEAP_LEN(h) == 0);
+    
+    qsort(vals, N, sizeof(int), cmp_int);
+    int sorted = 1;
+    for(int i = 0 ; i < N ; i++) sorted &= out[i] == vals[desc ? N - 1 - i : i];
+    CHECK(sorted);
+    
+    // from_array gives the same order
+    HEAP_FROM_ARRAY(h, vals, N);
+    CHECK(heap_ok(&h));
+    CHECK(HEAP_PEEK(h) == vals[desc ? N - 1 : 0]);
+    
+    HEAP_FREE(h);
+}
+
+static void test_ids(unsigned arity)
+{
+    enum { N = 200 };
+    int prio[N];
+    int_heap h = HEAP_INIT(arity, false);
+    
+    // a few untracked elements mixed in
+    HEAP_PUSH(h, 50);
+    for(size_t id = 0 ; id < N ; id++)
+    {
+        prio[id] = (int)(test_rand() % 1000);
+        HEAP_PUSH_ID(h, id, prio[id]);
+    }
+    HEAP_PUSH(h, 500);
+    CHECK(heap_ok(&h));
+    
+    for(size_t id = 0 ; id < N ; id++) CHECK(HEAP_CONTAINS(h, id) && HEAP_GET(h, id) == prio[id]);
+    CHECK(!HEAP_CONTAINS(h, N));
+    CHECK(!HEAP_CONTAINS(h, NEAT_HEAP_NO_ID));
+    
+    // decrease and update in both directions
+    for(size_t id = 0 ; id < N ; id += 3)
+    {
+        prio[id] -= 500;
+        HEAP_DECREASE_KEY(h, id, prio[id]);
+    }
+    for(size_t id = 1 ; id < N ; id += 3)
+    {
+        prio[id] += (int)(test_rand() % 1000) - 500;
+        HEAP_UPDATE(h, id, prio[id]);
+    }
+    CHECK(heap_ok(&h));
+    for(size_t id = 0 ; id < N ; id++) CHECK(HEAP_GET(h, id) == prio[id]);
+    
+    // pushing an id that's already there replaces its element
+    size_t len = HEAP_LEN(h);
+    prio[7] = -10000;
+    HEAP_PUSH_ID(h, 7, prio[7]);
+    CHECK(HEAP_LEN(h) == len);
+    CHECK(heap_ok(&h));
+    CHECK(HEAP_TOP_ID(h) == 7 && HEAP_PEEK(h) == -10000);
+    prio[7] = 10000;
+    HEAP_PUSH_ID(h, 7, prio[7]);
+    CHECK(HEAP_LEN(h) == len);
+    CHECK(heap_ok(&h));
+    CHECK(HEAP_GET(h, 7) == 10000);
+    
+    // popping removes the id, in order
+    int last = -100000;
+    size_t popped = 0;
+    while(HEAP_LEN(h) > 0)
+    {
+        size_t id = HEAP_TOP_ID(h);
+        int v = HEAP_POP(h);
+        CHECK(v >= last);
+        last = v;
+        if(id != NEAT_HEAP_NO_ID)
+        {
+            CHECK(v == prio[id]);
+            CHECK(!HEAP_CONTAINS(h, id));
+            popped++;
+        }
+        if(HEAP_LEN(h) % 37 == 0) CHECK(heap_ok(&h));
+    }
+    CHECK(popped == N);
+    
+    // an id can come back after being popped
+    HEAP_PUSH_ID(h, 3, 1);
+    CHECK(HEAP_CONTAINS(h, 3) && HEAP_LEN(h) == 1);
+    
+    HEAP_FREE(h);
+    CHECK(!HEAP_CONTAINS(h, 3));
+}
+
+// HEAP_FROM_ARRAY drops all tracking, for every length
+static void test_from_array_clears_ids(void)
+{
+    int arr[] = { 9, 4, 6 };
+    
+    for(size_t n = 0 ; n <= 3 ; n++)
+    {
+        int_heap h = {0};
+        HEAP_PUSH_ID(h, 3, 30);
+        HEAP_PUSH_ID(h, 7, 70);
+        HEAP_FROM_ARRAY(h, arr, n);
+        
+        CHECK(HEAP_LEN(h) == n);
+        CHECK(!HEAP_CONTAINS(h, 3));
+        CHECK(!HEAP_CONTAINS(h, 7));
+        CHECK(n == 0 || HEAP_TOP_ID(h) == NEAT_HEAP_NO_ID);
+        CHECK(heap_ok(&h));
+        
+        // and tracking works again afterwards
+        HEAP_PUSH_ID(h, 7, 1);
+        CHECK(HEAP_CONTAINS(h, 7) && HEAP_GET(h, 7) == 1 && HEAP_TOP_ID(h) == 7);
+        CHECK(heap_ok(&h));
+        
+        HEAP_FREE(h);
+    }
+}
+
+// elements larger than the sift buffer
+static void test_big(void)
+{
+    neat_heap(big) h = HEAP_INIT(4, true);
+    for(int i = 0 ; i < 100 ; i++)
+    {
+        big b = { .prio = (i * 37) % 100 };
+        snprintf(b.name, sizeof(b.name), "item %d", b.prio);
+        HEAP_PUSH_ID(h, (size_t)i, b);
+    }
+    for(int i = 99 ; i >= 0 ; i--)
+    {
+        big b = HEAP_POP(h);
+        char name[100];
+        snprintf(name, sizeof(name), "item %d", i);
+        CHECK(b.prio == i);
+        CHECK_STR(b.name, name);
+    }
+    HEAP_FREE(h);
+}
+
+int main(void)
+{
+    for(unsigned arity = 2 ; arity <= 5 ; arity++)
+    {
+        test_order(arity, false);
+        test_order(arity, true);
+        test_ids(arity);
+    }
+    test_from_array_clears_ids();
+    test_big();
+    return TEST_DONE();
+}
@@ -0,0 +1,81 @@
+// sh tests/run.sh cc int2str
+
+#define NEAT_TOSTR_IMPLEMENTATION
+#include "neat_tostr.h"
+#include "test.h"
+
+#include <inttypes.h>
+
+static void check_u64(uint64_t v)
+{
+    char want[32], got[32];
+    int len = snprintf(want, sizeof(want), "%" PRIu64, v);
+    CHECK(neat_count_digits(v) == len);
+    got[neat_u64_to_dec(got, v)] = '\0';
+    CHECK_STR(got, want);
+
+    int64_t i = (int64_t) v;
+    snprintf(want, sizeof(want), "%" PRId64, i);
+    got[neat_i64_to_dec(got, i)] = '\0';
+    CHECK_STR(got, want);
+    if(i == INT64_MIN) return;
+    i = -i;
+    snprintf(want, sizeof(want), "%" PRId64, i);
+    got[neat_i64_to_dec(got, i)] = '\0';
+    CHECK_STR(got, want);
+}
+
+// the 2str functions allocate exactly the longest string of their type, the sanitizers catch an overflow
+#define check_2str(type, v, fmt) do { \
+    type check_v = (v); \
+    char check_want[32]; \
+    snprintf(check_want, sizeof(check_want), fmt, check_v); \
+    char *check_s = to_string(check_v); \
+    CHECK_STR(check_s, check_want); \
+    free(check_s); \
+} while(0)
+
+int main(void)
+{
+    // every digit count boundary, and around every power of two
+    for(int d = 0 ; d < 20 ; d++)
+    {
+        uint64_t p = 1;
+        for(int k = 0 ; k < d ; k++) p *= 10;
+        check_u64(p - 1);
+        check_u64(p);
+        check_u64(p + 1);
+    }
+    for(int b = 0 ; b < 64 ; b++)
+    {
+        uint64_t p = (uint64_t) 1 << b;
+        check_u64(p - 1);
+        check_u64(p);
+        check_u64(p + 1);
+    }
+    check_u64(UINT64_MAX);
+    check_u64((uint64_t) INT64_MIN);
+    for(int r = 0 ; r < 100000 ; r++) check_u64(test_rand() >> (r % 64));
+
+    // 8 and 16 bit types, all of them
+    for(int v = INT16_MIN ; v <= INT16_MAX ; v++) check_2str(int16_t, (int16_t) v, "%d");
+    for(int v = 0 ; v <= UINT16_MAX ; v++) check_2str(uint16_t, (uint16_t) v, "%u");
+    for(int v = INT8_MIN ; v <= INT8_MAX ; v++) check_2str(int8_t, (int8_t) v, "%d");
+    for(int v = 0 ; v <= UINT8_MAX ; v++) check_2str(uint8_t, (uint8_t) v, "%u");
+
+    check_2str(int32_t, INT32_MIN, "%" PRId32);
+    check_2str(int32_t, INT32_MAX, "%" PRId32);
+    check_2str(uint32_t, UINT32_MAX, "%" PRIu32);
+    check_2str(int64_t, INT64_MIN, "%" PRId64);
+    check_2str(int64_t, INT64_MAX, "%" PRId64);
+    check_2str(uint64_t, UINT64_MAX, "%" PRIu64);
+    for(int r = 0 ; r < 10000 ; r++)
+    {
+        check_2str(int32_t, (int32_t) test_rand(), "%" PRId32);
+        check_2str(uint32_t, (uint32_t) test_rand(), "%" PRIu32);
+        check_2str(int64_t, (int64_t) test_rand(), "%" PRId64);
+        check_2str(uint64_t, test_rand(), "%" PRIu64);
+    }
+
+    return TEST_DONE();
+}
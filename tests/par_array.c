@@ -0,0 +1,115 @@
+// sh tests/run.sh cc par_array
+
+#include <stdio.h>
+#include <stdlib.h>
+
+typedef struct { int x, y; } point;
+typedef struct { unsigned id; } cell;
+
+static char *point2str(point *p)
+{
+    char *s = malloc(32);
+    snprintf(s, 32, "(%d %d)", p->x, p->y);
+    return s;
+}
+
+static size_t cell2chars(char *buf, size_t cap, cell *c)
+{
+    return (size_t) snprintf(buf, cap, "#%u", c->id);
+}
+
+// small chunks, so the test arrays are split between every thread and printed in many rounds
+#define NEAT_ARRAY_PAR_CHUNK ((size_t) 1000)
+#define NEAT_TOSTR_THREADS
+#define STRINGABLE_TYPES ADD_STRINGABLE(point, point2str), ADD_STRINGABLE_BUF(cell, cell2chars)
+#define NEAT_TOSTR_IMPLEMENTATION
+#include "neat_tostr.h"
+#include "test.h"
+
+#define N 20011
+
+// print_array through a file, read back as a string
+static char *print_to_string(FILE *f)
+{
+    long len = ftell(f);
+    rewind(f);
+    char *s = malloc((size_t) len + 1);
+    CHECK(fread(s, 1, (size_t) len, f) == (size_t) len);
+    s[len] = '\0';
+    rewind(f);
+    return s;
+}
+
+// every thread count gives the one thread output, for array_to_string and print_array
+#define check_threads(arr, n, fmt) do { \
+    neat_array_fmt check_fmt = (fmt); \
+    check_fmt.nthreads = 1; \
+    char *check_want = array_to_string(arr, n, check_fmt); \
+    FILE *check_f = tmpfile(); \
+    fprint_array(check_f, arr, n, check_fmt); \
+    char *check_printed = print_to_string(check_f); \
+    CHECK_STR(check_printed, check_want); \
+    free(check_printed); \
+    for(int check_t = 2 ; check_t <= 8 ; check_t++) \
+    { \
+        check_fmt.nthreads = check_t; \
+        char *check_got = array_to_string(arr, n, check_fmt); \
+        CHECK_STR(check_got, check_want); \
+        free(check_got); \
+        fprint_array(check_f, arr, n, check_fmt); \
+        check_got = print_to_string(check_f); \
+        CHECK_STR(check_got, check_want); \
+        free(check_got); \
+    } \
+    fclose(check_f); \
+    free(check_want); \
+} while(0)
+
+int main(void)
+{
+    static int8_t i8[N]; static int64_t i64[N]; static uint32_t u32[N];
+    static double d[N]; static float f[N];
+    static char c[N]; static bool b[N]; static char *strs[N];
+    static point pts[N]; static cell cells[N];
+    static char words[N][8];
+    for(size_t i = 0 ; i < N ; i++)
+    {
+        uint64_t r = test_rand();
+        i8[i] = (int8_t) r;
+        i64[i] = (int64_t) r >> (r % 64);
+        u32[i] = (uint32_t) r;
+        memcpy(&d[i], &r, sizeof(d[i]));
+        f[i] = (float) i / 7.0f;
+        c[i] = (char) (r % 26 + 'a');
+        b[i] = r & 1;
+        snprintf(words[i], sizeof(words[i]), "w%u", (unsigned) (r % 100000));
+        strs[i] = words[i];
+        pts[i] = (point){ (int) (r % 1000), -(int) i };
+        cells[i] = (cell){ (unsigned) r >> (r % 32) };
+    }
+
+    neat_array_fmt plain = NEAT_ARRAY_FMT_DEFAULT;
+    neat_array_fmt fixed = { .open = "", .sep = "\n", .close = "\n", .precision = 3 };
+    neat_array_fmt json = NEAT_ARRAY_FMT_JSON;
+    check_threads(i8, N, plain);
+    check_threads(i64, N, plain);
+    check_threads(u32, N, json);
+    check_threads(d, N, plain);
+    check_threads(d, N, fixed);
+    check_threads(f, N, fixed);
+    check_threads(c, N, plain);
+    check_threads(c, N, json);
+    check_threads(b, N, plain);
+    check_threads(strs, N, plain);
+    check_threads(strs, N, json);
+    check_threads(pts, N, plain);
+    check_threads(cells, N, plain);
+
+    // sizes around the chunk, where the parts are first split
+    for(size_t n = 0 ; n < 3 * NEAT_ARRAY_PAR_CHUNK ; n += 499)
+        check_threads(i64, n, plain);
+    check_threads(i64, NEAT_ARRAY_PAR_CHUNK, plain);
+    check_threads(i64, NEAT_ARRAY_PAR_CHUNK + 1, plain);
+
+    return TEST_DONE();
+}
@@ -0,0 +1,220 @@
+// sh tests/run.sh cc parse_array
+
+#define NEAT_TOSTR_IMPLEMENTATION
+#include "neat_tostr.h"
+#include "test.h"
+
+#include <stdlib.h>
+#include <errno.h>
+#include <inttypes.h>
+#include <math.h>
+
+// the separator rule, checked against parse_array and the cursor (which must agree)
+typedef struct { const char *in; char delim; int64_t vals[8]; size_t count; int err; } rule_case;
+
+static const rule_case rule_cases[] = {
+    { "1,2,3",          ',', { 1, 2, 3 }, 3, NEAT_PARSE_OK },
+    { "1,2,3\n",        ',', { 1, 2, 3 }, 3, NEAT_PARSE_OK },
+    { " 1 , 2 ,3 \r\n", ',', { 1, 2, 3 }, 3, NEAT_PARSE_OK },
+    { "1\n\n\n2\n  \n", ',', { 1, 2 },    2, NEAT_PARSE_OK },
+    { "",               ',', { 0 },       0, NEAT_PARSE_OK },
+    { "\n \n",          ',', { 0 },       0, NEAT_PARSE_OK },
+    // a delim at the end of a line
+    { "1,2,",           ',', { 1, 2 },    2, NEAT_PARSE_OK },
+    { "7,8,\n9",        ',', { 7, 8, 9 }, 3, NEAT_PARSE_OK },
+    { "7,8, \r\n9,",    ',', { 7, 8, 9 }, 3, NEAT_PARSE_OK },
+    // empty fields anywhere else
+    { "1,,2",           ',', { 1 },       1, NEAT_PARSE_EMPTY },
+    { "1, ,2",          ',', { 1 },       1, NEAT_PARSE_EMPTY },
+    { ",1",             ',', { 0 },       0, NEAT_PARSE_EMPTY },
+    { "1\n,2",          ',', { 1 },       1, NEAT_PARSE_EMPTY },
+    { "1,2,,\n3",       ',', { 1, 2 },    2, NEAT_PARSE_EMPTY },
+    // blank delims collapse
+    { "1  2\t3",        ' ', { 1 },       1, NEAT_PARSE_INVALID },
+    { "1 \t 2\t",       ' ', { 1, 2 },    2, NEAT_PARSE_OK },
+    { "1  2   3  \n4",  ' ', { 1, 2, 3, 4 }, 4, NEAT_PARSE_OK },
+    { "  1 2\n\n 3 ",   ' ', { 1, 2, 3 }, 3, NEAT_PARSE_OK },
+    { "1\t\t2\t \t3\t", '\t', { 1, 2, 3 }, 3, NEAT_PARSE_OK },
+    // bad values
+    { "1,x,3",          ',', { 1 },       1, NEAT_PARSE_INVALID },
+    { "1,2 3,4",        ',', { 1 },       1, NEAT_PARSE_INVALID },
+    { "1,99999999999999999999", ',', { 1 }, 1, NEAT_PARSE_RANGE },
+};
+
+static void test_rule(void)
+{
+    for(size_t i = 0 ; i < TEST_LEN(rule_cases) ; i++)
+    {
+        const rule_case *t = &rule_cases[i];
+        size_t len = strlen(t->in);
+        int64_t out[8];
+        
+        neat_parse_array_result r = parse_array(int64_t, t->in, len, t->delim, out, 8);
+        CHECK(r.err == t->err);
+        CHECK(r.count == t->count);
+        CHECK(memcmp(out, t->vals, r.count * sizeof(int64_t)) == 0);
+        if(r.err != t->err || r.count != t->count) fprintf(stderr, "  parse_array on \"%s\"\n", t->in);
+        
+        // the cursor skips a bad field and goes on, so only up to the first error is compared
+        neat_cursor c = neat_cursor_buf(t->in, len, t->delim);
+        size_t n = 0;
+        int64_t got[16];
+        while(!neat_cursor_eof(&c) && n < 16)
+        {
+            int err;
+            int64_t v = neat_cursor_next(&c, int64_t, &err);
+            if(c.err != NEAT_PARSE_OK) break;
+            got[n++] = v;
+        }
+        CHECK(c.err == t->err);
+        CHECK(n == t->count && memcmp(got, t->vals, n * sizeof(int64_t)) == 0);
+        if(c.err != t->err || n != t->count) fprintf(stderr, "  cursor on \"%s\"\n", t->in);
+    }
+}
+
+// random values of every type, written with snprintf and read back against the C library
+#define ROUND_TRIP_INT(T, fmt, strto) do { \
+enum { N = 500 }; \
+T vals[N], out[N]; \
+char buf[N * 32], *p = buf; \
+for(size_t i = 0 ; i < N ; i++) { \
+    uint64_t r = test_rand(); \
+    vals[i] = (T) (i % 4 == 0 ? r % 100 : r); \
+    p += sprintf(p, i % 7 == 6 ? " %" fmt " \n" : "%" fmt ",", vals[i]); \
+} \
+neat_parse_array_result r = parse_array(T, buf, (size_t) (p - buf), ',', out, N); \
+CHECK(r.err == NEAT_PARSE_OK && r.count == N && r.pos == (size_t) (p - buf)); \
+CHECK(memcmp(vals, out, sizeof(vals)) == 0); \
+for(size_t i = 0 ; i < N ; i++) { \
+    char one[32]; \
+    snprintf(one, sizeof(one), "%" fmt, vals[i]); \
+    CHECK((T) strto(one, NULL, 10) == out[i]); \
+} \
+} while(0)
+
+static void test_ints(void)
+{
+    ROUND_TRIP_INT(int8_t, PRId8, strtoll);
+    ROUND_TRIP_INT(int16_t, PRId16, strtoll);
+    ROUND_TRIP_INT(int32_t, PRId32, strtoll);
+    ROUND_TRIP_INT(int64_t, PRId64, strtoll);
+    ROUND_TRIP_INT(uint8_t, PRIu8, strtoull);
+    ROUND_TRIP_INT(uint16_t, PRIu16, strtoull);
+    ROUND_TRIP_INT(uint32_t, PRIu32, strtoull);
+    ROUND_TRIP_INT(uint64_t, PRIu64, strtoull);
+    
+    // limits
+    const char lim[] = "-128,127,-129,128";
+    int8_t i8[4];
+    neat_parse_array_result r = parse_array(int8_t, lim, sizeof(lim) - 1, ',', i8, 4);
+    CHECK(r.count == 2 && i8[0] == -128 && i8[1] == 127);
+    CHECK(r.err == NEAT_PARSE_RANGE && r.pos == 9);
+    
+    const char u[] = "18446744073709551615\n18446744073709551616";
+    uint64_t u64[2];
+    r = parse_array(uint64_t, u, sizeof(u) - 1, ',', u64, 2);
+    CHECK(r.count == 1 && u64[0] == UINT64_MAX && r.err == NEAT_PARSE_RANGE);
+}
+
+static void test_floats(void)
+{
+    enum { N = 2000 };
+    static double out[N];
+    static char buf[N * 320];
+    char *p = buf;
+    static const char *fmts[] = { "%.17g", "%.3f", "%g", "%.10e", "%.0f" };
+    for(size_t i = 0 ; i < N ; i++)
+    {
+        uint64_t r = test_rand();
+        double d;
+        memcpy(&d, &r, sizeof(d));
+        if(!isfinite(d)) d = (double) (r % 1000) / 7;
+        p += sprintf(p, fmts[i % 5], d);
+        *p++ = i % 9 == 8 ? '\n' : ';';
+    }
+    
+    // every field must match strtod of the same text
+    neat_parse_array_result r = parse_array(double, buf, (size_t) (p - buf), ';', out, N);
+    CHECK(r.err == NEAT_PARSE_OK && r.count == N);
+    const char *s = buf;
+    for(size_t i = 0 ; i < N ; i++)
+    {
+        char *e;
+        double d = strtod(s, &e);
+        CHECK(memcmp(&d, &out[i], sizeof(d)) == 0);
+        s = e + 1;
+    }
+    
+    float f[4];
+    const char fs[] = "1.5, -0, 3.4028235e38, 1e-46";
+    r = parse_array(float, fs, sizeof(fs) - 1, ',', f, 4);
+    CHECK(r.err == NEAT_PARSE_OK && r.count == 4);
+    CHECK(f[0] == 1.5f && f[1] == 0 && signbit(f[1]) && f[2] == strtof("3.4028235e38", NULL) && f[3] == 0);
+}
+
+static void test_other_types(void)
+{
+    const char bs[] = "true,false, true\nfalse,1";
+    bool b[5];
+    neat_parse_array_result r = parse_array(bool, bs, sizeof(bs) - 1, ',', b, 5);
+    CHECK(r.count == 4 && b[0] && !b[1] && b[2] && !b[3]);
+    CHECK(r.err == NEAT_PARSE_INVALID && r.pos == sizeof(bs) - 2);
+    
+    const char cs[] = "a,b,\r\nc\n\n, ";
+    char c[8];
+    r = parse_array(char, cs, sizeof(cs) - 1, ',', c, 8);
+    CHECK(r.count == 3 && memcmp(c, "abc", 3) == 0);
+    CHECK(r.err == NEAT_PARSE_EMPTY);
+    
+    char ss[] = "ab,,c,\r\nd e\n\nf,";
+    char *strs[8];
+    r = parse_array(char*, ss, sizeof(ss) - 1, ',', strs, 8);
+    CHECK(r.err == NEAT_PARSE_OK && r.count == 5);
+    if(r.count == 5)
+    {
+        CHECK_STR(strs[0], "ab");
+        CHECK_STR(strs[1], "");
+        CHECK_STR(strs[2], "c");
+        CHECK_STR(strs[3], "d e");
+        CHECK_STR(strs[4], "f");
+    }
+    
+    char ws[] = "a  b\t c\n";
+    r = parse_array(char*, ws, sizeof(ws) - 1, ' ', strs, 8);
+    CHECK(r.count == 3);
+    if(r.count == 3)
+    {
+        CHECK_STR(strs[0], "a");
+        CHECK_STR(strs[1], "b\t");
+        CHECK_STR(strs[2], "c");
+    }
+}
+
+// a full out is continued from buf + pos
+static void test_continue(void)
+{
+    const char buf[] = "1,2,3\n4,5\n\n6,7,";
+    int32_t out[3], all[16];
+    size_t n = 0, pos = 0;
+    for(;;)
+    {
+        neat_parse_array_result r = parse_array(int32_t, buf + pos, sizeof(buf) - 1 - pos, ',', out, 3);
+        CHECK(r.err == NEAT_PARSE_OK);
+        memcpy(all + n, out, r.count * sizeof(*out));
+        n += r.count;
+        pos += r.pos;
+        if(r.count < 3) break;
+    }
+    CHECK(n == 7 && pos == sizeof(buf) - 1);
+    for(size_t i = 0 ; i < n ; i++) CHECK(all[i] == (int32_t) i + 1);
+}
+
+int main(void)
+{
+    test_rule();
+    test_ints();
+    test_floats();
+    test_other_types();
+    test_continue();
+    return TEST_DONE();
+}
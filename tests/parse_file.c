@@ -0,0 +1,117 @@
+// sh tests/run.sh cc parse_file
+
+// small chunks, so a test file is split into many chunks and parts
+#define NEAT_PARSE_FILE_CHUNK ((size_t) 4096)
+#define NEAT_TOSTR_THREADS
+#define NEAT_TOSTR_IMPLEMENTATION
+#include "neat_tostr.h"
+#include "test.h"
+
+#include <stdlib.h>
+#include <inttypes.h>
+#include <unistd.h>
+
+static char path[] = "/tmp/neat_parse_file_XXXXXX";
+
+static void write_file(const char *text, size_t len)
+{
+    FILE *f = fopen(path, "wb");
+    fwrite(text, 1, len, f);
+    fclose(f);
+}
+
+// parse_file with any number of threads must match parse_array of the same text
+static void check_file(const char *text, size_t len, size_t max_vals)
+{
+    write_file(text, len);
+    // one more than fits, so parse_array doesn't stop because out is full
+    int64_t *want = malloc((max_vals + 1) * sizeof(*want));
+    neat_parse_array_result wr = parse_array(int64_t, text, len, ',', want, max_vals + 1);
+    
+    for(int threads = 1 ; threads <= 8 ; threads *= 2)
+    {
+        int64_t *got = NULL;
+        neat_parse_array_result r = parse_file(int64_t, path, ',', &got, threads);
+        CHECK(r.err == wr.err && r.count == wr.count && r.pos == wr.pos);
+        CHECK(wr.count == 0 || (got && memcmp(got, want, wr.count * sizeof(*got)) == 0));
+        if(r.err != wr.err || r.count != wr.count || r.pos != wr.pos)
+            fprintf(stderr, "  %d threads: err %d/%d count %zu/%zu pos %zu/%zu\n", threads, r.err, wr.err, r.count, wr.count, r.pos, wr.pos);
+        free(got);
+    }
+    free(want);
+}
+
+static void test_ints(void)
+{
+    enum { N = 40000 };
+    static char text[N * 24];
+    char *p = text;
+    for(size_t i = 0 ; i < N ; i++)
+    {
+        int64_t v = (int64_t) test_rand() >> (test_rand() % 64);
+        p += sprintf(p, "%" PRId64 "%s", v, i % 8 == 7 ? ",\n" : i % 100 == 99 ? "\n\n" : ", ");
+    }
+    size_t len = (size_t) (p - text);
+    check_file(text, len, N);
+    
+    // a bad value in a later part, the values before it come back and pos is its offset in the file
+    char *bad = text + len * 3 / 4;
+    while(*bad != ',') bad++;
+    bad[1] = 'x';
+    check_file(text, len, N);
+    bad[1] = ' ';
+    
+    // no newline at all, split after a delim
+    for(char *q = text ; q < p ; q++) if(*q == '\n') *q = ' ';
+    check_file(text, len, N);
+}
+
+static void test_doubles(void)
+{
+    enum { N = 20000 };
+    static char text[N * 32];
+    static double want[N];
+    char *p = text;
+    for(size_t i = 0 ; i < N ; i++)
+    {
+        uint64_t r = test_rand();
+        double d;
+        memcpy(&d, &r, sizeof(d));
+        if(d != d || d - d != 0) d = (double) r / 3;
+        p += sprintf(p, "%.17g\n", d);
+        want[i] = d;
+    }
+    write_file(text, (size_t) (p - text));
+    double *got = NULL;
+    neat_parse_array_result r = parse_file(double, path, ',', &got, 4);
+    CHECK(r.err == NEAT_PARSE_OK && r.count == N);
+    CHECK(got && memcmp(got, want, sizeof(want)) == 0);
+    free(got);
+}
+
+static void test_edges(void)
+{
+    int64_t *got = (int64_t *) 1;
+    neat_parse_array_result r = parse_file(int64_t, "/nonexistent/neat_test", ',', &got);
+    CHECK(r.err == NEAT_PARSE_IO && r.count == 0 && got == NULL);
+    
+    check_file("", 0, 0);
+    check_file("\n\n", 2, 0);
+    check_file("1,2,", 4, 2);
+    check_file("5", 1, 1);
+    check_file("1,,2", 4, 2);
+}
+
+int main(void)
+{
+    int fd = mkstemp(path);
+    CHECK(fd >= 0);
+    close(fd);
+    
+    test_ints();
+    test_doubles();
+    test_edges();
+    
+    unlink(path);
+    return TEST_DONE();
+}
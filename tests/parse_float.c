@@ -0,0 +1,117 @@
+// sh tests/run.sh cc parse_float
+
+#define NEAT_TOSTR_IMPLEMENTATION
+#include "neat_tostr.h"
+#include "test.h"
+
+#include <math.h>
+
+// parse_f64 and parse_f32 must give strtod's and strtof's bits and end pointer
+static void check_str(const char *s)
+{
+    char *ref_end, *end;
+    int err;
+
+    double ref = strtod(s, &ref_end);
+    double v = neat_parse_f64(s, &end, &err);
+    CHECK(end == ref_end);
+    if(ref_end == s)
+    {
+        CHECK(err == NEAT_PARSE_EMPTY || err == NEAT_PARSE_INVALID);
+    }
+    else
+    {
+        CHECK(memcmp(&v, &ref, sizeof(v)) == 0 || (isnan(v) && isnan(ref)));
+        bool overflow = isinf(ref) && strpbrk(s, "iI") == NULL;
+        CHECK(err == (overflow ? NEAT_PARSE_RANGE : NEAT_PARSE_OK));
+    }
+    if(memcmp(&v, &ref, sizeof(v)) != 0 && !isnan(ref)) fprintf(stderr, "  double \"%s\"\n", s);
+
+    float reff = strtof(s, &ref_end);
+    float f = neat_parse_f32(s, &end, &err);
+    CHECK(end == ref_end);
+    if(ref_end != s)
+    {
+        CHECK(memcmp(&f, &reff, sizeof(f)) == 0 || (isnan(f) && isnan(reff)));
+        bool overflow = isinf(reff) && strpbrk(s, "iI") == NULL;
+        CHECK(err == (overflow ? NEAT_PARSE_RANGE : NEAT_PARSE_OK));
+    }
+    if(memcmp(&f, &reff, sizeof(f)) != 0 && !isnan(reff)) fprintf(stderr, "  float \"%s\"\n", s);
+}
+
+// up to 40 digits with a point somewhere, and an exponent that reaches past both ends of double
+static void rand_decimal(char *s)
+{
+    char *p = s;
+    if(test_rand() % 2) *p++ = '-';
+    int n = 1 + (int) (test_rand() % 40);
+    int point = (int) (test_rand() % (n + 1));
+    for(int i = 0 ; i < n ; i++)
+    {
+        if(i == point) *p++ = '.';
+        *p++ = (char) ('0' + test_rand() % 10);
+    }
+    if(test_rand() % 4) p += sprintf(p, "e%d", (int) (test_rand() % 800) - 400);
+}
+
+int main(void)
+{
+    char s[1024];
+    for(int r = 0 ; r < 100000 ; r++)
+    {
+        uint64_t bits = test_rand();
+        double d;
+        memcpy(&d, &bits, sizeof(d));
+        if(isnan(d)) continue;
+
+        // the shortest form, 17 digits, and many more than 19 digits
+        snprintf(s, sizeof(s), "%.17g", d); check_str(s);
+        snprintf(s, sizeof(s), "%.30e", d); check_str(s);
+        char *shortest = to_string(d);
+        check_str(shortest);
+        free(shortest);
+
+        // exactly halfway between two doubles, then just above and below it: needs every digit
+        if(r % 16 == 0 && isfinite(d) && d != 0)
+        {
+            long double mid = ((long double) d + (long double) nextafter(d, INFINITY)) / 2;
+            int len = snprintf(s, sizeof(s), "%.*Le", 760, mid);
+            if(len < (int) sizeof(s))
+            {
+                check_str(s);
+                char *e = strchr(s, 'e');
+                char *last = e - 1;
+                while(*last == '0') last--;
+                char saved = *last;
+                if(*last < '9') { (*last)++; check_str(s); }
+                *last = saved;
+                if(*last > '0' && last[-1] != '.') { (*last)--; check_str(s); }
+            }
+        }
+
+        float f;
+        uint32_t fbits = (uint32_t) bits;
+        memcpy(&f, &fbits, sizeof(f));
+        if(!isnan(f))
+        {
+            snprintf(s, sizeof(s), "%.9g", f); check_str(s);
+            snprintf(s, sizeof(s), "%.40e", (double) f + (double) (nextafterf(f, INFINITY) - f) / 2); check_str(s);
+        }
+
+        rand_decimal(s);
+        check_str(s);
+    }
+
+    const char *edges[] = {
+        "0", "-0", "0.0", ".5", "5.", "00000.000001", "1e", "1e+", "1e-x", "2e308", "-2e308", "1.8e308",
+        "1.7976931348623157e308", "1.7976931348623158e308", "4.9406564584124654e-324", "2.4703282292062327e-324",
+        "2.4703282292062328e-324", "1e-400", "2.2250738585072011e-308", "2.2250738585072014e-308",
+        "3.4028235e38", "3.4028236e38", "1.17549435e-38", "1e-46", "9007199254740993", "9007199254740993.0000000001",
+        "inf", "-Infinity", "INF", "nan", "NaN", "nan(123)", "nan(", "infinit", "  12.5", "\t-3e2x", "", " ",
+        "-", "+.", ".", "e5", "0.000000000000000000000000000000000000000000001e45",
+        "123456789012345678901234567890", "1" "000000000000000000000000000000000000000000000000000000000000000001e-62",
+    };
+    for(size_t i = 0 ; i < TEST_LEN(edges) ; i++) check_str(edges[i]);
+
+    return TEST_DONE();
+}
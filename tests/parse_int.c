@@ -0,0 +1,127 @@
+// sh tests/run.sh cc parse_int
+
+#define NEAT_TOSTR_IMPLEMENTATION
+#include "neat_tostr.h"
+#include "test.h"
+
+#include <errno.h>
+#include <inttypes.h>
+
+// spaces, a sign, up to 25 digits (often with leading zeros) and something after them
+static void rand_int_str(char *s)
+{
+    char *p = s;
+    for(int i = test_rand() % 3 ; i > 0 ; i--) *p++ = " \t\n"[test_rand() % 3];
+    int sign = (int) (test_rand() % 4);
+    if(sign == 1) *p++ = '-';
+    if(sign == 2) *p++ = '+';
+    for(int i = test_rand() % 4 == 0 ? (int) (test_rand() % 5) : 0 ; i > 0 ; i--) *p++ = '0';
+    int n = (int) (test_rand() % 26);
+    if(test_rand() % 2) n = 17 + (int) (test_rand() % 5); // around where 64 bits run out
+    for(int i = 0 ; i < n ; i++) *p++ = (char) ('0' + test_rand() % 10);
+    const char *tails[] = { "", "", " ", ",7", "x", ".5", "e3" };
+    strcpy(p, tails[test_rand() % TEST_LEN(tails)]);
+}
+
+// the signed limits are checked against strtoll, the unsigned ones against strtoull
+static void check_i64(const char *s, int64_t min, int64_t max)
+{
+    char *ref_end;
+    errno = 0;
+    long long ref = strtoll(s, &ref_end, 10);
+    bool range = errno == ERANGE || ref < min || ref > max;
+    if(range) ref = ref < 0 ? min : max;
+
+    char *end;
+    int err;
+    int64_t v = neat_parse_i64(s, &end, min, max, &err);
+    CHECK(end == ref_end);
+    if(ref_end == s) CHECK(err == NEAT_PARSE_EMPTY || err == NEAT_PARSE_INVALID);
+    else if(range) CHECK(err == NEAT_PARSE_RANGE && v == ref);
+    else CHECK(err == NEAT_PARSE_OK && v == ref);
+}
+
+static void check_u64(const char *s, uint64_t max)
+{
+    char *ref_end;
+    errno = 0;
+    unsigned long long ref = strtoull(s, &ref_end, 10);
+    const char *p = s;
+    while(*p == ' ' || *p == '\t' || *p == '\n') p++;
+    bool neg = *p == '-', range = errno == ERANGE || ref > max;
+    if(neg)
+    {
+        // strtoull wraps negative numbers around, here only -0 is fine
+        range = ref != 0;
+        ref = 0;
+    }
+    else if(range)
+    {
+        ref = max;
+    }
+
+    char *end;
+    int err;
+    uint64_t v = neat_parse_u64(s, &end, max, &err);
+    CHECK(end == ref_end);
+    if(ref_end == s) CHECK(err == NEAT_PARSE_EMPTY || err == NEAT_PARSE_INVALID);
+    else if(range) CHECK(err == NEAT_PARSE_RANGE && v == ref);
+    else CHECK(err == NEAT_PARSE_OK && v == ref);
+}
+
+int main(void)
+{
+    char s[64];
+    for(int r = 0 ; r < 200000 ; r++)
+    {
+        rand_int_str(s);
+        check_i64(s, INT64_MIN, INT64_MAX);
+        check_i64(s, INT32_MIN, INT32_MAX);
+        check_i64(s, INT8_MIN, INT8_MAX);
+        check_u64(s, UINT64_MAX);
+        check_u64(s, UINT16_MAX);
+    }
+
+    // every limit, one past it, and far past it
+    const char *edges[] = {
+        "9223372036854775807", "9223372036854775808", "-9223372036854775808", "-9223372036854775809",
+        "18446744073709551615", "18446744073709551616", "99999999999999999999", "100000000000000000000",
+        "-18446744073709551616", "0000000000000000000000000000042", "-0", "+0", "2147483647", "2147483648",
+        "-2147483648", "-2147483649", "127", "128", "-128", "-129", "255", "256", "65535", "65536",
+    };
+    for(size_t i = 0 ; i < TEST_LEN(edges) ; i++)
+    {
+        check_i64(edges[i], INT64_MIN, INT64_MAX);
+        check_i64(edges[i], INT32_MIN, INT32_MAX);
+        check_i64(edges[i], INT8_MIN, INT8_MAX);
+        check_u64(edges[i], UINT64_MAX);
+        check_u64(edges[i], UINT32_MAX);
+        check_u64(edges[i], UINT8_MAX);
+    }
+
+    // the errors, through parse
+    int err;
+    CHECK(parse(int32_t, "", &err) == 0 && err == NEAT_PARSE_EMPTY);
+    CHECK(parse(int32_t, " \t ", &err) == 0 && err == NEAT_PARSE_EMPTY);
+    CHECK(parse(int32_t, "-", &err) == 0 && err == NEAT_PARSE_INVALID);
+    CHECK(parse(uint8_t, "+x", &err) == 0 && err == NEAT_PARSE_INVALID);
+    CHECK(parse(int64_t, "abc", &err) == 0 && err == NEAT_PARSE_INVALID);
+    CHECK(parse(int16_t, "-40000", &err) == INT16_MIN && err == NEAT_PARSE_RANGE);
+    CHECK(parse(uint32_t, "-1", &err) == 0 && err == NEAT_PARSE_RANGE);
+    CHECK(parse(uint32_t, " 42 ", &err) == 42 && err == NEAT_PARSE_OK);
+    CHECK(parse(int8_t, "-128") == -128);
+
+    // end lets the same buffer be scanned further
+    const char *list = "12 -3\t+45,6";
+    char *p = (char *) list;
+    int64_t sum = 0;
+    for(int i = 0 ; i < 4 ; i++)
+    {
+        sum += neat_parse_i64(p, &p, INT64_MIN, INT64_MAX, &err);
+        CHECK(err == NEAT_PARSE_OK);
+        if(*p == ',') p++;
+    }
+    CHECK(sum == 60 && *p == '\0');
+
+    return TEST_DONE();
+}
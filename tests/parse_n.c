@@ -0,0 +1,103 @@
+// sh tests/run.sh cc parse_n
+
+#include <stddef.h>
+
+typedef struct { int major, minor; } version;
+
+// "major.minor", never reading past str + len
+static version parse_version_n(const char *str, size_t len, int *err)
+{
+    version v = {0};
+    size_t i = 0;
+    int *part = &v.major;
+    *err = len == 0 ? -2 : 0;
+    for( ; i < len ; i++)
+    {
+        if(str[i] == '.' && part == &v.major) part = &v.minor;
+        else if(str[i] >= '0' && str[i] <= '9') *part = *part * 10 + (str[i] - '0');
+        else { *err = -1; break; }
+    }
+    return v;
+}
+
+#define PARSABLE_N_TYPES ADD_PARSABLE_N(version, parse_version_n)
+#define NEAT_TOSTR_IMPLEMENTATION
+#include "neat_tostr.h"
+#include "test.h"
+
+#include <math.h>
+
+// a copy of s without the NUL, so the sanitizers catch any read past len
+static char *exact_copy(const char *s, size_t len)
+{
+    char *p = malloc(len ? len : 1);
+    memcpy(p, s, len);
+    return p;
+}
+
+// parse_n on [s, s + len) must be parse on a NUL terminated copy of it
+#define check_parse_n(type, s, len) do { \
+    char *check_span = exact_copy(s, len); \
+    char check_str[128]; \
+    memcpy(check_str, s, len); \
+    check_str[len] = '\0'; \
+    int check_err_n, check_err; \
+    type check_a = parse_n(type, check_span, len, &check_err_n); \
+    type check_b = parse(type, check_str, &check_err); \
+    CHECK(memcmp(&check_a, &check_b, sizeof(type)) == 0 || (check_a != check_a && check_b != check_b)); \
+    CHECK(check_err_n == check_err); \
+    free(check_span); \
+} while(0)
+
+static void rand_number(char *s)
+{
+    static const char *parts[] = { "", " ", "-", "+", "0", "7", "12", "999", "18446744073709551616", ".", ".5", "e", "e-3", "x", "inf", "nan", "1e400" };
+    s[0] = '\0';
+    for(int i = test_rand() % 5 ; i >= 0 ; i--) strcat(s, parts[test_rand() % TEST_LEN(parts)]);
+}
+
+int main(void)
+{
+    char s[128];
+    for(int r = 0 ; r < 50000 ; r++)
+    {
+        rand_number(s);
+        size_t len = strlen(s);
+        // a few prefixes of it
+        for(size_t n = test_rand() % (len + 1) ; n <= len ; n += 1 + len / 4)
+        {
+            check_parse_n(int8_t, s, n);
+            check_parse_n(int32_t, s, n);
+            check_parse_n(int64_t, s, n);
+            check_parse_n(uint16_t, s, n);
+            check_parse_n(uint64_t, s, n);
+            check_parse_n(float, s, n);
+            check_parse_n(double, s, n);
+        }
+    }
+
+    // a number cut short by len, with more digits right after it in memory
+    int err;
+    CHECK(parse_n(int32_t, "12345", 3, &err) == 123 && err == NEAT_PARSE_OK);
+    CHECK(parse_n(double, "1.5e10", 4, &err) == 1.5 && err == NEAT_PARSE_OK);
+    CHECK(parse_n(double, "1.5e10", 5) == 15);
+    CHECK(parse_n(uint8_t, "300", 2) == 30);
+    CHECK(parse_n(int64_t, "42", 0, &err) == 0 && err == NEAT_PARSE_EMPTY);
+    CHECK(isinf(parse_n(float, "infinity", 3)));
+
+    CHECK(parse_n(bool, "truex", 4, &err) == true && err == NEAT_PARSE_OK);
+    CHECK(parse_n(bool, "true", 3, &err) == false && err == NEAT_PARSE_INVALID);
+    CHECK(parse_n(bool, "false", 5, &err) == false && err == NEAT_PARSE_OK);
+    CHECK(parse_n(char, "xy", 2, &err) == 'x' && err == NEAT_PARSE_OK);
+    CHECK(parse_n(char, "xy", 0, &err) == '\0' && err == NEAT_PARSE_EMPTY);
+
+    // a user type
+    char *span = exact_copy("10.25", 5);
+    version v = parse_n(version, span, 4, &err);
+    CHECK(v.major == 10 && v.minor == 2 && err == 0);
+    v = parse_n(version, span, 5);
+    CHECK(v.major == 10 && v.minor == 25);
+    free(span);
+
+    return TEST_DONE();
+}
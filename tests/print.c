@@ -0,0 +1,129 @@
+// sh tests/run.sh cc print
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+
+typedef struct { int x, y; } point;
+typedef struct { const char *name; } tag;
+
+static size_t point2chars(char *buf, size_t cap, point *p)
+{
+    return (size_t) snprintf(buf, cap, "(%d, %d)", p->x, p->y);
+}
+
+static char *tag2str(tag *t)
+{
+    size_t len = strlen(t->name);
+    char *s = malloc(len + 3);
+    snprintf(s, len + 3, "<%s>", t->name);
+    return s;
+}
+
+#define STRINGABLE_TYPES ADD_STRINGABLE_BUF(point, point2chars), ADD_STRINGABLE(tag, tag2str)
+#define NEAT_TOSTR_IMPLEMENTATION
+#include "neat_tostr.h"
+#include "test.h"
+
+#include <inttypes.h>
+#include <unistd.h>
+
+static FILE *out;
+static char got[1 << 16];
+
+// everything printed to out since the last call
+static const char *take(void)
+{
+    fflush(out);
+    long len = ftell(out);
+    rewind(out);
+    size_t n = fread(got, 1, (size_t) len, out);
+    got[n] = '\0';
+    rewind(out);
+    ftruncate(fileno(out), 0);
+    return got;
+}
+
+static void test_numbers(void)
+{
+    char want[512];
+    for(int r = 0 ; r < 2000 ; r++)
+    {
+        uint64_t u = test_rand() >> (test_rand() % 64);
+        int64_t i = (int64_t) test_rand() >> (test_rand() % 64);
+        int32_t i32 = (int32_t) test_rand();
+        uint8_t u8 = (uint8_t) test_rand();
+        int8_t i8 = (int8_t) test_rand();
+        int16_t i16 = (int16_t) test_rand();
+        fprintln(out, u, " ", i, " ", i32, " ", u8, " ", i8, " ", i16);
+        snprintf(want, sizeof(want), "%" PRIu64 " %" PRId64 " %" PRId32 " %u %d %d\n", u, i, i32, (unsigned) u8, (int) i8, (int) i16);
+        CHECK_STR(take(), want);
+    }
+    
+    // doubles print the shortest string that parses back
+    for(int r = 0 ; r < 2000 ; r++)
+    {
+        uint64_t bits = test_rand();
+        double d;
+        memcpy(&d, &bits, sizeof(d));
+        if(d != d || d - d != 0) continue;
+        fprint(out, d);
+        double back = strtod(take(), NULL);
+        CHECK(memcmp(&back, &d, sizeof(d)) == 0);
+    }
+    fprint(out, 0.5, " ", -2.0f, " ", 1e21);
+    CHECK_STR(take(), "0.5 -2 1e+21");
+}
+
+static void test_mixed(void)
+{
+    char *s = "str";
+    char buf[] = "buf";
+    point p = { 3, -4 };
+    tag t = { "tag" };
+    
+    fprint(out, s, buf, (char) 'c', (bool) true, (bool) false, p, t, (char*) "lit");
+    CHECK_STR(take(), "strbufctruefalse(3, -4)<tag>lit");
+    
+    // 20 args, and output longer than the writer's buffer
+    fprint(out, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20);
+    CHECK_STR(take(), "1234567891011121314151617181920");
+    
+    static char long_str[5000], want[10100];
+    memset(long_str, 'a', sizeof(long_str) - 1);
+    fprint(out, long_str, long_str, p);
+    snprintf(want, sizeof(want), "%s%s(3, -4)", long_str, long_str);
+    CHECK_STR(take(), want);
+    
+    char wbuf[16];
+    neat_writer w = neat_writer_file(out, wbuf, sizeof(wbuf));
+    for(int i = 0 ; i < 3 ; i++) wprintln(&w, "line ", i, (char) ' ', p);
+    neat_writer_flush(&w);
+    CHECK_STR(take(), "line 0 (3, -4)\nline 1 (3, -4)\nline 2 (3, -4)\n");
+}
+
+static void test_arrays(void)
+{
+    int32_t ints[] = { 1, -2, 3 };
+    fprint_array(out, ints, 3);
+    CHECK_STR(take(), "{1, -2, 3}");
+    
+    point pts[] = { { 1, 2 }, { 3, 4 } };
+    fprintln_array(out, pts, 2);
+    CHECK_STR(take(), "{(1, 2), (3, 4)}\n");
+    
+    fprint_array(out, ints, 0);
+    CHECK_STR(take(), "{}");
+}
+
+int main(void)
+{
+    out = tmpfile();
+    test_numbers();
+    test_mixed();
+    test_arrays();
+    fclose(out);
+    return TEST_DONE();
+}
@@ -0,0 +1,69 @@
+// sh tests/run.sh cc print_bound
+
+#define NEAT_TOSTR_IMPLEMENTATION
+#include "neat_tostr.h"
+#include "test.h"
+
+#include <float.h>
+#include <math.h>
+
+// the bounds are constant expressions
+_Static_assert(NEAT_PRINT_BOUND((int32_t) 0, (char) 0, (bool) 0) == 11 + 1 + 5, "print bound of numbers");
+_Static_assert(NEAT_PRINT_BOUND((int64_t) 0, (char*) 0) >= NEAT_PRINT_UNBOUNDED, "a string makes the bound unknown");
+_Static_assert(neat_max_chars((uint8_t) 0) == 3, "max chars of uint8_t");
+
+// the longest string of every bounded type must fit its bound, and reach it for the integers
+#define check_max(obj, exact) do { \
+    char check_buf[64]; \
+    size_t check_len = to_chars(check_buf, sizeof(check_buf), obj); \
+    CHECK(check_len <= (size_t) neat_max_chars(obj)); \
+    if(exact) CHECK(check_len == (size_t) neat_max_chars(obj)); \
+} while(0)
+
+int main(void)
+{
+    check_max((int8_t) INT8_MIN, true);
+    check_max((int16_t) INT16_MIN, true);
+    check_max(INT32_MIN, true);
+    check_max(INT64_MIN, true);
+    check_max((uint8_t) UINT8_MAX, true);
+    check_max((uint16_t) UINT16_MAX, true);
+    check_max(UINT32_MAX, true);
+    check_max(UINT64_MAX, true);
+    check_max((bool) false, true);
+    check_max((char) 'c', true);
+
+    check_max(-DBL_MIN, false);
+    check_max(-DBL_MAX, false);
+    check_max(-DBL_TRUE_MIN, false);
+    check_max(-FLT_MIN, false);
+    check_max(-FLT_MAX, false);
+    check_max(-NAN, false);
+    check_max(-INFINITY, false);
+    for(int r = 0 ; r < 100000 ; r++)
+    {
+        uint64_t bits = test_rand();
+        double d;
+        memcpy(&d, &bits, sizeof(d));
+        check_max(d, false);
+        float f;
+        uint32_t fbits = (uint32_t) bits;
+        memcpy(&f, &fbits, sizeof(f));
+        check_max(f, false);
+    }
+
+    // with a buffer sized from the bound, the longest values of every arg never flush before the end
+    FILE *out = tmpfile();
+    enum { bound = NEAT_PRINT_BOUND(INT64_MIN, -DBL_MIN, (char) 'x', (bool) false, UINT64_MAX, -FLT_MIN) };
+    char wbuf[NEAT_PRINT_BUF_SIZE(bound)];
+    neat_writer w = neat_writer_file(out, wbuf, sizeof(wbuf));
+    wprintln(&w, INT64_MIN, -DBL_MIN, (char) 'x', (bool) false, UINT64_MAX, -FLT_MIN);
+    size_t len = w.len;
+    CHECK(ftell(out) == 0);
+    CHECK(len > 0 && len <= bound + 1);
+    neat_writer_flush(&w);
+    CHECK(ftell(out) == (long) len);
+    fclose(out);
+
+    return TEST_DONE();
+}
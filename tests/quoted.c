@@ -0,0 +1,194 @@
+// sh tests/run.sh cc quoted
+
+#define NEAT_TOSTR_IMPLEMENTATION
+#include "neat_tostr.h"
+#include "test.h"
+
+// a plain JSON escaper to check against
+static size_t ref_quote(char *out, const char *str, size_t len)
+{
+    size_t n = 0;
+    out[n++] = '"';
+    for(size_t i = 0 ; i < len ; i++)
+    {
+        unsigned char c = (unsigned char) str[i];
+        switch(c)
+        {
+            case '"':  n += (size_t) sprintf(out + n, "\\\""); break;
+            case '\\': n += (size_t) sprintf(out + n, "\\\\"); break;
+            case '\b': n += (size_t) sprintf(out + n, "\\b"); break;
+            case '\f': n += (size_t) sprintf(out + n, "\\f"); break;
+            case '\n': n += (size_t) sprintf(out + n, "\\n"); break;
+            case '\r': n += (size_t) sprintf(out + n, "\\r"); break;
+            case '\t': n += (size_t) sprintf(out + n, "\\t"); break;
+            default:
+                if(c < 0x20) n += (size_t) sprintf(out + n, "\\u%04x", c);
+                else out[n++] = (char) c;
+        }
+    }
+    out[n++] = '"';
+    out[n] = '\0';
+    return n;
+}
+
+// everything written to f so far, and f emptied
+static char *read_back(FILE *f)
+{
+    long len = ftell(f);
+    rewind(f);
+    char *s = malloc((size_t) len + 1);
+    CHECK(fread(s, 1, (size_t) len, f) == (size_t) len);
+    s[len] = '\0';
+    rewind(f);
+    return s;
+}
+
+// mostly plain text, with escapes anywhere and in runs, and bytes past 0x7f
+static void rand_string(char *s, size_t len)
+{
+    static const char specials[] = "\"\\\n\t\r\b\f\x01\x1f ~\x7f\x80\xff";
+    int dense = test_rand() % 4 == 0;
+    for(size_t i = 0 ; i < len ; i++)
+    {
+        uint64_t r = test_rand();
+        if(r % (dense ? 2 : 23) == 0) s[i] = specials[(r >> 8) % (sizeof(specials) - 1)];
+        else if(r % 31 == 1) s[i] = (char) ((r >> 8) % 255 + 1);
+        else s[i] = (char) ((r >> 8) % 26 + 'a');
+    }
+    s[len] = '\0';
+}
+
+static void test_strings(FILE *f)
+{
+    static char s[300], want[300 * 6 + 3];
+    static const size_t caps[] = { 1, 5, 7, 64, 1024 };
+    for(int r = 0 ; r < 20000 ; r++)
+    {
+        size_t len = r < 300 ? (size_t) r : test_rand() % 300;
+        rand_string(s, len);
+        ref_quote(want, s, len);
+
+        fprint_quoted(f, s);
+        char *got = read_back(f);
+        CHECK_STR(got, want);
+        free(got);
+
+        // every size of writer, down to one byte
+        char wbuf[1024];
+        neat_writer w = neat_writer_file(f, wbuf, caps[r % TEST_LEN(caps)]);
+        wprint_quoted(&w, s);
+        neat_writer_flush(&w);
+        got = read_back(f);
+        CHECK_STR(got, want);
+        free(got);
+    }
+
+    // one escape at every offset, across the 16 and 8 byte scans
+    for(size_t len = 1 ; len <= 70 ; len++)
+    {
+        for(size_t at = 0 ; at < len ; at++)
+        {
+            memset(s, 'x', len);
+            s[len] = '\0';
+            s[at] = at % 2 ? '\x1f' : '"';
+            ref_quote(want, s, len);
+            fprint_quoted(f, s);
+            char *got = read_back(f);
+            CHECK_STR(got, want);
+            free(got);
+        }
+    }
+}
+
+static void test_args(FILE *f)
+{
+    // every char, NUL included
+    for(int c = 0 ; c < 256 ; c++)
+    {
+        char ch = (char) c, want[16];
+        ref_quote(want, &ch, 1);
+        fprint_quoted(f, ch);
+        char *got = read_back(f);
+        CHECK_STR(got, want);
+        free(got);
+    }
+
+    // only char* and char are quoted
+    char *s = "say \"hi\"\n";
+    fprintln_quoted(f, (int32_t) -3, s, (char) '\t', (bool) true, 1.5);
+    char *got = read_back(f);
+    CHECK_STR(got, "-3\"say \\\"hi\\\"\\n\"\"\\t\"true1.5\n");
+    free(got);
+    fprint_quoted(f, (char*) "");
+    got = read_back(f);
+    CHECK_STR(got, "\"\"");
+    free(got);
+}
+
+static void test_arrays(FILE *f)
+{
+    enum { N = 500 };
+    static char words[N][40];
+    static char *strs[N];
+    static char chars[N];
+    static char want[N * 40 * 6 + 3 * N];
+    for(size_t i = 0 ; i < N ; i++)
+    {
+        rand_string(words[i], test_rand() % 40);
+        strs[i] = words[i];
+        chars[i] = (char) test_rand();
+    }
+
+    size_t len = (size_t) sprintf(want, "[");
+    for(size_t i = 0 ; i < N ; i++)
+    {
+        if(i) want[len++] = ',';
+        len += ref_quote(want + len, strs[i], strlen(strs[i]));
+    }
+    strcpy(want + len, "]");
+    char *got = array_to_string_json(strs, N);
+    CHECK_STR(got, want);
+    free(got);
+    fprint_array(f, strs, N, NEAT_ARRAY_FMT_JSON);
+    got = read_back(f);
+    CHECK_STR(got, want);
+    free(got);
+
+    len = (size_t) sprintf(want, "[");
+    for(size_t i = 0 ; i < N ; i++)
+    {
+        if(i) want[len++] = ',';
+        len += ref_quote(want + len, &chars[i], 1);
+    }
+    strcpy(want + len, "]");
+    got = array_to_string_json(chars, N);
+    CHECK_STR(got, want);
+    free(got);
+    fprint_array(f, chars, N, NEAT_ARRAY_FMT_JSON);
+    got = read_back(f);
+    CHECK_STR(got, want);
+    free(got);
+
+    // numbers aren't quoted, and without .quote nothing is
+    int32_t nums[] = { 1, -2, 3 };
+    got = array_to_string_json(nums, 3);
+    CHECK_STR(got, "[1,-2,3]");
+    free(got);
+    char *raw[] = { "a\"b", "c" };
+    got = array_to_string(raw, 2);
+    CHECK_STR(got, "{a\"b, c}");
+    free(got);
+    got = array_to_string_json(raw, 0);
+    CHECK_STR(got, "[]");
+    free(got);
+}
+
+int main(void)
+{
+    FILE *f = tmpfile();
+    test_strings(f);
+    test_args(f);
+    test_arrays(f);
+    fclose(f);
+    return TEST_DONE();
+}
@@ -0,0 +1,33 @@
+#!/bin/sh
+# Builds and runs every test with the sanitizers.
+#
+#   sh tests/run.sh [compiler] [test names...]
+#
+# e.g. sh tests/run.sh cc heap cursor. CFLAGS is added to the build flags,
+# set SAN= to build without the sanitizers.
+
+cc=${1:-cc}
+[ $# -gt 0 ] && shift
+root=$(cd "$(dirname "$0")/.." && pwd)
+san=${SAN--fsanitize=address,undefined -fno-sanitize-recover=all}
+tmp=$(mktemp -d)
+trap 'rm -rf "$tmp"' EXIT
+
+if [ $# -eq 0 ]; then
+    set -- $(cd "$root/tests" && ls *.c | sed 's/\.c$//')
+fi
+
+failed=0
+for t in "$@"; do
+    if ! $cc -std=gnu11 -Wall -Wextra -g $san $CFLAGS -I"$root" "$root/tests/$t.c" -o "$tmp/$t" -lm -pthread; then
+        echo "FAIL $t (build)"
+        failed=$((failed + 1))
+    elif (cd "$tmp" && "./$t"); then
+        echo "ok   $t"
+    else
+        echo "FAIL $t"
+        failed=$((failed + 1))
+    fi
+done
+
+[ $failed -eq 0 ] || { echo "$failed failed"; exit 1; }
@@ -0,0 +1,133 @@
+// sh tests/run.sh cc search
+
+typedef struct { int id; char pad[12]; } rec;
+static int rec_cmp(const rec *a, const rec *b) { return (a->id > b->id) - (a->id < b->id); }
+
+#define SORTABLE_TYPES ADD_SORTABLE(rec, rec_cmp)
+
+#define NEAT_SORT_IMPLEMENTATION
+#include "neat_sort.h"
+#include "test.h"
+
+#include <stdlib.h>
+#include <math.h>
+
+#define N 3000
+
+// the shapes the interpolation has to cope with
+enum { UNIFORM, SKEWED, DUPLICATES, EXTREMES, NSHAPES };
+
+#define check_isearch(type, arr, n, key) do { \
+    type check_key = (key); \
+    size_t check_lb = 0; \
+    while(check_lb < (n) && (arr)[check_lb] < check_key) check_lb++; \
+    type *check_p = ISEARCH_PTR(arr, n, check_key); \
+    if(check_lb < (n) && (arr)[check_lb] == check_key) CHECK(check_p && *check_p == check_key); \
+    else CHECK(check_p == NULL); \
+} while(0)
+
+static void test_isearch_i64(void)
+{
+    static int64_t arr[N];
+    for(int shape = 0 ; shape < NSHAPES ; shape++)
+    {
+        for(size_t n = 0 ; n <= N ; n = n * 3 + 1)
+        {
+            for(size_t i = 0 ; i < n ; i++)
+            {
+                int64_t r = (int64_t) (test_rand() >> 1);
+                switch(shape)
+                {
+                    case UNIFORM:    arr[i] = r % 100000 - 50000; break;
+                    case SKEWED:     arr[i] = (int64_t) i * (int64_t) i * (int64_t) i; break;
+                    case DUPLICATES: arr[i] = r % 5; break;
+                    case EXTREMES:   arr[i] = i % 3 == 0 ? INT64_MIN + r % 10 : i % 3 == 1 ? INT64_MAX - r % 10 : r; break;
+                }
+            }
+            SORT_PTR(arr, n);
+            for(int r = 0 ; r < 300 ; r++)
+            {
+                // present keys, their neighbours and random ones
+                int64_t key = n ? arr[test_rand() % n] : 0;
+                if(r % 3 == 1 && key != INT64_MAX) key++;
+                if(r % 3 == 2) key = (int64_t) test_rand();
+                check_isearch(int64_t, arr, n, key);
+            }
+            if(n)
+            {
+                check_isearch(int64_t, arr, n, arr[0]);
+                check_isearch(int64_t, arr, n, arr[n - 1]);
+            }
+            check_isearch(int64_t, arr, n, INT64_MIN);
+            check_isearch(int64_t, arr, n, INT64_MAX);
+        }
+    }
+}
+
+static void test_isearch_small(void)
+{
+    static uint8_t u8[N];
+    static uint64_t u64[N];
+    static double d[N];
+    for(size_t i = 0 ; i < N ; i++)
+    {
+        u8[i] = (uint8_t) test_rand();
+        u64[i] = test_rand() >> (test_rand() % 64);
+        d[i] = i % 7 == 0 ? -INFINITY : i % 11 == 0 ? INFINITY : exp((double) (test_rand() % 4000) / 100.0 - 20);
+    }
+    SORT(u8);
+    SORT(u64);
+    SORT(d);
+    for(int r = 0 ; r < 1000 ; r++)
+    {
+        check_isearch(uint8_t, u8, N, (uint8_t) test_rand());
+        check_isearch(uint64_t, u64, N, u64[test_rand() % N]);
+        check_isearch(uint64_t, u64, N, u64[test_rand() % N] + 1);
+        check_isearch(double, d, N, d[test_rand() % N]);
+        check_isearch(double, d, N, d[test_rand() % N] * 1.0000001);
+    }
+    check_isearch(double, d, N, NAN);
+    check_isearch(double, d, N, INFINITY);
+}
+
+static void test_gallop(void)
+{
+    static int32_t arr[N];
+    static rec recs[N];
+    for(size_t i = 0 ; i < N ; i++) arr[i] = (int32_t) (test_rand() % (2 * N));
+    SORT(arr);
+    for(size_t i = 0 ; i < N ; i++) recs[i].id = arr[i];
+
+    size_t sizes[] = { 0, 1, 2, 100, N };
+    for(size_t s = 0 ; s < TEST_LEN(sizes) ; s++)
+    {
+        size_t n = sizes[s];
+        size_t hint = 0, rec_hint = 0;
+        for(int r = 0 ; r < 2000 ; r++)
+        {
+            // mostly increasing keys, sometimes jumping back, with hints past the end
+            int32_t key = r % 10 ? (int32_t) (r * 3 / 2) : (int32_t) (test_rand() % (2 * N + 2)) - 1;
+            if(r % 50 == 0) hint = rec_hint = (size_t) test_rand() % (n + 5);
+
+            size_t lb = 0;
+            while(lb < n && arr[lb] < key) lb++;
+            bool found = lb < n && arr[lb] == key;
+
+            int32_t *p = GALLOP_SEARCH_PTR(arr, n, key, &hint);
+            CHECK(hint == lb);
+            CHECK(found ? p && *p == key : p == NULL);
+
+            rec *q = GALLOP_SEARCH_PTR(recs, n, ((rec){ .id = key }), &rec_hint);
+            CHECK(rec_hint == lb);
+            CHECK(found ? q && q->id == key : q == NULL);
+        }
+    }
+}
+
+int main(void)
+{
+    test_isearch_i64();
+    test_isearch_small();
+    test_gallop();
+    return TEST_DONE();
+}
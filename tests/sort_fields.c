@@ -0,0 +1,151 @@
+// sh tests/run.sh cc sort_fields
+
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+// lets the test make the radix sort's realloc fail
+static bool fail_realloc;
+static void *test_realloc(void *p, size_t size) { return fail_realloc ? NULL : realloc(p, size); }
+#define realloc(p, size) test_realloc(p, size)
+
+typedef struct Order { int32_t prio; uint64_t ts; char tag; } Order;
+typedef struct Wide { double score; int8_t grp; bool flag; uint16_t seq; char pad[48]; } Wide;
+typedef struct Mixed { float f; int64_t i; uint8_t u; int16_t s; uint32_t w; } Mixed;
+
+#define SORTABLE_TYPES ADD_SORTABLE_FIELDS(Order), ADD_SORTABLE_FIELDS(Wide), ADD_SORTABLE_FIELDS(Mixed)
+
+#define NEAT_SORT_IMPLEMENTATION
+#include "neat_sort.h"
+#include "test.h"
+
+DEFINE_SORTABLE_FIELDS(Order, (prio, DESC), (ts, ASC), (tag, ASC))
+DEFINE_SORTABLE_FIELDS(Wide, (grp, ASC), (score, DESC), (flag, ASC))
+DEFINE_SORTABLE_FIELDS(Mixed, (f, ASC), (i, DESC), (u, ASC), (s, DESC), (w, ASC))
+
+#undef realloc
+
+enum { N = 3000 };
+
+// stable insertion sort with the generated compare, the reference for both sorts
+#define REF_SORT(arr, n, cmp) do { \
+for(size_t i = 1 ; i < (n) ; i++) { \
+    typeof(*(arr)) v = (arr)[i]; \
+    size_t j = i; \
+    while(j > 0 && cmp(&(arr)[j - 1], &v) > 0) { (arr)[j] = (arr)[j - 1]; j--; } \
+    (arr)[j] = v; \
+} \
+} while(0)
+
+// the keys must order like the compare function
+#define CHECK_KEYS(type, a, b) do { \
+uint8_t ka[neat_##type##_key_size], kb[neat_##type##_key_size]; \
+neat_##type##_key(&(a), ka); \
+neat_##type##_key(&(b), kb); \
+int c = memcmp(ka, kb, sizeof(ka)); \
+int f = neat_##type##_fields_cmp(&(a), &(b)); \
+CHECK((c > 0) - (c < 0) == f); \
+} while(0)
+
+static Order orders[N], orders_ref[N];
+static Wide wides[N], wides_ref[N];
+static Mixed mixed[N], mixed_ref[N];
+
+static void fill(void)
+{
+    for(size_t i = 0 ; i < N ; i++)
+    {
+        uint64_t r = test_rand();
+        orders[i] = (Order) {
+            .prio = i % 100 == 0 ? INT32_MIN : (int32_t) (r % 7) - 3,
+            .ts = r % 5 == 0 ? UINT64_MAX - r % 3 : (r >> 8) % 50,
+            .tag = (char) (i % 3 ? 'a' + (int) (i % 5) : -5),
+        };
+        snprintf(wides[i].pad, sizeof(wides[i].pad), "#%zu", i);
+        wides[i].score = (double) ((int64_t) (r % 11) - 5) * (i % 7 ? 0.5 : 1e300);
+        if(i % 13 == 0) wides[i].score = -0.0;
+        wides[i].grp = (int8_t) (r >> 20);
+        wides[i].grp %= 3;
+        wides[i].flag = (r >> 30) & 1;
+        wides[i].seq = (uint16_t) i;
+        mixed[i] = (Mixed) {
+            .f = (float) ((int) (r % 9) - 4) / 4.0f,
+            .i = (int64_t) (r >> 3) % 4 - 2 + (i % 50 == 0 ? INT64_MIN + 2 : 0),
+            .u = (uint8_t) (r >> 40) % 3,
+            .s = (int16_t) ((r >> 45) % 5) - 2,
+            .w = (uint32_t) (r >> 50) % 2 ? UINT32_MAX : 1,
+        };
+    }
+    memcpy(orders_ref, orders, sizeof(orders));
+    memcpy(wides_ref, wides, sizeof(wides));
+    memcpy(mixed_ref, mixed, sizeof(mixed));
+    REF_SORT(orders_ref, N, neat_Order_fields_cmp);
+    REF_SORT(wides_ref, N, neat_Wide_fields_cmp);
+    REF_SORT(mixed_ref, N, neat_Mixed_fields_cmp);
+}
+
+static void test_cmp(void)
+{
+    CHECK(neat_Order_key_size == 4 + 8 + 1);
+    CHECK(neat_Wide_key_size == 1 + 8 + 1);
+    CHECK(GET_CMP(Order) == (cmp_func) neat_Order_fields_cmp);
+    
+    Order a = { 5, 1, 'x' }, b = { 4, 0, 'x' }, c = { 5, 2, 'x' };
+    CHECK(neat_Order_fields_cmp(&a, &b) < 0); // prio is descending
+    CHECK(neat_Order_fields_cmp(&a, &c) < 0);
+    CHECK(neat_Order_fields_cmp(&a, &a) == 0);
+    
+    for(size_t i = 0 ; i + 1 < N ; i++)
+    {
+        CHECK_KEYS(Order, orders[i], orders[i + 1]);
+        CHECK_KEYS(Wide, wides[i], wides[i + 1]);
+        CHECK_KEYS(Mixed, mixed[i], mixed[i + 1]);
+    }
+    
+    Order sorted[N];
+    memcpy(sorted, orders, sizeof(sorted));
+    SORT(sorted);
+    for(size_t i = 0 ; i + 1 < N ; i++) CHECK(neat_Order_fields_cmp(&sorted[i], &sorted[i + 1]) <= 0);
+}
+
+// the radix sort is stable, so it must give exactly the reference order
+static void test_sort_by_key(void)
+{
+    Order o[N];
+    Wide w[N];
+    Mixed m[N];
+    
+    for(int fail = 0 ; fail <= 1 ; fail++)
+    {
+        fail_realloc = fail;
+        
+        memcpy(o, orders, sizeof(o));
+        memcpy(w, wides, sizeof(w));
+        memcpy(m, mixed, sizeof(m));
+        SORT_BY_KEY(o, Order);
+        SORT_BY_KEY(w, Wide);   // elements larger than a record, the copy is realloc'd
+        SORT_BY_KEY(m, Mixed);
+        CHECK(memcmp(o, orders_ref, sizeof(o)) == 0);
+        CHECK(memcmp(w, wides_ref, sizeof(w)) == 0);
+        CHECK(memcmp(m, mixed_ref, sizeof(m)) == 0);
+        
+        // already sorted, a prefix, and the lengths with nothing to do
+        SORT_BY_KEY(w, Wide);
+        CHECK(memcmp(w, wides_ref, sizeof(w)) == 0);
+        memcpy(w, wides, sizeof(w));
+        SORT_BY_KEY_PTR(w, 2, Wide);
+        CHECK(neat_Wide_fields_cmp(&w[0], &w[1]) <= 0);
+        CHECK(memcmp(w + 2, wides + 2, sizeof(w) - 2 * sizeof(*w)) == 0);
+        SORT_BY_KEY_PTR(w, 1, Wide);
+        SORT_BY_KEY_PTR(w, 0, Wide);
+    }
+    fail_realloc = false;
+}
+
+int main(void)
+{
+    fill();
+    test_cmp();
+    test_sort_by_key();
+    return TEST_DONE();
+}
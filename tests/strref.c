@@ -0,0 +1,68 @@
+// sh tests/run.sh cc strref
+
+#define NEAT_TOSTR_IMPLEMENTATION
+#include "neat_tostr.h"
+#include "test.h"
+
+#include <inttypes.h>
+
+#define check_ref(obj, want, borrowed) do { \
+    neat_strref check_r = to_string_ref(obj); \
+    CHECK_STR(check_r.str, want); \
+    CHECK(check_r.len == strlen(want)); \
+    CHECK(check_r.owned == !(borrowed)); \
+    neat_strref_free(check_r); \
+} while(0)
+
+int main(void)
+{
+    char want[32];
+
+    // the static tables and both sides of them, for every integer type they fit in
+    for(int v = -1000 ; v <= 2000 ; v++)
+    {
+        bool small = v >= NEAT_SMALL_INT_MIN && v <= NEAT_SMALL_INT_MAX;
+        snprintf(want, sizeof(want), "%d", v);
+        check_ref((int32_t) v, want, small);
+        check_ref((int64_t) v, want, small);
+        check_ref((int16_t) v, want, small);
+        if(v >= INT8_MIN && v <= INT8_MAX) check_ref((int8_t) v, want, small);
+        if(v >= 0)
+        {
+            check_ref((uint32_t) v, want, small);
+            check_ref((uint64_t) v, want, small);
+            check_ref((uint16_t) v, want, small);
+            if(v <= UINT8_MAX) check_ref((uint8_t) v, want, small);
+        }
+    }
+    check_ref(INT64_MIN, "-9223372036854775808", false);
+    check_ref(UINT64_MAX, "18446744073709551615", false);
+    for(int r = 0 ; r < 10000 ; r++)
+    {
+        int64_t v = (int64_t) test_rand() >> (test_rand() % 64);
+        snprintf(want, sizeof(want), "%" PRId64, v);
+        check_ref(v, want, v >= NEAT_SMALL_INT_MIN && v <= NEAT_SMALL_INT_MAX);
+    }
+
+    // every char, NUL included
+    for(int c = 0 ; c < 256 ; c++)
+    {
+        neat_strref r = to_string_ref((char) c);
+        CHECK(r.len == 1 && !r.owned);
+        CHECK(r.str[0] == (char) c && r.str[1] == '\0');
+        neat_strref_free(r);
+    }
+
+    check_ref((bool) true, "true", true);
+    check_ref((bool) false, "false", true);
+
+    // char* is the caller's own string, anything else is 'malloc'ed
+    char *s = "borrowed";
+    neat_strref r = to_string_ref(s);
+    CHECK(r.str == s && r.len == 8 && !r.owned);
+    neat_strref_free(r);
+    check_ref(0.25, "0.25", false);
+    check_ref(-1.5f, "-1.5", false);
+
+    return TEST_DONE();
+}
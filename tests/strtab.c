@@ -0,0 +1,117 @@
+// sh tests/run.sh cc strtab
+
+#define NEAT_SORT_IMPLEMENTATION
+#include "neat_sort.h"
+#include "test.h"
+
+#include <stdlib.h>
+
+static int cmp_str(const void *a, const void *b)
+{
+    return strcmp(*(char *const*) a, *(char *const*) b);
+}
+
+// short keys over a small alphabet, so they share long prefixes
+static void rand_key(char *buf)
+{
+    size_t len = test_rand() % 12;
+    for(size_t i = 0 ; i < len ; i++) buf[i] = "abc"[test_rand() % 3];
+    buf[len] = '\0';
+}
+
+// index of the first key >= key in the sorted array
+static size_t ref_lower_bound(char **keys, size_t n, const char *key)
+{
+    size_t i = 0;
+    while(i < n && strcmp(keys[i], key) < 0) i++;
+    return i;
+}
+
+static void check_table(char **keys, size_t n, size_t block)
+{
+    neat_strtab t = neat_strtab_build(keys, n, block);
+    CHECK(t.count == n);
+
+    char buf[64];
+    for(size_t i = 0 ; i < n ; i++)
+    {
+        CHECK(neat_strtab_get(&t, i, buf, sizeof(buf)) == strlen(keys[i]));
+        CHECK_STR(buf, keys[i]);
+        CHECK(neat_strtab_find(&t, keys[i]) == i);
+    }
+
+    // truncated get
+    if(n > 0)
+    {
+        size_t len = strlen(keys[n - 1]);
+        CHECK(neat_strtab_get(&t, n - 1, buf, 3) == len);
+        CHECK(strlen(buf) == (len < 2 ? len : 2));
+        CHECK(strncmp(buf, keys[n - 1], 2) == 0);
+    }
+
+    for(int r = 0 ; r < 300 ; r++)
+    {
+        char key[16];
+        rand_key(key);
+        size_t lb = ref_lower_bound(keys, n, key);
+        CHECK(neat_strtab_lower_bound(&t, key) == lb);
+        size_t want = lb < n && strcmp(keys[lb], key) == 0 ? lb : NEAT_STRTAB_NPOS;
+        CHECK(neat_strtab_find(&t, key) == want);
+
+        // every key with the prefix, in order
+        size_t prefix_len = strlen(key) / 2;
+        key[prefix_len] = '\0';
+        size_t i = ref_lower_bound(keys, n, key);
+        neat_strtab_iter it = neat_strtab_prefix(&t, key);
+        while(neat_strtab_next(&it))
+        {
+            CHECK(i < n && it.index == i);
+            if(i < n) CHECK_STR(it.str, keys[i]);
+            CHECK(it.len == strlen(it.str));
+            i++;
+        }
+        neat_strtab_iter_free(&it);
+        CHECK(i == n || strncmp(keys[i], key, prefix_len) != 0);
+    }
+
+    // iterate everything from the middle
+    size_t i = n / 2;
+    neat_strtab_iter it = neat_strtab_iter_at(&t, i);
+    while(neat_strtab_next(&it))
+    {
+        if(i < n) CHECK_STR(it.str, keys[i]);
+        i++;
+    }
+    neat_strtab_iter_free(&it);
+    CHECK(i == n);
+
+    neat_strtab_free(&t);
+}
+
+int main(void)
+{
+    static char store[2000][16];
+    static char *keys[2000];
+    size_t sizes[] = { 0, 1, 2, 17, 100, 2000 };
+    size_t blocks[] = { 0, 1, 3, 64 };
+
+    for(size_t s = 0 ; s < TEST_LEN(sizes) ; s++)
+    {
+        size_t n = 0;
+        for(size_t i = 0 ; i < sizes[s] ; i++)
+        {
+            rand_key(store[i]);
+            keys[i] = store[i];
+        }
+        qsort(keys, sizes[s], sizeof(*keys), cmp_str);
+
+        // the table takes unique keys
+        for(size_t i = 0 ; i < sizes[s] ; i++)
+            if(n == 0 || strcmp(keys[n - 1], keys[i]) != 0) keys[n++] = keys[i];
+
+        for(size_t b = 0 ; b < TEST_LEN(blocks) ; b++)
+            check_table(keys, n, blocks[b]);
+    }
+
+    return TEST_DONE();
+}
@@ -0,0 +1,37 @@
+/*
+    Shared by the tests. Every test is a standalone program that prints
+    the failed checks and returns non-zero if there were any, see run.sh.
+*/
+
+#ifndef NEAT_TEST_H
+#define NEAT_TEST_H
+
+#include <stdio.h>
+#include <string.h>
+
+static int test_failed;
+
+#define CHECK(cond) do { \
+if(!(cond)) { test_failed++; fprintf(stderr, "%s:%d: CHECK(%s) failed\n", __FILE__, __LINE__, #cond); } \
+} while(0)
+
+#define CHECK_STR(got, expected) do { \
+const char *test_got = (got), *test_exp = (expected); \
+if(strcmp(test_got, test_exp) != 0) { test_failed++; fprintf(stderr, "%s:%d: got \"%s\", expected \"%s\"\n", __FILE__, __LINE__, test_got, test_exp); } \
+} while(0)
+
+#define TEST_LEN(arr) (sizeof(arr) / sizeof(*(arr)))
+
+#define TEST_DONE() (test_failed ? (fprintf(stderr, "%s: %d failed\n", __FILE__, test_failed), 1) : 0)
+
+// xorshift, so every run checks the same values
+static unsigned long long test_rand_state = 88172645463325252ULL;
+static inline unsigned long long test_rand(void)
+{
+    test_rand_state ^= test_rand_state << 13;
+    test_rand_state ^= test_rand_state >> 7;
+    test_rand_state ^= test_rand_state << 17;
+    return test_rand_state;
+}
+
+#endif // NEAT_TEST_H
@@ -0,0 +1,119 @@
+// sh tests/run.sh cc to_chars
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+typedef struct { int x, y; } point;
+typedef struct { const char *name; } tag;
+
+static size_t point2chars(char *buf, size_t cap, point *p)
+{
+    return (size_t) snprintf(buf, cap, "(%d, %d)", p->x, p->y);
+}
+
+static char *tag2str(tag *t)
+{
+    size_t len = strlen(t->name);
+    char *s = malloc(len + 3);
+    snprintf(s, len + 3, "<%s>", t->name);
+    return s;
+}
+
+#define STRINGABLE_TYPES ADD_STRINGABLE_BUF(point, point2chars), ADD_STRINGABLE(tag, tag2str)
+#define NEAT_TOSTR_IMPLEMENTATION
+#include "neat_tostr.h"
+#include "test.h"
+
+#include <inttypes.h>
+
+// buf holds to_chars at every cap from 0 to past the end, it must always be snprintf's output
+#define check_to_chars(obj, want) do { \
+    const char *check_want = (want); \
+    size_t check_len = strlen(check_want); \
+    char check_buf[128]; \
+    for(size_t check_cap = 0 ; check_cap <= check_len + 1 ; check_cap++) \
+    { \
+        memset(check_buf, '#', sizeof(check_buf)); \
+        CHECK(to_chars(check_buf, check_cap, obj) == check_len); \
+        CHECK(check_buf[check_cap] == '#'); \
+        if(check_cap == 0) continue; \
+        CHECK(strlen(check_buf) == (check_cap - 1 < check_len ? check_cap - 1 : check_len)); \
+        CHECK(strncmp(check_buf, check_want, check_cap - 1) == 0); \
+    } \
+    char *check_str = to_string(obj); \
+    CHECK_STR(check_str, check_want); \
+    free(check_str); \
+} while(0)
+
+static void test_ints(void)
+{
+    char want[64];
+    for(int r = 0 ; r < 3000 ; r++)
+    {
+        uint64_t bits = test_rand() >> (test_rand() % 64);
+        int64_t i64 = (int64_t) bits * (r % 2 ? -1 : 1);
+        int32_t i32 = (int32_t) i64;
+        int16_t i16 = (int16_t) i64;
+        int8_t i8 = (int8_t) i64;
+        uint32_t u32 = (uint32_t) bits;
+        uint16_t u16 = (uint16_t) bits;
+        uint8_t u8 = (uint8_t) bits;
+
+        snprintf(want, sizeof(want), "%" PRId64, i64); check_to_chars(i64, want);
+        snprintf(want, sizeof(want), "%" PRId32, i32); check_to_chars(i32, want);
+        snprintf(want, sizeof(want), "%d", i16);       check_to_chars(i16, want);
+        snprintf(want, sizeof(want), "%d", i8);        check_to_chars(i8, want);
+        snprintf(want, sizeof(want), "%" PRIu64, bits); check_to_chars(bits, want);
+        snprintf(want, sizeof(want), "%" PRIu32, u32); check_to_chars(u32, want);
+        snprintf(want, sizeof(want), "%u", u16);       check_to_chars(u16, want);
+        snprintf(want, sizeof(want), "%u", u8);        check_to_chars(u8, want);
+
+        // hex is the two's complement of the type's own width
+        char buf[32];
+        snprintf(want, sizeof(want), "%" PRIx64, (uint64_t) i64);
+        CHECK(to_chars_hex(buf, sizeof(buf), i64) == strlen(want));
+        CHECK_STR(buf, want);
+        snprintf(want, sizeof(want), "%" PRIx32, (uint32_t) i32);
+        CHECK(to_chars_hex(buf, sizeof(buf), i32) == strlen(want));
+        CHECK_STR(buf, want);
+        snprintf(want, sizeof(want), "%x", (unsigned) (uint8_t) i8);
+        CHECK(to_chars_hex(buf, sizeof(buf), i8) == strlen(want));
+        CHECK_STR(buf, want);
+        snprintf(want, sizeof(want), "%x", (unsigned) u16);
+        CHECK(to_chars_hex(buf, 3, u16) == strlen(want));
+        CHECK(strncmp(buf, want, 2) == 0 && strlen(buf) <= 2);
+    }
+    check_to_chars(INT64_MIN, "-9223372036854775808");
+    check_to_chars(UINT64_MAX, "18446744073709551615");
+    check_to_chars((int8_t) -128, "-128");
+    check_to_chars((uint8_t) 0, "0");
+}
+
+static void test_others(void)
+{
+    check_to_chars((char*) "hello", "hello");
+    check_to_chars((char*) "", "");
+    check_to_chars((char) 'x', "x");
+    check_to_chars((bool) true, "true");
+    check_to_chars((bool) false, "false");
+    check_to_chars(0.1, "0.1");
+    check_to_chars(-1.5f, "-1.5");
+
+    // user types, with a buffer function or a 'malloc'ing one
+    point p = { -12, 345 };
+    check_to_chars(p, "(-12, 345)");
+    tag t = { "label" };
+    check_to_chars(t, "<label>");
+
+    // to_chars into a NULL buffer only measures
+    CHECK(to_chars(NULL, 0, p) == strlen("(-12, 345)"));
+    CHECK(to_chars(NULL, 0, (int32_t) -77) == 3);
+}
+
+int main(void)
+{
+    test_ints();
+    test_others();
+    return TEST_DONE();
+}
@@ -0,0 +1,114 @@
+// sh tests/run.sh cc writer
+
+#define NEAT_TOSTR_IMPLEMENTATION
+#include "neat_tostr.h"
+#include "test.h"
+
+#include <inttypes.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+typedef struct { int x, y; } point;
+
+static size_t point2chars(char *buf, size_t cap, const point *p)
+{
+    return (size_t) snprintf(buf, cap, "(%d, %d)", p->x, p->y);
+}
+
+static char *point2str(const point *p)
+{
+    char *s = malloc(32);
+    point2chars(s, 32, p);
+    return s;
+}
+
+// writes the same mix of everything to w
+static void write_mix(neat_writer *w)
+{
+    int64_t ints[] = { 0, -1, 42, INT64_MIN, INT64_MAX, -1234567890123 };
+    double dbls[] = { 0.1, -2.5, 1e300, 5e-324, 123456.789 };
+    for(int r = 0 ; r < 20 ; r++)
+    {
+        for(size_t i = 0 ; i < TEST_LEN(ints) ; i++) neat_writer_put_i64(w, ints[i]);
+        neat_writer_put_u64(w, UINT64_MAX);
+        for(size_t i = 0 ; i < TEST_LEN(dbls) ; i++) neat_writer_put_double(w, dbls[i]);
+        neat_writer_put_float(w, 3.14159f);
+        neat_writer_put_bool(w, r & 1);
+        neat_writer_put_char(w, '|');
+        neat_writer_put_str(w, "a string that's longer than the small buffers");
+        neat_writer_write(w, "", 0);
+        neat_writer_put_quoted(w, "q\"\n\x01", 4);
+        point p = { r, -r };
+        neat_writer_put_strfn(w, (neat_strfn){ .tochars = (neat_tochars_func) point2chars, .tostr = (neat_tostr_func) point2str }, &p);
+        wprintln(w, " ", r, " ", 0.5, " ", (uint8_t) 200);
+    }
+}
+
+// reads everything from a FILE
+static size_t slurp(FILE *f, char *out, size_t cap)
+{
+    rewind(f);
+    return fread(out, 1, cap, f);
+}
+
+static void test_caps(void)
+{
+    static char want[1 << 16], got[1 << 16];
+    FILE *f = tmpfile();
+    char big[1 << 12];
+    neat_writer w = neat_writer_file(f, big, sizeof(big));
+    write_mix(&w);
+    neat_writer_flush(&w);
+    size_t want_len = slurp(f, want, sizeof(want));
+    fclose(f);
+    CHECK(!w.error && want_len > 0);
+    
+    // the numbers match snprintf
+    char line[256];
+    int n = snprintf(line, sizeof(line), "0-142%" PRId64 "%" PRId64 "-1234567890123%" PRIu64, INT64_MIN, INT64_MAX, UINT64_MAX);
+    CHECK(want_len >= (size_t) n && memcmp(want, line, (size_t) n) == 0);
+    CHECK(strstr(want, "\"q\\\"\\n\\u0001\"") != NULL);
+    CHECK(strstr(want, "(3, -3)") != NULL);
+    
+    // every cap gives the same output, including ones too small for a number
+    for(size_t cap = 0 ; cap <= 80 ; cap++)
+    {
+        char *buf = malloc(cap ? cap : 1);
+        f = tmpfile();
+        w = neat_writer_file(f, cap ? buf : NULL, cap);
+        write_mix(&w);
+        neat_writer_flush(&w);
+        size_t len = slurp(f, got, sizeof(got));
+        CHECK(!w.error && len == want_len && memcmp(got, want, len) == 0);
+        if(len != want_len || memcmp(got, want, len) != 0) fprintf(stderr, "  cap %zu\n", cap);
+        fclose(f);
+        free(buf);
+    }
+    
+    // and through a file descriptor
+    f = tmpfile();
+    char buf[7];
+    w = neat_writer_fd(fileno(f), buf, sizeof(buf));
+    write_mix(&w);
+    neat_writer_flush(&w);
+    size_t len = slurp(f, got, sizeof(got));
+    CHECK(!w.error && len == want_len && memcmp(got, want, len) == 0);
+    fclose(f);
+}
+
+static void test_error(void)
+{
+    char buf[16];
+    neat_writer w = neat_writer_fd(-1, buf, sizeof(buf));
+    neat_writer_put_i64(&w, 1);
+    CHECK(!w.error);
+    neat_writer_flush(&w);
+    CHECK(w.error && w.len == 0);
+}
+
+int main(void)
+{
+    test_caps();
+    test_error();
+    return TEST_DONE();
+}